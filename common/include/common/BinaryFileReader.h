@@ -12,6 +12,7 @@ namespace spvgentwo
 		~BinaryFileReader();
 
 		bool get(unsigned int& _word) final;
+		bool read(unsigned int* _pWords, sgt_size_t _count) final;
 
 		bool open(const char* _path);
 		bool isOpen() const { return m_pFile != nullptr; }
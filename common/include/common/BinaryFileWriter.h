@@ -12,6 +12,7 @@ namespace spvgentwo
 		~BinaryFileWriter();
 
 		void put(unsigned int _word) final;
+		void write(const unsigned int* _pWords, sgt_size_t _count) final;
 
 		bool open(const char* _path);
 		bool isOpen() const { return m_pFile != nullptr; }
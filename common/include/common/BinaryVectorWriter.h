@@ -12,6 +12,7 @@ namespace spvgentwo
 		virtual ~BinaryVectorWriter() {};
 
 		void put(unsigned int _word) final;
+		void write(const unsigned int* _pWords, sgt_size_t _count) final;
 
 	private:
 		U32Vector& m_vector;
@@ -22,4 +23,13 @@ namespace spvgentwo
 	{
 		m_vector.emplace_back(_word);
 	}
+
+	template<typename U32Vector>
+	inline void BinaryVectorWriter<U32Vector>::write(const unsigned int* _pWords, sgt_size_t _count)
+	{
+		for (sgt_size_t i = 0u; i < _count; ++i)
+		{
+			m_vector.emplace_back(_pWords[i]);
+		}
+	}
 } //!spvgentwo
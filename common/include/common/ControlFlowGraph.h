@@ -2,12 +2,50 @@
 
 #include "Graph.h"
 #include "spvgentwo/Function.h"
+#include "spvgentwo/HashMap.h"
+#include "spvgentwo/Vector.h"
 
 namespace spvgentwo
 {
 	// forward decl
 	//class BasicBlock;
 
+	// view on a contiguous run of block indices
+	class BlockIndexRange
+	{
+	public:
+		BlockIndexRange(const unsigned int* _pBegin = nullptr, const unsigned int* _pEnd = nullptr) : m_pBegin(_pBegin), m_pEnd(_pEnd) {}
+
+		const unsigned int* begin() const { return m_pBegin; }
+		const unsigned int* end() const { return m_pEnd; }
+
+		unsigned int size() const { return static_cast<unsigned int>(m_pEnd - m_pBegin); }
+		bool empty() const { return m_pBegin == m_pEnd; }
+
+	private:
+		const unsigned int* m_pBegin = nullptr;
+		const unsigned int* m_pEnd = nullptr;
+	};
+
+	// compressed adjacency lists: targets of node i are m_targets[m_offsets[i], m_offsets[i+1])
+	class BlockAdjacency
+	{
+	public:
+		BlockAdjacency(IAllocator* _pAllocator = nullptr) : m_offsets(_pAllocator), m_targets(_pAllocator) {}
+
+		// number of nodes
+		unsigned int size() const { return m_offsets.empty() ? 0u : static_cast<unsigned int>(m_offsets.size() - 1u); }
+
+		BlockIndexRange operator[](unsigned int _index) const { return { m_targets.data() + m_offsets[_index], m_targets.data() + m_offsets[_index + 1u] }; }
+
+		// build from (_sources[i] -> _targets[i]) pairs with a counting sort, edge order per node is kept
+		void build(unsigned int _nodes, const Vector<unsigned int>& _sources, const Vector<unsigned int>& _targets);
+
+	private:
+		Vector<unsigned int> m_offsets;
+		Vector<unsigned int> m_targets;
+	};
+
 	template <class E = EmptyEdge>
 	class ControlFlowGraph : public Graph<BasicBlock*, E>
 	{
@@ -15,36 +53,112 @@ namespace spvgentwo
 		using Graph<BasicBlock*, E>::Graph;
 		using NodeType = typename Graph<BasicBlock*, E>::NodeType;
 
+		static constexpr unsigned int InvalidIndex = ~0u;
+
+		// blocks are indexed densely in function order, the function entry block has index 0
 		ControlFlowGraph(const Function& _func);
+
+		unsigned int getBlockCount() const { return static_cast<unsigned int>(m_blocks.size()); }
+
+		// returns InvalidIndex if _pBB is not part of this graph
+		unsigned int getIndex(const BasicBlock* _pBB) const;
+
+		NodeType* getNode(unsigned int _index) const { return m_blocks[_index]; }
+		BasicBlock* getBlock(unsigned int _index) const { return m_blocks[_index]->data(); }
+
+		BlockIndexRange getSuccessors(unsigned int _index) const { return m_successors[_index]; }
+		BlockIndexRange getPredecessors(unsigned int _index) const { return m_predecessors[_index]; }
+
+		const BlockAdjacency& getSuccessors() const { return m_successors; }
+		const BlockAdjacency& getPredecessors() const { return m_predecessors; }
+
+	private:
+		Vector<NodeType*> m_blocks;
+		HashMap<const BasicBlock*, unsigned int> m_indices;
+
+		BlockAdjacency m_successors;
+		BlockAdjacency m_predecessors;
 	};
 
 	template<class E>
-	inline ControlFlowGraph<E>::ControlFlowGraph(const Function& _func) : Graph<BasicBlock*, E>(_func.getAllocator())
+	inline ControlFlowGraph<E>::ControlFlowGraph(const Function& _func) : Graph<BasicBlock*, E>(_func.getAllocator()),
+		m_blocks(_func.getAllocator(), _func.size()),
+		m_indices(_func.getAllocator(), static_cast<unsigned int>(_func.size())),
+		m_successors(_func.getAllocator()),
+		m_predecessors(_func.getAllocator())
 	{
-		auto addEdge = [&](NodeType* src, Instruction::Iterator target)
+		for (BasicBlock& bb : _func)
 		{
-			if (BasicBlock* bb = target->getBranchTarget(); bb != nullptr)
-			{
-				auto it = this->m_nodes.find_if([bb](NodeType& n) {return n.data() == bb; });
-				NodeType* targetNode = it == this->m_nodes.end() ? this->emplace(bb) : it.operator->();
-				src->connect(targetNode);
-			}
-		};
+			m_indices.emplaceUnique(static_cast<const BasicBlock*>(&bb), static_cast<unsigned int>(m_blocks.size()));
+			m_blocks.emplace_back(this->emplace(&bb));
+		}
 
-		for (BasicBlock& bb : _func)
+		Vector<unsigned int> sources(_func.getAllocator());
+		Vector<unsigned int> targets(_func.getAllocator());
+
+		for (unsigned int src = 0u; src < getBlockCount(); ++src)
 		{
-			auto it = this->m_nodes.find_if([&bb](NodeType& n) {return n.data() == &bb; });
-			NodeType* node = it == this->m_nodes.end() ? this->emplace(&bb) : it.operator->();
+			const Instruction* term = getBlock(src)->getTerminator();
 
-			auto term = bb.getTerminator();
+			if (term == nullptr)
+			{
+				continue;
+			}
 
-			if (term != nullptr)
+			for (auto it = term->getFirstActualOperand(); it != term->end(); ++it)
 			{
-				for (auto it = term->getFirstActualOperand(); it != term->end(); ++it)
+				if (BasicBlock* bb = it->getBranchTarget(); bb != nullptr)
 				{
-					addEdge(node, it);
+					if (const unsigned int dst = getIndex(bb); dst != InvalidIndex)
+					{
+						m_blocks[src]->connect(m_blocks[dst]);
+						sources.emplace_back(src);
+						targets.emplace_back(dst);
+					}
 				}
 			}
 		}
+
+		m_successors.build(getBlockCount(), sources, targets);
+		m_predecessors.build(getBlockCount(), targets, sources);
+	}
+
+	template<class E>
+	inline unsigned int ControlFlowGraph<E>::getIndex(const BasicBlock* _pBB) const
+	{
+		const unsigned int* pIndex = m_indices.get(_pBB);
+		return pIndex != nullptr ? *pIndex : InvalidIndex;
+	}
+
+	inline void BlockAdjacency::build(unsigned int _nodes, const Vector<unsigned int>& _sources, const Vector<unsigned int>& _targets)
+	{
+		const unsigned int zero = 0u;
+		m_offsets.clear();
+		m_offsets.resize(_nodes + 1u, &zero);
+
+		for (const unsigned int src : _sources)
+		{
+			++m_offsets[src + 1u];
+		}
+
+		for (unsigned int i = 0u; i < _nodes; ++i)
+		{
+			m_offsets[i + 1u] += m_offsets[i];
+		}
+
+		m_targets.clear();
+		m_targets.resize(_targets.size(), &zero);
+
+		// scatter, using the start offsets of the next node as cursor and restoring them afterwards
+		for (sgt_size_t i = 0u; i < _sources.size(); ++i)
+		{
+			m_targets[m_offsets[_sources[i]]++] = _targets[i];
+		}
+
+		for (unsigned int i = _nodes; i > 0u; --i)
+		{
+			m_offsets[i] = m_offsets[i - 1u];
+		}
+		m_offsets[0] = 0u;
 	}
-} // !spvgentwo
\ No newline at end of file
+} // !spvgentwo
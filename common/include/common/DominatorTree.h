@@ -0,0 +1,69 @@
+#pragma once
+
+#include "ControlFlowGraph.h"
+
+namespace spvgentwo
+{
+	// (post) dominator tree and dominance frontiers of a ControlFlowGraph, computed with the iterative
+	// algorithm of Cooper, Harvey & Kennedy ("A Simple, Fast Dominance Algorithm") on dense block indices.
+	// Dominator trees are rooted at block 0 (function entry). Post dominator trees are rooted at the blocks without successors
+	// and form a forest if there are several exits (roots and blocks only post dominated by a set of exits have no immediate post dominator).
+	class DominatorTree
+	{
+	public:
+		static constexpr unsigned int InvalidIndex = ~0u;
+
+		DominatorTree(IAllocator* _pAllocator = nullptr);
+
+		template <class E>
+		DominatorTree(const ControlFlowGraph<E>& _cfg, bool _postDominators = false);
+
+		DominatorTree(const BlockAdjacency& _successors, const BlockAdjacency& _predecessors, bool _postDominators = false, IAllocator* _pAllocator = nullptr);
+
+		// returns false if allocation failed
+		bool build(const BlockAdjacency& _successors, const BlockAdjacency& _predecessors, bool _postDominators = false);
+
+		bool isPostDominatorTree() const { return m_post; }
+
+		// excluding the virtual root
+		unsigned int getBlockCount() const { return m_idom.empty() ? 0u : static_cast<unsigned int>(m_idom.size() - 1u); }
+
+		// false for blocks not reachable from the entry (or not reaching an exit for post dominators)
+		bool isReachable(unsigned int _block) const { return m_idom[_block] != InvalidIndex || isRoot(_block); }
+
+		// returns InvalidIndex for roots and unreachable blocks (exit blocks of post dominator trees with several exits have no immediate post dominator)
+		unsigned int getImmediateDominator(unsigned int _block) const { return m_idom[_block]; }
+
+		// blocks immediately dominated by _block
+		BlockIndexRange getChildren(unsigned int _block) const { return m_children[_block]; }
+
+		// blocks where the dominance of _block ends (join points for SSA construction)
+		BlockIndexRange getDominanceFrontier(unsigned int _block) const { return m_frontiers[_block]; }
+
+		// true if every path from the root to _block passes _dominator (_block dominates itself), O(1)
+		bool dominates(unsigned int _dominator, unsigned int _block) const;
+
+		bool strictlyDominates(unsigned int _dominator, unsigned int _block) const { return _dominator != _block && dominates(_dominator, _block); }
+
+	private:
+		bool isRoot(unsigned int _block) const { return m_preorder[_block] != InvalidIndex && m_idom[_block] == InvalidIndex; }
+
+	private:
+		bool m_post = false;
+
+		Vector<unsigned int> m_idom;
+
+		// dominator tree interval of each block, _a dominates _b if _b's preorder number lies in [m_preorder[_a], m_subtreeEnd[_a])
+		Vector<unsigned int> m_preorder;
+		Vector<unsigned int> m_subtreeEnd;
+
+		BlockAdjacency m_children;
+		BlockAdjacency m_frontiers;
+	};
+
+	template<class E>
+	inline DominatorTree::DominatorTree(const ControlFlowGraph<E>& _cfg, bool _postDominators) :
+		DominatorTree(_cfg.getSuccessors(), _cfg.getPredecessors(), _postDominators, _cfg.getAllocator())
+	{
+	}
+} // !spvgentwo
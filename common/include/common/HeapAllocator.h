@@ -2,6 +2,8 @@
 
 #include "spvgentwo/Allocator.h"
 
+#include <atomic>
+
 #ifdef SPVGENTWO_DEBUG_HEAP_ALLOC
 	#include <unordered_map>
 	#include <unordered_set>
@@ -9,6 +11,7 @@
 
 namespace spvgentwo
 {
+	// thread safe unless SPVGENTWO_DEBUG_HEAP_ALLOC is enabled
 	class HeapAllocator : public IAllocator
 	{
 	public:
@@ -20,8 +23,8 @@ namespace spvgentwo
 
 		void setHeapAllocBreakpoint(unsigned int _id);
 	private:
-		sgt_size_t m_Allocated = 0u;
-		sgt_size_t m_Deallocated = 0u;
+		std::atomic<sgt_size_t> m_Allocated{ 0u };
+		std::atomic<sgt_size_t> m_Deallocated{ 0u };
 
 #ifdef SPVGENTWO_DEBUG_HEAP_ALLOC
 		struct entry { unsigned int id; unsigned int size; operator sgt_size_t() const { return sgt_size_t(id) | sgt_size_t(size) << 32u; } };
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "spvgentwo/Allocator.h"
+
+namespace spvgentwo
+{
+	// bump allocator for objects sharing one lifetime (e.g. a Module that is built, serialized and discarded):
+	// memory is taken from chunks obtained via malloc, deallocate() is a no-op and reset() / release() free everything at once
+	class LinearArenaAllocator : public IAllocator
+	{
+	public:
+		static constexpr sgt_size_t DefaultChunkSize = 64u * 1024u;
+
+		LinearArenaAllocator(const sgt_size_t _chunkSize = DefaultChunkSize) : m_chunkSize(_chunkSize) {}
+		~LinearArenaAllocator();
+
+		LinearArenaAllocator(const LinearArenaAllocator&) = delete;
+		LinearArenaAllocator& operator=(const LinearArenaAllocator&) = delete;
+
+		void* allocate(const sgt_size_t _bytes, const unsigned int _aligment = 1u) final;
+		void deallocate(void* _ptr, const sgt_size_t _bytes = 0u) final;
+
+		// rewind to the first chunk and free all others, invalidates all allocations
+		void reset();
+
+		// free all chunks, invalidates all allocations
+		void release();
+
+		// size of newly allocated chunks, larger allocations get a chunk of their own
+		void setChunkSize(const sgt_size_t _chunkSize) { m_chunkSize = _chunkSize; }
+		sgt_size_t getChunkSize() const { return m_chunkSize; }
+
+		// bytes handed out since the last reset() / release() (including alignment padding)
+		sgt_size_t getUsedBytes() const { return m_usedBytes; }
+		// maximum of getUsedBytes() over the lifetime of this allocator
+		sgt_size_t getHighWaterMark() const { return m_highWaterMark; }
+		// bytes requested from malloc for chunks that are currently held
+		sgt_size_t getReservedBytes() const { return m_reservedBytes; }
+		// bytes passed to deallocate() since the last reset() / release(), which are not reused
+		sgt_size_t getWastedBytes() const { return m_wastedBytes; }
+		unsigned int getChunkCount() const { return m_chunkCount; }
+
+	private:
+		struct Chunk
+		{
+			Chunk* pPrev;
+			sgt_size_t size; // usable bytes after the header
+		};
+
+		// allocate a new chunk that can hold at least _bytes with _alignment
+		bool addChunk(const sgt_size_t _bytes, const sgt_size_t _alignment);
+
+	private:
+		sgt_size_t m_chunkSize = DefaultChunkSize;
+
+		Chunk* m_pChunk = nullptr; // current chunk, linked to previous chunks
+		unsigned char* m_pCur = nullptr;
+		unsigned char* m_pEnd = nullptr;
+
+		sgt_size_t m_usedBytes = 0u;
+		sgt_size_t m_highWaterMark = 0u;
+		sgt_size_t m_reservedBytes = 0u;
+		sgt_size_t m_wastedBytes = 0u;
+		unsigned int m_chunkCount = 0u;
+	};
+} //! spvgentwo
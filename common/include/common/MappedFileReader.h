@@ -0,0 +1,41 @@
+#pragma once
+
+#include "spvgentwo/Reader.h"
+
+namespace spvgentwo
+{
+	// maps the whole file into memory, words are handed out directly from the mapping
+	class MappedFileReader : public IReader
+	{
+	public:
+		MappedFileReader(const char* _path = nullptr);
+		~MappedFileReader();
+
+		bool get(unsigned int& _word) final;
+		bool read(unsigned int* _pWords, sgt_size_t _count) final;
+
+		// zero-copy alternative to read(): returns pointer to the next _count words in the mapping and advances, nullptr on EOF
+		// the pointer stays valid until close(), e.g. to reference literal strings of OpName or OpString in place
+		const unsigned int* readInPlace(sgt_size_t _count);
+
+		bool open(const char* _path);
+		bool isOpen() const { return m_pWords != nullptr; }
+		operator bool() const { return m_pWords != nullptr; }
+
+		void close();
+
+		// mapped file contents, size in words (trailing bytes of files not aligned to 4 bytes are ignored)
+		const unsigned int* data() const { return m_pWords; }
+		sgt_size_t size() const { return m_wordCount; }
+
+		// index of the next word to read
+		sgt_size_t position() const { return m_position; }
+
+	private:
+		const unsigned int* m_pWords = nullptr;
+		sgt_size_t m_wordCount = 0u;
+		sgt_size_t m_position = 0u;
+		sgt_size_t m_mappedBytes = 0u;
+		void* m_pMapping = nullptr; // platform handle
+	};
+} //!spvgentwo
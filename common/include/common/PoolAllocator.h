@@ -0,0 +1,87 @@
+#pragma once
+
+#include "spvgentwo/Allocator.h"
+
+namespace spvgentwo
+{
+	// size class slab allocator: small allocations (List / HashMap nodes etc.) are served from per size class free lists,
+	// slabs are obtained from the upstream allocator and only returned on release() or destruction.
+	// deallocate() must be called with the same _bytes that were passed to allocate(). the containers do, destruct() only does if T is the constructed type
+	// and not a base class, which is why Callable destroys its implementation through a virtual function
+	class PoolAllocator : public IAllocator
+	{
+	public:
+		static constexpr sgt_size_t Granularity = 16u;
+		static constexpr unsigned int SizeClassCount = 16u;
+		static constexpr sgt_size_t MaxPooledSize = Granularity * SizeClassCount; // larger allocations are forwarded to upstream
+		static constexpr sgt_size_t DefaultSlabSize = 16u * 1024u;
+
+		struct SizeClassStats
+		{
+			sgt_size_t blockSize = 0u;
+			sgt_size_t usedBlocks = 0u; // handed out
+			sgt_size_t freeBlocks = 0u; // in the free list or not yet carved from the current slab
+			unsigned int slabs = 0u;
+		};
+
+		// _pUpstream == nullptr uses HeapAllocator::instance()
+		PoolAllocator(IAllocator* _pUpstream = nullptr, const sgt_size_t _slabSize = DefaultSlabSize);
+		~PoolAllocator();
+
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+		void* allocate(const sgt_size_t _bytes, const unsigned int _aligment = 1u) final;
+		void deallocate(void* _ptr, const sgt_size_t _bytes = 0u) final;
+
+		// return all slabs to the upstream allocator, invalidates all pooled allocations
+		void release();
+
+		IAllocator* getUpstream() const { return m_pUpstream; }
+
+		SizeClassStats getStats(const unsigned int _sizeClass) const;
+
+		// bytes of all slabs
+		sgt_size_t getReservedBytes() const;
+
+		// bytes of blocks currently handed out
+		sgt_size_t getUsedBytes() const;
+
+		// share of reserved slab memory that is not handed out [0, 1]
+		float getFragmentation() const;
+
+		// bytes currently forwarded to the upstream allocator
+		sgt_size_t getUpstreamBytes() const { return m_upstreamBytes; }
+
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* pNext;
+		};
+
+		// stored at the end of each slab
+		struct SlabHeader
+		{
+			SlabHeader* pNext;
+		};
+
+		struct SizeClass
+		{
+			FreeBlock* pFree = nullptr;
+			unsigned char* pCur = nullptr; // not yet carved part of the newest slab
+			unsigned char* pEnd = nullptr;
+			SlabHeader* pSlabs = nullptr;
+			SizeClassStats stats;
+		};
+
+		static unsigned int getSizeClass(const sgt_size_t _bytes) { return static_cast<unsigned int>((_bytes + Granularity - 1u) / Granularity) - 1u; }
+
+		bool addSlab(SizeClass& _class);
+
+	private:
+		IAllocator* m_pUpstream = nullptr;
+		sgt_size_t m_slabSize = DefaultSlabSize;
+		sgt_size_t m_upstreamBytes = 0u;
+		SizeClass m_classes[SizeClassCount];
+	};
+} //! spvgentwo
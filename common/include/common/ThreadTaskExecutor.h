@@ -0,0 +1,21 @@
+#pragma once
+
+#include "spvgentwo/TaskExecutor.h"
+
+namespace spvgentwo
+{
+	// runs tasks on std::threads spawned per run() call, the calling thread participates
+	class ThreadTaskExecutor : public ITaskExecutor
+	{
+	public:
+		// _threadCount = 0 uses the number of hardware threads
+		ThreadTaskExecutor(unsigned int _threadCount = 0u);
+
+		void run(Task _task, void* _pUserData, unsigned int _count) final;
+
+		unsigned int getThreadCount() const { return m_threadCount; }
+
+	private:
+		unsigned int m_threadCount = 1u;
+	};
+} // !spvgentwo
@@ -15,6 +15,11 @@ bool spvgentwo::BinaryFileReader::get(unsigned int& _word)
 	return m_pFile != nullptr && fread(&_word, sizeof(unsigned int), 1u, m_pFile) == 1u;
 }
 
+bool spvgentwo::BinaryFileReader::read(unsigned int* _pWords, sgt_size_t _count)
+{
+	return m_pFile != nullptr && fread(_pWords, sizeof(unsigned int), _count, m_pFile) == _count;
+}
+
 bool spvgentwo::BinaryFileReader::open(const char* _path)
 {
 	if (m_pFile != nullptr || _path == nullptr)
@@ -18,6 +18,14 @@ void spvgentwo::BinaryFileWriter::put(unsigned int _word)
 	}
 }
 
+void spvgentwo::BinaryFileWriter::write(const unsigned int* _pWords, sgt_size_t _count)
+{
+	if (m_pFile != nullptr)
+	{
+		fwrite(_pWords, sizeof(unsigned int), _count, m_pFile);
+	}
+}
+
 bool spvgentwo::BinaryFileWriter::open(const char* _path)
 {
 	if (m_pFile != nullptr || _path == nullptr)
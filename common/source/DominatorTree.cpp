@@ -0,0 +1,236 @@
+#include "common/DominatorTree.h"
+
+spvgentwo::DominatorTree::DominatorTree(IAllocator* _pAllocator) :
+	m_idom(_pAllocator),
+	m_preorder(_pAllocator),
+	m_subtreeEnd(_pAllocator),
+	m_children(_pAllocator),
+	m_frontiers(_pAllocator)
+{
+}
+
+spvgentwo::DominatorTree::DominatorTree(const BlockAdjacency& _successors, const BlockAdjacency& _predecessors, bool _postDominators, IAllocator* _pAllocator) :
+	DominatorTree(_pAllocator)
+{
+	build(_successors, _predecessors, _postDominators);
+}
+
+bool spvgentwo::DominatorTree::build(const BlockAdjacency& _successors, const BlockAdjacency& _predecessors, bool _postDominators)
+{
+	m_post = _postDominators;
+
+	IAllocator* pAllocator = m_idom.getAllocator();
+
+	// blocks are 0..n-1, n is a virtual root connected to the entry block, or to all exit blocks for post dominators
+	const unsigned int n = _successors.size();
+	const unsigned int root = n;
+	const unsigned int invalid = InvalidIndex;
+
+	const BlockAdjacency& forward = m_post ? _predecessors : _successors;
+	const BlockAdjacency& backward = m_post ? _successors : _predecessors;
+
+	Vector<unsigned int> rootSuccessors(pAllocator);
+	for (unsigned int b = 0u; b < n; ++b)
+	{
+		if (m_post ? _successors[b].empty() : b == 0u)
+		{
+			rootSuccessors.emplace_back(b);
+		}
+	}
+
+	auto successors = [&](unsigned int b) -> BlockIndexRange
+	{
+		return b == root ? BlockIndexRange(rootSuccessors.begin(), rootSuccessors.end()) : forward[b];
+	};
+
+	// calls _func for all predecessors of b, including the virtual root
+	auto forEachPredecessor = [&](unsigned int b, const auto& _func)
+	{
+		if (m_post ? _successors[b].empty() : b == 0u)
+		{
+			_func(root);
+		}
+		for (const unsigned int p : backward[b])
+		{
+			_func(p);
+		}
+	};
+
+	m_idom.clear();
+	m_preorder.clear();
+	m_subtreeEnd.clear();
+
+	Vector<unsigned int> postorder(pAllocator);
+	Vector<unsigned int> order(pAllocator); // blocks in postorder
+
+	if (order.reserve(n + 1u) == false || m_idom.resize(n + 1u, &invalid) == false || postorder.resize(n + 1u, &invalid) == false ||
+		m_preorder.resize(n + 1u, &invalid) == false || m_subtreeEnd.resize(n + 1u, &invalid) == false)
+	{
+		return false;
+	}
+
+	struct Visit { unsigned int block; unsigned int next; };
+	Vector<Visit> stack(pAllocator);
+	stack.reserve(n + 1u);
+
+	// iterative depth first search from the virtual root, m_preorder marks visited blocks until the tree is numbered
+	stack.emplace_back(Visit{ root, 0u });
+	m_preorder[root] = 0u;
+
+	while (stack.empty() == false)
+	{
+		Visit& top = stack.back();
+		const BlockIndexRange succs = successors(top.block);
+
+		if (top.next < succs.size())
+		{
+			const unsigned int s = succs.begin()[top.next++];
+			if (m_preorder[s] == invalid)
+			{
+				m_preorder[s] = 0u;
+				stack.emplace_back(Visit{ s, 0u });
+			}
+		}
+		else
+		{
+			postorder[top.block] = static_cast<unsigned int>(order.size());
+			order.emplace_back(top.block);
+			stack.reset(stack.size() - 1u);
+		}
+	}
+
+	auto intersect = [&](unsigned int a, unsigned int b) -> unsigned int
+	{
+		while (a != b)
+		{
+			while (postorder[a] < postorder[b]) a = m_idom[a];
+			while (postorder[b] < postorder[a]) b = m_idom[b];
+		}
+		return a;
+	};
+
+	// iterate in reverse postorder until fixed point, the root is last in postorder
+	m_idom[root] = root;
+	for (bool changed = true; changed;)
+	{
+		changed = false;
+		for (unsigned int i = static_cast<unsigned int>(order.size()) - 1u; i-- > 0u;)
+		{
+			const unsigned int b = order[i];
+			unsigned int newIdom = invalid;
+
+			forEachPredecessor(b, [&](unsigned int p)
+			{
+				if (m_idom[p] != invalid)
+				{
+					newIdom = newIdom == invalid ? p : intersect(p, newIdom);
+				}
+			});
+
+			if (m_idom[b] != newIdom)
+			{
+				m_idom[b] = newIdom;
+				changed = true;
+			}
+		}
+	}
+
+	// dominance frontiers: walk up from the predecessors of each join point to its immediate dominator
+	Vector<unsigned int> sources(pAllocator);
+	Vector<unsigned int> targets(pAllocator);
+	{
+		Vector<unsigned int> lastJoin(pAllocator);
+		lastJoin.resize(n + 1u, &invalid);
+
+		for (unsigned int b = 0u; b < n; ++b)
+		{
+			if (m_idom[b] == invalid)
+			{
+				continue;
+			}
+
+			unsigned int preds = 0u;
+			forEachPredecessor(b, [&](unsigned int p) { preds += m_idom[p] != invalid ? 1u : 0u; });
+
+			if (preds < 2u)
+			{
+				continue;
+			}
+
+			forEachPredecessor(b, [&](unsigned int p)
+			{
+				for (unsigned int runner = p; m_idom[p] != invalid && runner != m_idom[b]; runner = m_idom[runner])
+				{
+					if (lastJoin[runner] != b && runner != root)
+					{
+						lastJoin[runner] = b;
+						sources.emplace_back(runner);
+						targets.emplace_back(b);
+					}
+				}
+			});
+		}
+	}
+	m_frontiers.build(n + 1u, sources, targets);
+
+	// dominator tree edges
+	sources.reset();
+	targets.reset();
+	for (unsigned int b = 0u; b < n; ++b)
+	{
+		if (m_idom[b] != invalid)
+		{
+			sources.emplace_back(m_idom[b]);
+			targets.emplace_back(b);
+		}
+	}
+	m_children.build(n + 1u, sources, targets);
+
+	// number the tree in preorder for constant time dominance queries
+	unsigned int counter = 0u;
+	stack.reset();
+	stack.emplace_back(Visit{ root, 0u });
+	m_preorder[root] = counter++;
+
+	while (stack.empty() == false)
+	{
+		Visit& top = stack.back();
+		const BlockIndexRange children = m_children[top.block];
+
+		if (top.next < children.size())
+		{
+			const unsigned int c = children.begin()[top.next++];
+			m_preorder[c] = counter++;
+			stack.emplace_back(Visit{ c, 0u });
+		}
+		else
+		{
+			m_subtreeEnd[top.block] = counter;
+			stack.reset(stack.size() - 1u);
+		}
+	}
+
+	for (unsigned int b = 0u; b <= n; ++b)
+	{
+		if (m_idom[b] == invalid)
+		{
+			m_preorder[b] = invalid; // unreachable
+		}
+		if (m_idom[b] == root)
+		{
+			m_idom[b] = invalid;
+		}
+	}
+
+	return true;
+}
+
+bool spvgentwo::DominatorTree::dominates(unsigned int _dominator, unsigned int _block) const
+{
+	if (m_preorder[_dominator] == InvalidIndex || m_preorder[_block] == InvalidIndex)
+	{
+		return false;
+	}
+
+	return m_preorder[_dominator] <= m_preorder[_block] && m_preorder[_block] < m_subtreeEnd[_dominator];
+}
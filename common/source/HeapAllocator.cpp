@@ -1,18 +1,35 @@
 #include "common/HeapAllocator.h"
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <cassert>
 
+#ifdef _WIN32
+	#include <malloc.h>
+#endif
+
 #ifdef SPVGENTWO_DEBUG_HEAP_ALLOC
 	#include <stdio.h>
 #endif
 
 void* spvgentwo::HeapAllocator::allocate(const sgt_size_t _bytes, const unsigned int _aligment)
 {
-	(void)_aligment;
 	m_Allocated += _bytes;
 
-	void* ptr = malloc(_bytes);
+#ifdef _WIN32
+	// memory from _aligned_malloc must be released with _aligned_free, so all allocations go through it
+	void* ptr = _aligned_malloc(_bytes, _aligment > alignof(max_align_t) ? _aligment : alignof(max_align_t));
+#else
+	void* ptr = nullptr;
+	if (_aligment <= alignof(max_align_t))
+	{
+		ptr = malloc(_bytes);
+	}
+	else if (posix_memalign(&ptr, _aligment, _bytes) != 0) // can be released with free
+	{
+		ptr = nullptr;
+	}
+#endif
 
 #ifdef SPVGENTWO_DEBUG_HEAP_ALLOC
 	entry alloc{ (uint32_t)m_allocations.size(), (uint32_t)_bytes };
@@ -51,7 +68,11 @@ void spvgentwo::HeapAllocator::deallocate(void* _ptr, const sgt_size_t _bytes)
 	m_allocations.erase(_ptr);
 #endif
 
+#ifdef _WIN32
+	_aligned_free(_ptr);
+#else
 	free(_ptr);
+#endif
 }
 
 spvgentwo::HeapAllocator::~HeapAllocator()
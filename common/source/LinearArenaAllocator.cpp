@@ -0,0 +1,120 @@
+#include "common/LinearArenaAllocator.h"
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// alignment of chunk memory returned by malloc
+static constexpr spvgentwo::sgt_size_t MinAlignment = alignof(max_align_t);
+static constexpr spvgentwo::sgt_size_t HeaderSize = (sizeof(void*) + sizeof(spvgentwo::sgt_size_t) + MinAlignment - 1u) & ~(MinAlignment - 1u);
+
+spvgentwo::LinearArenaAllocator::~LinearArenaAllocator()
+{
+	release();
+}
+
+void* spvgentwo::LinearArenaAllocator::allocate(const sgt_size_t _bytes, const unsigned int _aligment)
+{
+	const sgt_size_t alignment = _aligment != 0u ? _aligment : 1u;
+
+	auto align = [alignment](unsigned char* _ptr) -> unsigned char*
+	{
+		const uintptr_t addr = reinterpret_cast<uintptr_t>(_ptr);
+		return reinterpret_cast<unsigned char*>((addr + alignment - 1u) & ~static_cast<uintptr_t>(alignment - 1u));
+	};
+
+	unsigned char* ptr = align(m_pCur);
+
+	if (m_pCur == nullptr || ptr > m_pEnd || static_cast<sgt_size_t>(m_pEnd - ptr) < _bytes)
+	{
+		if (addChunk(_bytes, alignment) == false)
+		{
+			return nullptr;
+		}
+		ptr = align(m_pCur);
+	}
+
+	unsigned char* next = ptr + _bytes;
+	m_usedBytes += static_cast<sgt_size_t>(next - m_pCur);
+	m_pCur = next;
+
+	if (m_usedBytes > m_highWaterMark)
+	{
+		m_highWaterMark = m_usedBytes;
+	}
+
+	return ptr;
+}
+
+void spvgentwo::LinearArenaAllocator::deallocate(void* _ptr, const sgt_size_t _bytes)
+{
+	(void)_ptr;
+	m_wastedBytes += _bytes;
+}
+
+bool spvgentwo::LinearArenaAllocator::addChunk(const sgt_size_t _bytes, const sgt_size_t _alignment)
+{
+	const sgt_size_t required = _alignment > MinAlignment ? _bytes + _alignment - MinAlignment : _bytes; // worst case padding
+	const sgt_size_t size = required > m_chunkSize ? required : m_chunkSize;
+
+	Chunk* pChunk = static_cast<Chunk*>(malloc(HeaderSize + size));
+
+	if (pChunk == nullptr)
+	{
+		return false;
+	}
+
+	pChunk->pPrev = m_pChunk;
+	pChunk->size = size;
+
+	m_pChunk = pChunk;
+	m_pCur = reinterpret_cast<unsigned char*>(pChunk) + HeaderSize;
+	m_pEnd = m_pCur + size;
+
+	m_reservedBytes += HeaderSize + size;
+	++m_chunkCount;
+
+	return true;
+}
+
+void spvgentwo::LinearArenaAllocator::reset()
+{
+	if (m_pChunk == nullptr)
+	{
+		return;
+	}
+
+	// keep the oldest chunk, free the rest
+	while (m_pChunk->pPrev != nullptr)
+	{
+		Chunk* pPrev = m_pChunk->pPrev;
+		m_reservedBytes -= HeaderSize + m_pChunk->size;
+		free(m_pChunk);
+		m_pChunk = pPrev;
+	}
+
+	m_pCur = reinterpret_cast<unsigned char*>(m_pChunk) + HeaderSize;
+	m_pEnd = m_pCur + m_pChunk->size;
+
+	m_chunkCount = 1u;
+	m_usedBytes = 0u;
+	m_wastedBytes = 0u;
+}
+
+void spvgentwo::LinearArenaAllocator::release()
+{
+	while (m_pChunk != nullptr)
+	{
+		Chunk* pPrev = m_pChunk->pPrev;
+		free(m_pChunk);
+		m_pChunk = pPrev;
+	}
+
+	m_pCur = nullptr;
+	m_pEnd = nullptr;
+
+	m_chunkCount = 0u;
+	m_usedBytes = 0u;
+	m_reservedBytes = 0u;
+	m_wastedBytes = 0u;
+}
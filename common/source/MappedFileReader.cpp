@@ -0,0 +1,141 @@
+#include "common/MappedFileReader.h"
+#include <cstring>
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+spvgentwo::MappedFileReader::MappedFileReader(const char* _path)
+{
+	open(_path);
+}
+
+spvgentwo::MappedFileReader::~MappedFileReader()
+{
+	close();
+}
+
+bool spvgentwo::MappedFileReader::get(unsigned int& _word)
+{
+	if (m_position < m_wordCount)
+	{
+		_word = m_pWords[m_position++];
+		return true;
+	}
+	return false;
+}
+
+bool spvgentwo::MappedFileReader::read(unsigned int* _pWords, sgt_size_t _count)
+{
+	if (const unsigned int* pWords = readInPlace(_count); pWords != nullptr)
+	{
+		memcpy(_pWords, pWords, _count * sizeof(unsigned int));
+		return true;
+	}
+	return false;
+}
+
+const unsigned int* spvgentwo::MappedFileReader::readInPlace(sgt_size_t _count)
+{
+	if (m_pWords == nullptr || _count > m_wordCount - m_position)
+	{
+		return nullptr;
+	}
+
+	const unsigned int* pWords = m_pWords + m_position;
+	m_position += _count;
+	return pWords;
+}
+
+bool spvgentwo::MappedFileReader::open(const char* _path)
+{
+	if (m_pWords != nullptr || _path == nullptr)
+	{
+		return false;
+	}
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size{};
+	HANDLE mapping = nullptr;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+	{
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	}
+	CloseHandle(file); // the mapping keeps the file open
+
+	if (mapping == nullptr)
+	{
+		return false;
+	}
+
+	void* pView = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (pView == nullptr)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	m_pMapping = mapping;
+	m_mappedBytes = static_cast<sgt_size_t>(size.QuadPart);
+#else
+	const int file = ::open(_path, O_RDONLY);
+	if (file == -1)
+	{
+		return false;
+	}
+
+	struct stat info{};
+	void* pView = MAP_FAILED;
+	if (fstat(file, &info) == 0 && info.st_size > 0)
+	{
+		pView = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	}
+	::close(file); // the mapping keeps the file open
+
+	if (pView == MAP_FAILED)
+	{
+		return false;
+	}
+
+	m_mappedBytes = static_cast<sgt_size_t>(info.st_size);
+#endif
+
+	m_pWords = static_cast<const unsigned int*>(pView);
+	m_wordCount = m_mappedBytes / sizeof(unsigned int);
+	m_position = 0u;
+
+	return true;
+}
+
+void spvgentwo::MappedFileReader::close()
+{
+	if (m_pWords == nullptr)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_pWords);
+	CloseHandle(static_cast<HANDLE>(m_pMapping));
+#else
+	munmap(const_cast<unsigned int*>(m_pWords), m_mappedBytes);
+#endif
+
+	m_pWords = nullptr;
+	m_pMapping = nullptr;
+	m_wordCount = 0u;
+	m_position = 0u;
+	m_mappedBytes = 0u;
+}
@@ -0,0 +1,159 @@
+#include "common/PoolAllocator.h"
+#include "common/HeapAllocator.h"
+
+spvgentwo::PoolAllocator::PoolAllocator(IAllocator* _pUpstream, const sgt_size_t _slabSize) :
+	m_pUpstream(_pUpstream != nullptr ? _pUpstream : HeapAllocator::instance()),
+	m_slabSize(_slabSize > MaxPooledSize * 2u ? _slabSize : MaxPooledSize * 2u)
+{
+	for (unsigned int i = 0u; i < SizeClassCount; ++i)
+	{
+		m_classes[i].stats.blockSize = (i + 1u) * Granularity;
+	}
+}
+
+spvgentwo::PoolAllocator::~PoolAllocator()
+{
+	release();
+}
+
+void* spvgentwo::PoolAllocator::allocate(const sgt_size_t _bytes, const unsigned int _aligment)
+{
+	if (_bytes == 0u || _bytes > MaxPooledSize)
+	{
+		void* ptr = m_pUpstream->allocate(_bytes, _aligment);
+		if (ptr != nullptr)
+		{
+			m_upstreamBytes += _bytes;
+		}
+		return ptr;
+	}
+
+	SizeClass& sc = m_classes[getSizeClass(_bytes)];
+
+	// slabs are aligned to MaxPooledSize, blocks are aligned to any power of two dividing the block size
+	if (_aligment > 1u && sc.stats.blockSize % _aligment != 0u)
+	{
+		return nullptr;
+	}
+
+	void* ptr = nullptr;
+
+	if (sc.pFree != nullptr)
+	{
+		ptr = sc.pFree;
+		sc.pFree = sc.pFree->pNext;
+	}
+	else
+	{
+		if (static_cast<sgt_size_t>(sc.pEnd - sc.pCur) < sc.stats.blockSize && addSlab(sc) == false)
+		{
+			return nullptr;
+		}
+
+		ptr = sc.pCur;
+		sc.pCur += sc.stats.blockSize;
+	}
+
+	++sc.stats.usedBlocks;
+	--sc.stats.freeBlocks;
+
+	return ptr;
+}
+
+void spvgentwo::PoolAllocator::deallocate(void* _ptr, const sgt_size_t _bytes)
+{
+	if (_ptr == nullptr)
+	{
+		return;
+	}
+
+	if (_bytes == 0u || _bytes > MaxPooledSize)
+	{
+		m_upstreamBytes -= _bytes;
+		m_pUpstream->deallocate(_ptr, _bytes);
+		return;
+	}
+
+	SizeClass& sc = m_classes[getSizeClass(_bytes)];
+
+	FreeBlock* pBlock = static_cast<FreeBlock*>(_ptr);
+	pBlock->pNext = sc.pFree;
+	sc.pFree = pBlock;
+
+	--sc.stats.usedBlocks;
+	++sc.stats.freeBlocks;
+}
+
+bool spvgentwo::PoolAllocator::addSlab(SizeClass& _class)
+{
+	unsigned char* pSlab = static_cast<unsigned char*>(m_pUpstream->allocate(m_slabSize, static_cast<unsigned int>(MaxPooledSize)));
+
+	if (pSlab == nullptr)
+	{
+		return false;
+	}
+
+	// header at the end keeps the blocks aligned to the slab
+	SlabHeader* pHeader = reinterpret_cast<SlabHeader*>(pSlab + m_slabSize - sizeof(SlabHeader));
+	pHeader->pNext = _class.pSlabs;
+	_class.pSlabs = pHeader;
+
+	// remainder of the previous slab is lost
+	const sgt_size_t blocks = (m_slabSize - sizeof(SlabHeader)) / _class.stats.blockSize;
+	_class.stats.freeBlocks -= static_cast<sgt_size_t>(_class.pEnd - _class.pCur) / _class.stats.blockSize;
+	_class.stats.freeBlocks += blocks;
+	++_class.stats.slabs;
+
+	_class.pCur = pSlab;
+	_class.pEnd = pSlab + blocks * _class.stats.blockSize;
+
+	return true;
+}
+
+void spvgentwo::PoolAllocator::release()
+{
+	for (SizeClass& sc : m_classes)
+	{
+		for (SlabHeader* pHeader = sc.pSlabs; pHeader != nullptr;)
+		{
+			SlabHeader* pNext = pHeader->pNext;
+			m_pUpstream->deallocate(reinterpret_cast<unsigned char*>(pHeader + 1) - m_slabSize, m_slabSize);
+			pHeader = pNext;
+		}
+
+		const sgt_size_t blockSize = sc.stats.blockSize;
+		sc = SizeClass{};
+		sc.stats.blockSize = blockSize;
+	}
+}
+
+spvgentwo::PoolAllocator::SizeClassStats spvgentwo::PoolAllocator::getStats(const unsigned int _sizeClass) const
+{
+	return _sizeClass < SizeClassCount ? m_classes[_sizeClass].stats : SizeClassStats{};
+}
+
+spvgentwo::sgt_size_t spvgentwo::PoolAllocator::getReservedBytes() const
+{
+	sgt_size_t bytes = 0u;
+	for (const SizeClass& sc : m_classes)
+	{
+		bytes += sc.stats.slabs * m_slabSize;
+	}
+	return bytes;
+}
+
+spvgentwo::sgt_size_t spvgentwo::PoolAllocator::getUsedBytes() const
+{
+	sgt_size_t bytes = 0u;
+	for (const SizeClass& sc : m_classes)
+	{
+		bytes += sc.stats.usedBlocks * sc.stats.blockSize;
+	}
+	return bytes;
+}
+
+float spvgentwo::PoolAllocator::getFragmentation() const
+{
+	const sgt_size_t reserved = getReservedBytes();
+	return reserved == 0u ? 0.f : 1.f - static_cast<float>(getUsedBytes()) / static_cast<float>(reserved);
+}
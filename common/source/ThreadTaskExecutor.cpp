@@ -0,0 +1,47 @@
+#include "common/ThreadTaskExecutor.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+spvgentwo::ThreadTaskExecutor::ThreadTaskExecutor(unsigned int _threadCount) :
+	m_threadCount(_threadCount != 0u ? _threadCount : std::thread::hardware_concurrency())
+{
+	if (m_threadCount == 0u)
+	{
+		m_threadCount = 1u;
+	}
+}
+
+void spvgentwo::ThreadTaskExecutor::run(Task _task, void* _pUserData, unsigned int _count)
+{
+	// tasks are handed out one by one so that threads finishing early pick up remaining work
+	std::atomic<unsigned int> next{ 0u };
+
+	auto work = [&]()
+	{
+		for (unsigned int i = next++; i < _count; i = next++)
+		{
+			_task(_pUserData, i);
+		}
+	};
+
+	const unsigned int workers = (m_threadCount < _count ? m_threadCount : _count);
+
+	std::vector<std::thread> threads;
+	if (workers > 1u)
+	{
+		threads.reserve(workers - 1u);
+		for (unsigned int i = 1u; i < workers; ++i)
+		{
+			threads.emplace_back(work);
+		}
+	}
+
+	work();
+
+	for (std::thread& t : threads)
+	{
+		t.join();
+	}
+}
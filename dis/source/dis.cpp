@@ -66,26 +66,9 @@ int main(int argc, char* argv[])
 		Module module(&alloc, spv::Version, &logger);
 		Grammar gram(&alloc);
 
-		// parse the binary instructions & operands
-		if (module.read(&reader, gram) == false)
-		{
-			return -1;
-		}
-
-		// turn <id> operands into instruction pointers
-		if (module.resolveIDs() == false)
-		{
-			return -1;
-		}
-
-		// creates type & constant infos for lookup (needed for codegen)
-		if (module.reconstructTypeAndConstantInfo() == false)
-		{
-			return -1;
-		}
-
-		// parses strings for lookup of named instructions, needed for printing
-		if (module.reconstructNames() == false)
+		// parse the binary instructions & operands, turn <id> operands into instruction pointers,
+		// create type & constant infos for lookup (needed for codegen) and parse strings of named instructions (needed for printing)
+		if (module.readAndResolve(&reader, gram) == false)
 		{
 			return -1;
 		}
@@ -1,6 +1,6 @@
 #include "example/ControlFlow.h"
 #include "spvgentwo/Operators.h"
-#include "common/ControlFlowGraph.h"
+#include "common/DominatorTree.h"
 
 using namespace spvgentwo;
 using namespace ops;
@@ -45,6 +45,7 @@ spvgentwo::Module examples::controlFlow(spvgentwo::IAllocator* _pAllocator, spvg
         merge.returnValue(s);
 
         ControlFlowGraph<> cfg(loopFunc);
+        DominatorTree dom(cfg);
     }
 
     // void entryPoint();
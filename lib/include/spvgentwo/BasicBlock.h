@@ -1,5 +1,6 @@
 #pragma once
 #include "Instruction.h"
+#include "HashMap.h"
 
 namespace spvgentwo
 {
@@ -18,6 +19,21 @@ namespace spvgentwo
 		Function* m_pFunction = nullptr; // parent
 		Instruction m_Label;
 
+		struct ValueNumber
+		{
+			Instruction* pInstr = nullptr;
+			unsigned int memoryVersion = 0u; // loads are only equivalent within the same version
+		};
+
+		// hash of opcode, result type and operands -> first pure instruction of this block computing it
+		HashMap<Hash64, ValueNumber> m_ValueNumbers;
+		// numbered instruction -> hash it was numbered with, operands may change afterwards
+		HashMap<const Instruction*, Hash64> m_NumberedValues;
+		unsigned int m_memoryVersion = 0u; // incremented by instructions with (potential) side effects
+
+		// drop the value number of _pInstr before it gets removed
+		void forgetValueNumber(const Instruction* _pInstr);
+
 	public:
 		BasicBlock() = default;
 
@@ -68,6 +84,17 @@ namespace spvgentwo
 		// remove instruction from this block (if it is in this block). OpLabel can't be removed. Returns true if the instruction was removed
 		bool remove(const Instruction* _pInstr);
 
+		// value numbering: returns an instruction of this block equivalent to _pInstr (same opcode, result type and operands) if there is one,
+		// otherwise registers _pInstr and returns it. Only side effect free instructions and loads are numbered, stores, calls, barriers and
+		// other instructions that may write memory invalidate previous loads. _pInstr is neither added to nor removed from this block
+		Instruction* numberValue(Instruction* _pInstr);
+
+		// forget all value numbers, required if instructions of this block were erased without using remove()
+		void clearValueNumbers();
+
+		// move all instructions following _pInstr to the end of _target (keeping their addresses), returns false if _pInstr is not in this block
+		bool moveInstructionsAfter(const Instruction* _pInstr, BasicBlock& _target);
+
 		// structured if, returns last instruction of MergeBlock which creats a result
 		BasicBlock& If(Instruction* _pCondition, BasicBlock& _trueBlock, BasicBlock& _falseBlock, BasicBlock* _pMergeBlock = nullptr, const Flag<spv::SelectionControlMask> _mask = spv::SelectionControlMask::MaskNone);
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Type.h"
+#include "Vector.h"
+#include "SmallVector.h"
 #include "Operand.h" // for appendLiteralsToContainer
 
 namespace spvgentwo
@@ -24,20 +26,22 @@ namespace spvgentwo
 		template <class T>
 		Type& setType();
 
-		const List<unsigned int>& getData() const { return m_literalData; }
-		List<unsigned int>& getData() { return m_literalData; }
+		const SmallVector<unsigned int, 2u>& getData() const { return m_literalData; }
+		SmallVector<unsigned int, 2u>& getData() { return m_literalData; }
 
 		template <class T>
 		void addData(const T& _data);
 
-		const List<Constant>& getComponents() const { return m_Components; }
-		List<Constant>& getComponents() { return m_Components; }
+		const Vector<Constant>& getComponents() const { return m_Components; }
+		Vector<Constant>& getComponents() { return m_Components; }
 
+		// if a constituent could not be allocated, the constant is reset (void type) which Module::addConstant rejects
 		template <class T>
 		Constant& make(const T& _value, const bool _spec = false);
 
-		// adds a new constituent constant
-		Constant& Component();
+		// adds a new constituent constant, nullptr if allocation failed.
+		// components are stored contiguously, the returned pointer is invalidated by the next call unless getComponents() reserved enough space
+		Constant* Component();
 
 		void reset();
 
@@ -45,8 +49,8 @@ namespace spvgentwo
 		spv::Op m_Operation = spv::Op::OpConstantNull;
 		Type m_Type;
 
-		List<Constant> m_Components;
-		List<unsigned int> m_literalData;
+		Vector<Constant> m_Components; // flat array of constituents
+		SmallVector<unsigned int, 2u> m_literalData; // up to 64 bit literals are stored inline
 	};
 
 	template<class T>
@@ -85,27 +89,42 @@ namespace spvgentwo
 		{
 			m_Operation = _spec ? spv::Op::OpSpecConstantComposite : spv::Op::OpConstantComposite;
 			m_Type.make<typename T::const_array_type>();
+			m_Components.reserve(T::Elements);
 			for (unsigned int i = 0u; i < T::Elements; ++i)
 			{
-				Component().make(_value.data[i]);
+				if (Constant* pComponent = Component(); pComponent == nullptr || pComponent->make(_value.data[i]).getType().isVoid())
+				{
+					reset();
+					return *this;
+				}
 			}
 		}
 		else if constexpr (is_const_vector_v<T>)
 		{
 			m_Operation = _spec ? spv::Op::OpSpecConstantComposite : spv::Op::OpConstantComposite;
 			m_Type.make<typename T::const_vector_type>();
+			m_Components.reserve(T::Elements);
 			for (unsigned int i = 0u; i < T::Elements; ++i)
 			{
-				Component().make(_value.data[i]);
+				if (Constant* pComponent = Component(); pComponent == nullptr || pComponent->make(_value.data[i]).getType().isVoid())
+				{
+					reset();
+					return *this;
+				}
 			}
 		}
 		else if constexpr (is_const_matrix_v<T>)
 		{
 			m_Operation = _spec ? spv::Op::OpSpecConstantComposite : spv::Op::OpConstantComposite;
 			m_Type.make<typename T::const_matrix_type>();
+			m_Components.reserve(T::Columns);
 			for (unsigned int i = 0u; i < T::Columns; ++i)
 			{
-				Component().make(_value.data[i]);
+				if (Constant* pComponent = Component(); pComponent == nullptr || pComponent->make(_value.data[i]).getType().isVoid())
+				{
+					reset();
+					return *this;
+				}
 			}
 		}
 		else if constexpr(is_const_sampler_v<T>)
@@ -141,10 +160,7 @@ namespace spvgentwo
 		{
 			_hasher << _const.getOperation();
 			Hasher<Type>()(_const.getType(), _hasher);
-			for (const auto& l : _const.getData())
-			{
-				_hasher << l;
-			}
+			_hasher.add(_const.getData().data(), _const.getData().size() * sizeof(unsigned int));
 
 			for (const Constant& component : _const.getComponents())
 			{
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace spvgentwo
+{
+	// forward decls
+	class Instruction;
+
+	// evaluates scalar or vector int, float and bool arithmetic, bitwise, logical and comparison instructions
+	// whose operands are all OpConstant, OpConstantTrue/False or OpConstantComposite of those.
+	// returns the (deduplicated) module constant holding the result or nullptr if _instr can not be folded
+	Instruction* foldConstant(const Instruction& _instr);
+} // !spvgentwo
@@ -40,7 +40,7 @@ namespace spvgentwo
 		template<class ...Args>
 		Entry* insertAfter(IAllocator* _pAlloc, Args&& ..._args);
 
-		// removes this entry from the list (and destroys it if allocator is provieded), returns next entry
+		// removes this entry from the list (and destroys it if allocator is provieded, otherwise it is unlinked), returns next entry
 		Entry* remove(IAllocator* _pAlloc);
 
 		Entry* first(); // head
@@ -224,6 +224,11 @@ namespace spvgentwo
 		{
 			_pAlloc->destruct(this);
 		}
+		else // unlinked entry can be appended to another list
+		{
+			m_pPrev = nullptr;
+			m_pNext = nullptr;
+		}
 
 		return next;
 	}
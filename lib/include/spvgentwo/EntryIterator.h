@@ -10,6 +10,7 @@ namespace spvgentwo
 	public:
 		EntryIterator(Entry<T>* _pEntry = nullptr) : m_pEntry(_pEntry) {}
 		EntryIterator(const EntryIterator<T>& _other) : m_pEntry(_other.m_pEntry) {}
+		EntryIterator<T>& operator=(const EntryIterator<T>& _other) = default;
 
 		bool operator==(const EntryIterator<T>& _other) const;
 		bool operator!=(const EntryIterator<T>& _other) const;
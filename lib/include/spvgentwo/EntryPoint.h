@@ -28,7 +28,7 @@ namespace spvgentwo
 		// TODO: move constructor & asignment
 
 		// get all the global OpVariables with StorageClass != Function used in this function
-		void getGlobalVariableInterface(List<Operand>& _outVarinstr, const GlobalInterfaceVersion _version) const;
+		void getGlobalVariableInterface(OperandContainer& _outVarinstr, const GlobalInterfaceVersion _version) const;
 
 		spv::ExecutionModel getExecutionModel() const { return m_ExecutionModel; }
 		void setExecutionModel(const spv::ExecutionModel _model) { m_ExecutionModel = _model; }
@@ -50,6 +50,16 @@ namespace spvgentwo
 		// if bool _gatherReferencedInstructions is true, also return uses of instructions from the removed basic block (OpName etc)
 		List<Instruction*> remove(const BasicBlock* _pBB, BasicBlock* _pReplacement = nullptr);
 
+		// value numbering pass: removes side effect free instructions and loads that are equivalent to a previous instruction of the same block
+		// and replaces their uses within this function. Named or decorated instructions are kept. Returns the number of removed instructions
+		unsigned int removeRedundantInstructions();
+
+		// inline OpFunctionCall _pCall of this function: the callees basic blocks are cloned after the block of the call, parameters are replaced
+		// by the arguments and uses of the result by the returned value (OpPhi if the callee returns in several blocks). Instructions following
+		// the call are moved to a new block. Returns false if the call can't be inlined: imported or recursive callee, call inside a loop header
+		// or several returns in a module with structured control flow (Shader capability)
+		bool inlineCall(Instruction* _pCall);
+
 		// return entry bb (avoid confusion when adding a BB to this function and instructions are "magically" added to the last BB if using m_pLast
 		BasicBlock& operator->() { return m_pBegin->inner(); }
 		operator BasicBlock& () { return m_pBegin->inner();}
@@ -58,6 +68,9 @@ namespace spvgentwo
 		// write OpFunction OpFunctionParameters <BasicBlocks> OpFunctionEnd to IWriter
 		void write(IWriter* _pWriter);
 
+		// number of words write() produces
+		sgt_size_t getWordCount() const;
+
 		// read function from IReader user _grammer, assuming OpFunction was already parsed/consumed by module::read(Reader* _pReader)
 		bool read(IReader* _pReader, const Grammar& _grammar, Instruction&& _opFunc);
 
@@ -1,12 +1,11 @@
 // Auto generated - do not modify
 #pragma once
 
-#include "Vector.h"
-#include "HashMap.h"
 #include "Spv.h"
 
 namespace spvgentwo
 {
+class IAllocator;
 class Grammar
 {
 	public:
@@ -87,19 +86,27 @@ class Grammar
 		const char* name;
 		Quantifier quantifier;
 	};
+	template <class T>
+	struct ArrayView
+	{
+		const T* pData;
+		unsigned int count;
+		constexpr const T* begin() const { return pData; }
+		constexpr const T* end() const { return pData + count; }
+		constexpr unsigned int size() const { return count; }
+		constexpr bool empty() const { return count == 0u; }
+	};
 	struct Instruction
 	{
 		const char* name;
-		Vector<Operand> operands;
-		Vector<spv::Capability> capabilities;
-		Vector<spv::Extension> extensions;
+		ArrayView<Operand> operands;
+		ArrayView<spv::Capability> capabilities;
+		ArrayView<spv::Extension> extensions;
 		unsigned int version;
 	};
-		Grammar(IAllocator* _pAllocator);
+		// tables are statically initialized, _pAllocator is not used
+		Grammar(IAllocator* _pAllocator = nullptr) { (void)_pAllocator; }
 		const Instruction* getInfo(unsigned int _opcode, Extension _extension = Extension::Core) const;
 		const char* getOperandName(OperandKind _kind, unsigned int _literalValue) const;
-	private:
-		HashMap<Hash64, Instruction> m_instructions;
-		HashMap<Hash64, const char*> m_operandNames;
 };
 } // spvgentwo
@@ -5,49 +5,79 @@
 namespace spvgentwo
 {
 	template <class Key, class Value>
-	// with chaining => multimap
+	// open addressing with robin hood probing, keys with the same hash are kept => multimap
 	class HashMap
 	{
 	public:
-		static constexpr auto DefaultBucktCount = 64u;
+		// smallest number of slots allocated on first insertion
+		static constexpr unsigned int MinCapacity = 16u;
+		// slot array grows (rehash) when more than MaxLoadPercent of the slots are in use
+		static constexpr unsigned int MaxLoadPercent = 80u;
 
 		using Node = NodeT<Key, Value>;
-		using Bucket = List<Node>;
+		using Slot = HashMapSlot<Key, Value>;
 
 		using Iterator = HashMapIterator<Key, Value>;
 		using ValueType = Node;
 		using ReferenceType = Node&;
 		using PointerType = Node*;
 
-		struct Range
+		// all nodes matching a hash
+		class Range
 		{
-			typename Bucket::Iterator m_Begin;
-			typename Bucket::Iterator m_End;
+		public:
+			class Iterator
+			{
+			public:
+				Iterator(const HashMap* _pMap = nullptr, Hash64 _hash = 0u, unsigned int _index = 0u, unsigned int _distance = 0u) :
+					m_pMap(_pMap), m_hash(_hash), m_index(_index), m_distance(_distance) {}
+
+				bool operator==(const Iterator& _other) const { return m_pMap == _other.m_pMap && m_index == _other.m_index; }
+				bool operator!=(const Iterator& _other) const { return !operator==(_other); }
+
+				Iterator& operator++();
+
+				Node& operator*() const { return *m_pMap->m_pSlots[m_index].pNode; }
+				Node* operator->() const { return m_pMap->m_pSlots[m_index].pNode; }
+
+			private:
+				const HashMap* m_pMap = nullptr; // nullptr => end
+				Hash64 m_hash = 0u;
+				unsigned int m_index = 0u;
+				unsigned int m_distance = 0u;
+			};
+
+			Range(const HashMap* _pMap, Hash64 _hash);
 
-			typename Bucket::Iterator begin() const { return m_Begin; }
-			typename Bucket::Iterator end() const { return m_End; }
+			Iterator begin() const { return m_Begin; }
+			Iterator end() const { return Iterator(); }
+
+		private:
+			Iterator m_Begin;
 		};
 
 	public:
 
-		HashMap(IAllocator* _pAllocator = nullptr, const unsigned int _buckets = DefaultBucktCount);
+		// _reserve: number of elements that can be inserted without rehashing
+		HashMap(IAllocator* _pAllocator = nullptr, const unsigned int _reserve = 0u);
 		HashMap(HashMap&& _other) noexcept;
 
 		~HashMap();
 
 		HashMap& operator=(HashMap&& _other) noexcept;
 
+		// insertion functions return nullptr if allocation failed
 		template <class ... Args>
-		Node& emplace(Args&& ... _args);
+		Node* emplace(Args&& ... _args);
 
 		// returns existing node if duplicate
 		template <class ... Args>
-		Node& emplaceUnique(Args&& ... _args);
+		Node* emplaceUnique(Args&& ... _args);
 
 		template <class ... Args>
-		Node& emplaceUnique(const Key& _key, Args&& ... _args);
+		Node* emplaceUnique(const Key& _key, Args&& ... _args);
 
-		Node& newNodeUnique(const Hash64& _hash);
+		Node* newNodeUnique(const Hash64& _hash);
 
 		Value* get(const Hash64 _hash) const;
 
@@ -55,7 +85,7 @@ namespace spvgentwo
 		template <class T = Key, typename = stdrep::enable_if_t<stdrep::is_same_v<T, Key> && !stdrep::is_same_v<T, Hash64>>>
 		Value* get(const T& _key) const { return get(hash(_key)); }
 
-		Range getRange(const Hash64 _hash) const;
+		Range getRange(const Hash64 _hash) const { return Range(this, _hash); }
 
 		// only enable overload of Key type differs from Hash64
 		template <class T = Key, typename = stdrep::enable_if_t<stdrep::is_same_v<T, Key> && !stdrep::is_same_v<T, Hash64>>>
@@ -71,80 +101,107 @@ namespace spvgentwo
 		// remove all elements with Key _key
 		unsigned int eraseRange(const Key& _key);
 
+		// remove the node with hash _hash whose value is stored at _pValue, returns false if there is none
+		bool erase(const Hash64 _hash, const Value* _pValue);
+
 		unsigned int count(const Hash64 _hash) const;
-		unsigned int count(const Key& _key) const { return count(hash(_key)); }
+		unsigned int count(const Key& _key) const { return count(hashKey(_key)); }
+
+		// grow slot array so that _elements can be stored without exceeding MaxLoadPercent, returns false if allocation failed
+		bool reserve(const unsigned int _elements);
 
-		const Bucket& getBucket(const unsigned int _index) const { return m_pBuckets[_index]; }
-		unsigned int getBucketCount() const { return m_Buckets; }
+		unsigned int capacity() const { return m_Capacity; }
 
 		Iterator begin() const;
-		Iterator end() const { return Iterator(m_pBuckets + m_Buckets, m_pBuckets + m_Buckets, nullptr); }
+		Iterator end() const { return Iterator(m_pSlots + m_Capacity, m_pSlots + m_Capacity); }
 
 		void clear();
 
 		unsigned int elements() const { return m_Elements; }
 
 	private:
+		static Hash64 hashKey(const Key& _key);
+
+		// fibonacci hashing, uses the upper bits of the product so that hashes differing only in the high word still spread
+		unsigned int home(const Hash64 _hash) const { return static_cast<unsigned int>((static_cast<Hash64::u64>(_hash) * 11400714819323198485ull) >> m_Shift); }
+		unsigned int distance(const unsigned int _index, const Hash64 _hash) const { return (_index - home(_hash)) & (m_Capacity - 1u); }
+
+		// continue probing at _index / _distance for the next slot matching _hash, returns false if there is none
+		bool probe(const Hash64 _hash, unsigned int& _index, unsigned int& _distance) const;
+
+		// robin hood insertion, slot array must have a free slot
+		void insertSlot(Slot _slot);
+
+		// destruct node and backward shift the following slots, returns the index of the slot left empty
+		unsigned int eraseSlot(unsigned int _index);
+
+		bool rehash(const unsigned int _capacity);
+
+		// destructs _pNode and returns nullptr if it can't be stored
+		Node* insertNode(Node* _pNode, const Hash64 _hash);
+
 		void destroy();
 
 	private:
 		IAllocator* m_pAllocator = nullptr;
-		Bucket* m_pBuckets = nullptr;
-		unsigned int m_Buckets = 0u;
+		Slot* m_pSlots = nullptr;
+		unsigned int m_Capacity = 0u; // power of two
+		unsigned int m_Shift = 64u;
 		unsigned int m_Elements = 0u;
 	};
 
 	template<class Key, class Value>
-	inline HashMap<Key, Value>::HashMap(IAllocator* _pAllocator, const unsigned int _buckets) :
-		m_pAllocator(_pAllocator), m_Buckets(_buckets)
+	inline HashMap<Key, Value>::HashMap(IAllocator* _pAllocator, const unsigned int _reserve) :
+		m_pAllocator(_pAllocator)
 	{
-		m_pBuckets = reinterpret_cast<Bucket*>(m_pAllocator->allocate(m_Buckets * sizeof(Bucket)));
-		for (auto i = 0u; i < m_Buckets; ++i)
+		if (_reserve != 0u)
 		{
-			new(m_pBuckets + i) Bucket(m_pAllocator);
+			reserve(_reserve);
 		}
 	}
 
 	template<class Key, class Value>
 	inline HashMap<Key, Value>::HashMap(HashMap&& _other) noexcept :
 		m_pAllocator(_other.m_pAllocator),
-		m_pBuckets(_other.m_pBuckets),
-		m_Buckets(_other.m_Buckets),
+		m_pSlots(_other.m_pSlots),
+		m_Capacity(_other.m_Capacity),
+		m_Shift(_other.m_Shift),
 		m_Elements(_other.m_Elements)
 	{
 		_other.m_pAllocator = nullptr;
-		_other.m_pBuckets = 0u;
-		_other.m_Buckets = 0u;
+		_other.m_pSlots = nullptr;
+		_other.m_Capacity = 0u;
+		_other.m_Shift = 64u;
 		_other.m_Elements = 0u;
 	}
 
 	template<class Key, class Value>
 	inline void HashMap<Key, Value>::destroy()
 	{
-		if (m_pBuckets != nullptr && m_pAllocator != nullptr)
+		if (m_pSlots != nullptr && m_pAllocator != nullptr)
 		{
-			for (auto i = 0u; i < m_Buckets; ++i)
-			{
-				m_pBuckets[i].~List();
-			}
-			m_pAllocator->deallocate(m_pBuckets, m_Buckets * sizeof(Bucket));
-			m_pBuckets = nullptr;
+			clear();
+			m_pAllocator->deallocate(m_pSlots, m_Capacity * sizeof(Slot));
+			m_pSlots = nullptr;
 			m_pAllocator = nullptr;
-			m_Elements = 0u;
+			m_Capacity = 0u;
+			m_Shift = 64u;
 		}
 	}
 
 	template<class Key, class Value>
 	inline void HashMap<Key, Value>::clear()
 	{
-		if (m_pBuckets != nullptr)
+		// stop once all elements are gone, clearing an empty map is O(1) regardless of its capacity
+		for (unsigned int i = 0u; i < m_Capacity && m_Elements != 0u; ++i)
 		{
-			for (auto i = 0u; i < m_Buckets; ++i)
+			if (m_pSlots[i].pNode != nullptr)
 			{
-				m_pBuckets[i].clear();
+				m_pAllocator->destruct(m_pSlots[i].pNode);
+				m_pSlots[i] = Slot{};
+				--m_Elements;
 			}
 		}
-		m_Elements = 0u;
 	}
 
 	template<class Key, class Value>
@@ -156,303 +213,418 @@ namespace spvgentwo
 	template<class Key, class Value>
 	inline HashMap<Key, Value>& HashMap<Key, Value>::operator=(HashMap&& _other) noexcept
 	{
-		if (this != &_other) return *this;
+		if (this == &_other) return *this;
 
 		// free left side
 		destroy();
 
-		m_Buckets = _other.m_Buckets;
 		m_pAllocator = _other.m_pAllocator;
-		m_pBuckets = _other.m_pBuckets;
+		m_pSlots = _other.m_pSlots;
+		m_Capacity = _other.m_Capacity;
+		m_Shift = _other.m_Shift;
 		m_Elements = _other.m_Elements;
 
-		_other.m_Buckets = 0u;
 		_other.m_pAllocator = nullptr;
-		_other.m_pBuckets = nullptr;
+		_other.m_pSlots = nullptr;
+		_other.m_Capacity = 0u;
+		_other.m_Shift = 64u;
 		_other.m_Elements = 0u;
 
 		return *this;
 	}
 
 	template<class Key, class Value>
-	inline Value* HashMap<Key, Value>::get(const Hash64 _hash) const
+	inline Hash64 HashMap<Key, Value>::hashKey(const Key& _key)
 	{
-		const auto index = _hash % m_Buckets;
+		if constexpr (stdrep::is_same_v<Key, Hash64>)
+		{
+			return _key;
+		}
+		else
+		{
+			return hash(_key);
+		}
+	}
 
-		for (Node& n : m_pBuckets[index])
+	template<class Key, class Value>
+	inline bool HashMap<Key, Value>::probe(const Hash64 _hash, unsigned int& _index, unsigned int& _distance) const
+	{
+		if (m_Elements == 0u)
 		{
-			if (n.hash == _hash)
-				return &n.kv.value;
+			return false;
 		}
 
-		return nullptr;
+		// terminates because the load factor guarantees a free slot
+		for (;; _index = (_index + 1u) & (m_Capacity - 1u), ++_distance)
+		{
+			const Slot& slot = m_pSlots[_index];
+
+			// robin hood invariant: _hash would have been placed before a slot that is closer to its home
+			if (slot.pNode == nullptr || distance(_index, slot.hash) < _distance)
+			{
+				return false;
+			}
+
+			if (slot.hash == _hash)
+			{
+				return true;
+			}
+		}
 	}
 
 	template<class Key, class Value>
-	inline typename HashMap<Key, Value>::Range HashMap<Key, Value>::getRange(const Hash64 _hash) const
+	inline void HashMap<Key, Value>::insertSlot(Slot _slot)
 	{
-		const auto index = _hash % m_Buckets;
-		const Bucket& bucket = m_pBuckets[index];
-
-		auto first = bucket.end();
-		auto last = first;
+		unsigned int index = home(_slot.hash);
+		unsigned int dist = 0u;
 
-		for (auto it = bucket.begin(); it != bucket.end(); ++it)
+		for (;; index = (index + 1u) & (m_Capacity - 1u), ++dist)
 		{
-			const Node& n = *it;
-			if (n.hash == _hash)
+			Slot& slot = m_pSlots[index];
+
+			if (slot.pNode == nullptr)
 			{
-				if (first == bucket.end())
-				{
-					first = it;
-				}
-				last = it + 1u;
+				slot = _slot;
+				return;
 			}
-			
-		}
 
-		return { first , last};
+			// take the slot from the richer element and continue inserting the displaced one
+			if (const unsigned int existing = distance(index, slot.hash); existing < dist)
+			{
+				Slot displaced = slot;
+				slot = _slot;
+				_slot = displaced;
+				dist = existing;
+			}
+		}
 	}
 
 	template<class Key, class Value>
-	inline typename HashMap<Key, Value>::Iterator HashMap<Key, Value>::erase(Iterator pos)
+	inline unsigned int HashMap<Key, Value>::eraseSlot(unsigned int _index)
 	{
-		if(pos && pos != end())
+		m_pAllocator->destruct(m_pSlots[_index].pNode);
+
+		for (unsigned int next = (_index + 1u) & (m_Capacity - 1u);
+			m_pSlots[next].pNode != nullptr && distance(next, m_pSlots[next].hash) != 0u;
+			_index = next, next = (next + 1u) & (m_Capacity - 1u))
 		{
-			pos.m_pBucket->erase(pos.m_element);
-			return ++pos;
+			m_pSlots[_index] = m_pSlots[next];
 		}
-		return end();
+
+		m_pSlots[_index] = Slot{};
+		--m_Elements;
+
+		return _index;
 	}
 
 	template<class Key, class Value>
-	inline unsigned int HashMap<Key, Value>::eraseRange(const Key& _key)
+	inline bool HashMap<Key, Value>::rehash(const unsigned int _capacity)
 	{
-		Hash64 h = 0u;
+		if (m_pAllocator == nullptr)
+		{
+			return false;
+		}
 
-		if constexpr (stdrep::is_same_v<Key, Hash64>)
+		Slot* pNewSlots = reinterpret_cast<Slot*>(m_pAllocator->allocate(_capacity * sizeof(Slot), alignof(Slot)));
+
+		if (pNewSlots == nullptr)
 		{
-			h = _key;
+			return false;
 		}
-		else
+
+		for (unsigned int i = 0u; i < _capacity; ++i)
 		{
-			h = hash(_key);
+			new(pNewSlots + i) Slot{};
 		}
 
-		unsigned int keys = 0u;
-		const auto index = h % m_Buckets;
+		Slot* pOldSlots = m_pSlots;
+		const unsigned int oldCapacity = m_Capacity;
 
-		Bucket& bucket = m_pBuckets[index];
+		m_pSlots = pNewSlots;
+		m_Capacity = _capacity;
+		m_Shift = 64u;
+		for (unsigned int c = _capacity; c > 1u; c >>= 1u)
+		{
+			--m_Shift;
+		}
 
-		for (auto it = bucket.begin(), e = bucket.end(); it != e;)
+		// nodes are not moved, only their slots
+		for (unsigned int i = 0u; i < oldCapacity; ++i)
 		{
-			if (it->hash == h)
+			if (pOldSlots[i].pNode != nullptr)
 			{
-				it = bucket.erase(it);
-				++keys;
-			}
-			else 
-			{
-				++it;
+				insertSlot(pOldSlots[i]);
 			}
 		}
 
-		return keys;
+		if (pOldSlots != nullptr)
+		{
+			m_pAllocator->deallocate(pOldSlots, oldCapacity * sizeof(Slot));
+		}
+
+		return true;
 	}
 
 	template<class Key, class Value>
-	inline unsigned int HashMap<Key, Value>::count(const Hash64 _hash) const
+	inline bool HashMap<Key, Value>::reserve(const unsigned int _elements)
 	{
-		unsigned int keys = 0u;
-		const auto index = _hash % m_Buckets;
+		unsigned int capacity = m_Capacity < MinCapacity ? MinCapacity : m_Capacity;
 
-		for (const Node& n : m_pBuckets[index])
+		while (static_cast<Hash64::u64>(_elements) * 100u > static_cast<Hash64::u64>(capacity) * MaxLoadPercent)
 		{
-			if (n.hash == _hash)
-			{
-				++keys;
-			}
+			capacity <<= 1u;
 		}
 
-		return keys;
+		return capacity == m_Capacity || rehash(capacity);
 	}
 
 	template<class Key, class Value>
-	inline typename HashMap<Key, Value>::Iterator HashMap<Key, Value>::find(const Key& _key) const
+	inline typename HashMap<Key, Value>::Node* HashMap<Key, Value>::insertNode(Node* _pNode, const Hash64 _hash)
 	{
-		Hash64 h = 0u;
+		if (_pNode == nullptr)
+		{
+			return nullptr;
+		}
 
-		if constexpr (stdrep::is_same_v<Key, Hash64>)
+		// exceeding the load factor is fine as long as a free slot is left to terminate probing
+		if (reserve(m_Elements + 1u) == false && m_Elements + 1u >= m_Capacity)
 		{
-			h = _key;
+			m_pAllocator->destruct(_pNode);
+			return nullptr;
 		}
-		else
+
+		insertSlot(Slot{ _hash, _pNode });
+
+		++m_Elements;
+
+		return _pNode;
+	}
+
+	template<class Key, class Value>
+	inline Value* HashMap<Key, Value>::get(const Hash64 _hash) const
+	{
+		unsigned int index = m_Elements != 0u ? home(_hash) : 0u, dist = 0u;
+
+		if (probe(_hash, index, dist))
 		{
-			h = hash(_key);
+			return &m_pSlots[index].pNode->kv.value;
 		}
 
-		const auto index = h % m_Buckets;
+		return nullptr;
+	}
 
-		const Bucket& bucket = m_pBuckets[index];
+	template<class Key, class Value>
+	inline HashMap<Key, Value>::Range::Range(const HashMap* _pMap, Hash64 _hash)
+	{
+		unsigned int index = _pMap->m_Elements != 0u ? _pMap->home(_hash) : 0u, dist = 0u;
 
-		for (auto it = bucket.begin(), e = bucket.end(); it != e; ++it)
+		if (_pMap->probe(_hash, index, dist))
 		{
-			if (it->hash == h)
+			m_Begin = Iterator(_pMap, _hash, index, dist);
+		}
+	}
+
+	template<class Key, class Value>
+	inline typename HashMap<Key, Value>::Range::Iterator& HashMap<Key, Value>::Range::Iterator::operator++()
+	{
+		if (m_pMap != nullptr)
+		{
+			m_index = (m_index + 1u) & (m_pMap->m_Capacity - 1u);
+			++m_distance;
+
+			if (m_pMap->probe(m_hash, m_index, m_distance) == false)
 			{
-				return Iterator(m_pBuckets + index, m_pBuckets + m_Buckets, it);
+				*this = Iterator();
 			}
 		}
 
-		return end();
+		return *this;
 	}
 
 	template<class Key, class Value>
-	inline Key* HashMap<Key, Value>::findKey(const Value& _value) const
+	inline typename HashMap<Key, Value>::Iterator HashMap<Key, Value>::erase(Iterator pos)
 	{
-		for (auto i = 0u; i < m_Buckets; ++i)
+		if (pos != nullptr)
 		{
-			for (Bucket& b : m_pBuckets[i])
+			const unsigned int index = static_cast<unsigned int>(pos.m_pSlot - m_pSlots);
+
+			// slots from pos.m_pLast to the back only hold elements that were visited before they wrapped around.
+			// if the backward shift moved one of them, or wrapped the (visited) first slot to the back, that range grows by one
+			if (const unsigned int hole = eraseSlot(index); hole < index || m_pSlots + hole >= pos.m_pLast)
 			{
-				for (Node& n : b)
-				{
-					if (n.kv.value == _value)
-					{
-						return &n.kv.key;
-					}
-				}
+				--pos.m_pLast;
 			}
-		}
 
-		return nullptr;
+			// slot at index was either cleared or refilled by its successor
+			if (pos.m_pSlot == pos.m_pLast)
+			{
+				return end();
+			}
+
+			if (m_pSlots[index].pNode == nullptr)
+			{
+				++pos;
+			}
+
+			return pos;
+		}
+		return end();
 	}
 
 	template<class Key, class Value>
-	template<class ...Args>
-	inline typename HashMap<Key, Value>::Node& HashMap<Key, Value>::emplace(Args&& ..._args)
+	inline unsigned int HashMap<Key, Value>::eraseRange(const Key& _key)
 	{
-		Entry<Node>* pNode = Entry<Node>::create(m_pAllocator, stdrep::forward<Args>(_args)...);
+		const Hash64 h = hashKey(_key);
 
-		Node& n = pNode->inner();
+		unsigned int keys = 0u;
 
-		if constexpr (stdrep::is_same_v<Key, Hash64>)
+		for (unsigned int index = m_Elements != 0u ? home(h) : 0u, dist = 0u; probe(h, index, dist); ++keys)
 		{
-			n.hash = n.kv.key;
+			// following slots have been shifted back by one
+			eraseSlot(index);
+			index = home(h);
+			dist = 0u;
 		}
-		else
+
+		return keys;
+	}
+
+	template<class Key, class Value>
+	inline bool HashMap<Key, Value>::erase(const Hash64 _hash, const Value* _pValue)
+	{
+		for (unsigned int index = m_Elements != 0u ? home(_hash) : 0u, dist = 0u; probe(_hash, index, dist); index = (index + 1u) & (m_Capacity - 1u), ++dist)
 		{
-			n.hash = hash(n.kv.key);
+			if (&m_pSlots[index].pNode->kv.value == _pValue)
+			{
+				eraseSlot(index);
+				return true;
+			}
 		}
 
-		const auto index = n.hash % m_Buckets;
+		return false;
+	}
 
-		// append to chain
-		m_pBuckets[index].append_entry(pNode);
+	template<class Key, class Value>
+	inline unsigned int HashMap<Key, Value>::count(const Hash64 _hash) const
+	{
+		unsigned int keys = 0u;
 
-		++m_Elements;
+		const Range range = getRange(_hash);
+		for (auto it = range.begin(); it != range.end(); ++it)
+		{
+			++keys;
+		}
 
-		return n;
+		return keys;
 	}
 
 	template<class Key, class Value>
-	template<class ...Args> // (non trivial) key is constructed from args and then used to compute the hash
-	inline typename HashMap<Key, Value>::Node& HashMap<Key, Value>::emplaceUnique(Args&& ..._args)
+	inline typename HashMap<Key, Value>::Iterator HashMap<Key, Value>::find(const Key& _key) const
 	{
-		Entry<Node>* pNode = Entry<Node>::create(m_pAllocator, stdrep::forward<Args>(_args)...);
+		const Hash64 h = hashKey(_key);
 
-		Node& n = pNode->inner();
+		unsigned int index = m_Elements != 0u ? home(h) : 0u, dist = 0u;
 
-		if constexpr (stdrep::is_same_v<Key, Hash64>)
+		if (probe(h, index, dist))
 		{
-			n.hash = n.kv.key;
-		}
-		else
-		{
-			n.hash = hash(n.kv.key);
+			return Iterator(m_pSlots + index, m_pSlots + m_Capacity);
 		}
 
-		const auto index = n.hash % m_Buckets;
+		return end();
+	}
 
-		for (Node& existing : m_pBuckets[index])
+	template<class Key, class Value>
+	inline Key* HashMap<Key, Value>::findKey(const Value& _value) const
+	{
+		for (unsigned int i = 0u; i < m_Capacity; ++i)
 		{
-			if (existing.hash == n.hash)
+			if (Node* pNode = m_pSlots[i].pNode; pNode != nullptr && pNode->kv.value == _value)
 			{
-				m_pAllocator->destruct(pNode);
-				return existing;
+				return &pNode->kv.key;
 			}
 		}
 
-		m_pBuckets[index].append_entry(pNode);
-
-		++m_Elements;
-
-		return n;
+		return nullptr;
 	}
 
 	template<class Key, class Value>
 	template<class ...Args>
-	inline typename HashMap<Key, Value>::Node& HashMap<Key, Value>::emplaceUnique(const Key& _key, Args&& ..._args)
+	inline typename HashMap<Key, Value>::Node* HashMap<Key, Value>::emplace(Args&& ..._args)
 	{
-		Hash64 h = 0u;
+		Node* pNode = m_pAllocator->construct<Node>(stdrep::forward<Args>(_args)...);
 
-		if constexpr (stdrep::is_same_v<Key, Hash64>)
+		if (pNode == nullptr)
 		{
-			h = _key;
-		}
-		else
-		{
-			h = hash(_key);
+			return nullptr;
 		}
 
-		const auto index = h % m_Buckets;
+		return insertNode(pNode, hashKey(pNode->kv.key));
+	}
 
-		for (Node& existing : m_pBuckets[index])
+	template<class Key, class Value>
+	template<class ...Args> // (non trivial) key is constructed from args and then used to compute the hash
+	inline typename HashMap<Key, Value>::Node* HashMap<Key, Value>::emplaceUnique(Args&& ..._args)
+	{
+		Node* pNode = m_pAllocator->construct<Node>(stdrep::forward<Args>(_args)...);
+
+		if (pNode == nullptr)
 		{
-			if (existing.hash == h)
-			{
-				return existing;
-			}
+			return nullptr;
 		}
 
-		Node& n = m_pBuckets[index].emplace_back(_key, stdrep::forward<Args>(_args)...);
-		n.hash = h;
+		const Hash64 h = hashKey(pNode->kv.key);
 
-		++m_Elements;
+		unsigned int index = m_Elements != 0u ? home(h) : 0u, dist = 0u;
 
-		return n;
+		if (probe(h, index, dist))
+		{
+			m_pAllocator->destruct(pNode);
+			return m_pSlots[index].pNode;
+		}
+
+		return insertNode(pNode, h);
 	}
 
 	template<class Key, class Value>
-	inline typename HashMap<Key, Value>::Node& HashMap<Key, Value>::newNodeUnique(const Hash64& _hash)
+	template<class ...Args>
+	inline typename HashMap<Key, Value>::Node* HashMap<Key, Value>::emplaceUnique(const Key& _key, Args&& ..._args)
 	{
-		const auto index = _hash % m_Buckets;
+		const Hash64 h = hashKey(_key);
 
-		for (Node& existing : m_pBuckets[index])
+		unsigned int index = m_Elements != 0u ? home(h) : 0u, dist = 0u;
+
+		if (probe(h, index, dist))
 		{
-			if (existing.hash == _hash)
-			{
-				return existing;
-			}
+			return m_pSlots[index].pNode;
 		}
 
-		Node& n = m_pBuckets[index].emplace_back();
-		n.hash = _hash;
+		return insertNode(m_pAllocator->construct<Node>(_key, stdrep::forward<Args>(_args)...), h);
+	}
 
-		++m_Elements;
+	template<class Key, class Value>
+	inline typename HashMap<Key, Value>::Node* HashMap<Key, Value>::newNodeUnique(const Hash64& _hash)
+	{
+		unsigned int index = m_Elements != 0u ? home(_hash) : 0u, dist = 0u;
+
+		if (probe(_hash, index, dist))
+		{
+			return m_pSlots[index].pNode;
+		}
 
-		return n;
+		return insertNode(m_pAllocator->construct<Node>(), _hash);
 	}
 
 	template<class Key, class Value>
 	inline typename HashMap<Key, Value>::Iterator HashMap<Key, Value>::begin() const
 	{
-		for (unsigned int i = 0u; i < m_Buckets; ++i)
+		for (unsigned int i = 0u; i < m_Capacity; ++i)
 		{
-			if (m_pBuckets[i].empty() == false)
+			if (m_pSlots[i].pNode != nullptr)
 			{
-				return Iterator(m_pBuckets + i, m_pBuckets + m_Buckets, m_pBuckets[i].begin());
+				return Iterator(m_pSlots + i, m_pSlots + m_Capacity);
 			}
 		}
 
 		return end();
 	}
-} // !spvgentwo
\ No newline at end of file
+} // !spvgentwo
@@ -8,20 +8,22 @@ namespace spvgentwo
 	template <class Key, class Value>
 	struct NodeT
 	{
-		template <class K, class V>
-		friend class HashMap;
-
 		template <class ...Args>
-		NodeT(Args&& ... _args) : kv{ stdrep::forward<Args>(_args)... }, hash{ 0u }{}
+		NodeT(Args&& ... _args) : kv{ stdrep::forward<Args>(_args)... } {}
 
 		struct KV
 		{
 			Key key;
 			Value value;
 		} kv;
+	};
 
-	private:
-		Hash64 hash;
+	// open addressing slot, nodes are allocated separately so that their address stays stable on rehash
+	template <class Key, class Value>
+	struct HashMapSlot
+	{
+		Hash64 hash = 0u;
+		NodeT<Key, Value>* pNode = nullptr;
 	};
 
 	template <class Key, class Value>
@@ -33,16 +35,18 @@ namespace spvgentwo
 	public:
 		using Node = NodeT<Key, Value>;
 		using KeyValue = typename Node::KV;
-		using Bucket = List<Node>;
+		using Slot = HashMapSlot<Key, Value>;
 
-		HashMapIterator(Bucket* _pBucket = nullptr, Bucket* _pEnd = nullptr, typename Bucket::Iterator _element = nullptr) : m_element(_element), m_pBucket(_pBucket), m_pEnd(_pEnd){}
-		HashMapIterator(const HashMapIterator& _other) : m_element(_other.m_element), m_pBucket(_other.m_pBucket), m_pEnd(_other.m_pEnd) {}
+		HashMapIterator(Slot* _pSlot = nullptr, Slot* _pEnd = nullptr) : m_pSlot(_pSlot), m_pEnd(_pEnd), m_pLast(_pEnd) {}
+		HashMapIterator(const HashMapIterator& _other) : m_pSlot(_other.m_pSlot), m_pEnd(_other.m_pEnd), m_pLast(_other.m_pLast) {}
 
-		bool operator==(const HashMapIterator& _other) const;
-		bool operator!=(const HashMapIterator& _other) const;
+		HashMapIterator& operator=(const HashMapIterator& _other) { m_pSlot = _other.m_pSlot; m_pEnd = _other.m_pEnd; m_pLast = _other.m_pLast; return *this; }
 
-		bool operator==(sgt_nullptr_t) const;
-		bool operator!=(sgt_nullptr_t) const;
+		bool operator==(const HashMapIterator& _other) const { return m_pSlot == _other.m_pSlot && m_pEnd == _other.m_pEnd; }
+		bool operator!=(const HashMapIterator& _other) const { return m_pSlot != _other.m_pSlot || m_pEnd != _other.m_pEnd; }
+
+		bool operator==(sgt_nullptr_t) const { return m_pSlot == nullptr || m_pSlot == m_pEnd; }
+		bool operator!=(sgt_nullptr_t) const { return m_pSlot != nullptr && m_pSlot != m_pEnd; }
 
 		// pre
 		HashMapIterator<Key, Value>& operator++();
@@ -50,57 +54,32 @@ namespace spvgentwo
 		// post
 		HashMapIterator<Key, Value> operator++(int);
 
-		KeyValue& operator*() { return m_element->kv; }
-		const KeyValue& operator*() const { return m_element->kv; }
+		KeyValue& operator*() { return m_pSlot->pNode->kv; }
+		const KeyValue& operator*() const { return m_pSlot->pNode->kv; }
 
-		KeyValue* operator->() { return &m_element->kv; }
-		const KeyValue* operator->() const { return &m_element->kv; }
+		KeyValue* operator->() { return &m_pSlot->pNode->kv; }
+		const KeyValue* operator->() const { return &m_pSlot->pNode->kv; }
 
 		// check if iterator is valid, can be derefed. Might still be at end!
-		operator bool() const { return m_pBucket != nullptr || m_element == nullptr; }
+		operator bool() const { return m_pSlot != nullptr; }
 
 	private:
-		typename Bucket::Iterator m_element = nullptr;
-		Bucket* m_pBucket = nullptr;
-		Bucket* m_pEnd = nullptr;
+		Slot* m_pSlot = nullptr;
+		Slot* m_pEnd = nullptr;
+		Slot* m_pLast = nullptr; // iteration stops here, HashMap::erase lowers it when visited elements wrap around to the back
 	};
 
-	template<class Key, class Value>
-	inline bool HashMapIterator<Key, Value>::operator==(const HashMapIterator& _other) const
-	{
-		return m_pBucket == _other.m_pBucket && m_pEnd == _other.m_pEnd && m_element == _other.m_element;;
-	}
-
-	template<class Key, class Value>
-	inline bool HashMapIterator<Key, Value>::operator!=(const HashMapIterator& _other) const
-	{
-		return m_pBucket != _other.m_pBucket || m_pEnd != _other.m_pEnd || m_element != _other.m_element;;
-	}
-
-	template<class Key, class Value>
-	inline bool HashMapIterator<Key, Value>::operator==(sgt_nullptr_t) const
-	{
-		return m_pBucket == nullptr || m_element == nullptr;
-	}
-
-	template<class Key, class Value>
-	inline bool HashMapIterator<Key, Value>::operator!=(sgt_nullptr_t) const
-	{
-		return m_pBucket != nullptr && m_element != nullptr;
-	}
-
 	template<class Key, class Value>
 	inline HashMapIterator<Key, Value>& HashMapIterator<Key, Value>::operator++()
 	{
-		if (++m_element == nullptr)
+		if (m_pSlot != nullptr && m_pSlot != m_pEnd)
 		{
-			while (++m_pBucket < m_pEnd)
+			// skip empty slots
+			while (++m_pSlot != m_pLast && m_pSlot->pNode == nullptr) {}
+
+			if (m_pSlot == m_pLast)
 			{
-				if (m_pBucket->empty() == false)
-				{
-					m_element = m_pBucket->begin();
-					break;
-				}
+				m_pSlot = m_pEnd;
 			}
 		}
 
@@ -114,4 +93,4 @@ namespace spvgentwo
 		this->operator++();
 		return ret;
 	}
-} // !spvgentwo
\ No newline at end of file
+} // !spvgentwo
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "List.h"
+#include "SmallVector.h"
 #include "Operand.h"
 #include "Flag.h"
 
@@ -14,7 +15,10 @@ namespace spvgentwo
 	class Grammar;
 	class String;
 
-	class Instruction : public List<Operand>
+	// most instructions have less than 8 operands, those are stored inline without allocation
+	using OperandContainer = SmallVector<Operand, 8u>;
+
+	class Instruction : public OperandContainer
 	{
 		friend class Module;
 		friend class BasicBlock;
@@ -42,7 +46,7 @@ namespace spvgentwo
 		using DualOpMemberFun = Instruction* (Instruction::*)(Instruction*, Instruction*);
 
 	public:
-		using Iterator = EntryIterator<Operand>;
+		using Iterator = OperandContainer::Iterator;
 
 		Instruction() = default;
 
@@ -83,8 +87,9 @@ namespace spvgentwo
 		// manual instruction construction:
 		void setOperation(const spv::Op _op) { m_Operation = _op; };
 		spv::Op getOperation() const { return m_Operation; }
+		// registers instruction and branch target operands with the modules def-use index if enabled, returns nullptr if the operand storage could not grow
 		template<class ...Args>
-		Operand& addOperand(Args&& ... _operand) { return emplace_back(stdrep::forward<Args>(_operand)...); }
+		Operand* addOperand(Args&& ... _operand);
 
 		// operand helper
 		spv::Id getResultId() const;
@@ -702,6 +707,21 @@ namespace spvgentwo
 		[[nodiscard]] Instruction* error() const;
 
 	private:
+		// forward _operand to Module::addUse if use tracking is enabled
+		void trackUse(const Operand& _operand);
+
+		void logOperandAllocationFailure() const;
+
+		// if constant folding or value numbering is enabled, replaces this instruction by its evaluated constant or an equivalent
+		// previous instruction and removes it from its BasicBlock
+		Instruction* simplify();
+
+		// makeOp without finishOp, for builders that append a variable number of operands before calling finishOp
+		template <class ...Args>
+		void beginOp(const spv::Op _op, Args&& ... _args);
+
+		// calls inferResultTypeOperand, validateOperands and simplify if this is part of a BasicBlock, returns the instruction to use instead of this
+		Instruction* finishOp();
 
 		// creates literals
 		template <class T, class ...Args>
@@ -733,7 +753,7 @@ namespace spvgentwo
 	Instruction::Iterator getLiteralString(String& _out, Instruction::Iterator _begin, Instruction::Iterator _end);
 
 	template<class ...Args>
-	inline Instruction::Instruction(Module* _pModule, const spv::Op _op, Args&& ..._args) : List(_pModule->getAllocator()),
+	inline Instruction::Instruction(Module* _pModule, const spv::Op _op, Args&& ..._args) : OperandContainer(_pModule->getAllocator()),
 		m_parentType(ParentType::Module)
 	{
 		m_parent.pModule = _pModule;
@@ -741,7 +761,7 @@ namespace spvgentwo
 	}
 
 	template<class ...Args>
-	inline Instruction::Instruction(Function* _pFunction, const spv::Op _op, Args&& ..._args) : List(_pFunction->getAllocator()),
+	inline Instruction::Instruction(Function* _pFunction, const spv::Op _op, Args&& ..._args) : OperandContainer(_pFunction->getAllocator()),
 		m_parentType(ParentType::Function)
 	{
 		m_parent.pFunction = _pFunction;
@@ -749,15 +769,37 @@ namespace spvgentwo
 	}
 
 	template<class ...Args>
-	inline Instruction::Instruction(BasicBlock* _pBasicBlock, const spv::Op _op, Args&& ..._args) : List(_pBasicBlock->getAllocator()),
+	inline Instruction::Instruction(BasicBlock* _pBasicBlock, const spv::Op _op, Args&& ..._args) : OperandContainer(_pBasicBlock->getAllocator()),
 		m_parentType(ParentType::BasicBlock)
 	{
 		m_parent.pBasicBlock = _pBasicBlock;
 		makeOp(_op, stdrep::forward<Args>(_args)...);
 	}
 
+	template<class ...Args>
+	inline Operand* Instruction::addOperand(Args&& ..._operand)
+	{
+		Operand* pOp = emplace_back(stdrep::forward<Args>(_operand)...);
+		if (pOp == nullptr)
+		{
+			logOperandAllocationFailure();
+		}
+		else if (pOp->isInstruction() || pOp->isBranchTarget())
+		{
+			trackUse(*pOp);
+		}
+		return pOp;
+	}
+
 	template<class ...Args>
 	inline Instruction* Instruction::makeOp(const spv::Op _op, Args&& ..._args)
+	{
+		beginOp(_op, stdrep::forward<Args>(_args)...);
+		return finishOp();
+	}
+
+	template<class ...Args>
+	inline void Instruction::beginOp(const spv::Op _op, Args&& ..._args)
 	{
 		reset();
 
@@ -767,11 +809,6 @@ namespace spvgentwo
 		{
 			makeOpInternal(stdrep::forward<Args>(_args)...);
 		}
-
-		inferResultTypeOperand();
-		validateOperands();
-
-		return this;
 	}
 	
 	template<class T>
@@ -903,7 +940,7 @@ namespace spvgentwo
 	template<class ...VarInst>
 	inline Instruction* Instruction::opPhi(Instruction* _pVar, VarInst* ..._variables)
 	{
-		makeOp(spv::Op::OpPhi, _pVar->getTypeInstr(), InvalidId);
+		beginOp(spv::Op::OpPhi, _pVar->getTypeInstr(), InvalidId);
 
 		auto addVar = [&](Instruction* var)
 		{
@@ -914,7 +951,7 @@ namespace spvgentwo
 		addVar(_pVar);
 
 		(addVar(_variables), ...);
-		return this;
+		return finishOp();
 	}
 
 	template<class ...LoopControlParams>
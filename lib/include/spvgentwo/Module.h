@@ -3,6 +3,7 @@
 #include "EntryPoint.h"
 #include "HashMap.h"
 #include "Constant.h"
+#include "TypeNode.h"
 #include "Logger.h"
 #include "String.h"
 
@@ -10,6 +11,13 @@ namespace spvgentwo
 {
 	// forward delcs:
 	class ITypeInferenceAndVailation;
+	class ITaskExecutor;
+
+	namespace detail
+	{
+		// hands out the slots of Module::m_TypeCache, thread safe
+		unsigned int nextTypeCacheIndex();
+	}
 
 	class Module
 	{
@@ -92,6 +100,10 @@ namespace spvgentwo
 		const HashMap<const Instruction*, MemberName>& getNameLookupMap() const { return m_NameLookup; }
 		HashMap<const Instruction*, MemberName>& getNameLookupMap() { return m_NameLookup; }
 
+		// dense part of the result <id> -> instruction lookup indexed by <id> (nullptr if unused), rebuilt by assignIDs(), resolveIDs() and read().
+		// <id>s far above all others are kept in a hash map instead, use findInstructionById() to look up any <id>
+		const Vector<Instruction*>& getIdLookup() const { return m_IdToInstr; }
+
 		// add empty function
 		Function& addFunction();
 
@@ -117,9 +129,22 @@ namespace spvgentwo
 		Instruction* getExtensionInstructionImport(const char* _pExtName);
 
 		Instruction* addType(const Type& _type, const char* _pName = nullptr);
+
+		// OpType### instruction of _pNode, declared again (with its sub types) if it was removed. nullptr if _pNode is nullptr
+		Instruction* addType(const TypeNode* _pNode);
 		const Type* getTypeInfo(const Instruction* _pTypeInstr) const;
 
-		// add a new instruction to m_TypesAndConstants, if _pType is not nullptr, also add entries in m_TypeToInstr and m_InstrToType maps
+		// add _type if not present and return its interned node, sub types are interned bottom up so no type tree is hashed twice
+		const TypeNode* internType(const Type& _type, const char* _pName = nullptr);
+
+		// interned node of _pTypeInstr, nullptr if it is not a type of this module
+		const TypeNode* getTypeNode(const Instruction* _pTypeInstr) const;
+
+		// interned _baseType wrapping _pInner, looked up without building a Type tree if present:
+		// vector or matrix with _count elements/columns, array of _count (constant) length, pointer to _storageClass, runtime array, sampled image
+		const TypeNode* wrapType(const TypeNode* _pInner, const spv::Op _baseType, const unsigned int _count = 0u, const spv::StorageClass _storageClass = spv::StorageClass::Generic);
+
+		// add a new instruction to m_TypesAndConstants, if _pType is not nullptr, also intern its node and add it to m_InstrToType
 		Instruction* addTypeInstr(const Type* _pType = nullptr);
 
 		// add a new instruction to m_TypesAndConstants, if _pConstant is not nullptr, also add entry in m_ConstantBuilder map
@@ -141,18 +166,26 @@ namespace spvgentwo
 
 		template <class T>
 		Instruction* specConstant(const T& _value) { return constant<T>(_value, true); };
+
+		// OpConstantComposite (OpSpecConstantComposite if _spec) of an array of the _count scalar or vector constants at _pValues (e.g. a lookup table),
+		// element constants are deduplicated while emitting them in one pass, lookup maps are presized for _count elements
+		template <class T>
+		Instruction* constantArray(const T* _pValues, const unsigned int _count, const bool _spec = false);
 		
 		void setMemoryModel(const spv::AddressingModel _addressModel, const spv::MemoryModel _memoryModel);
 
 		// manually assign IDs to all unresolved instructions, returns bounds/max id
 		// converts any Instruction pointer operand to an spv::Id
-		spv::Id assignIDs();
+		// if _keepExisting, assigned result <id>s stay stable and only instructions without one (InvalidId) or with an <id>
+		// already taken by a preceding instruction get fresh ids above the current maximum, otherwise all ids are compacted
+		// use write(_pWriter, false) after assignIDs(true) to serialize with stable ids. returns InvalidId if the <id> lookup could not be allocated
+		spv::Id assignIDs(const bool _keepExisting = false);
 
 		// converts any spv::Id operand to Instruction pointer operands
 		// resets resultId to InvalidId for new assignment
 		bool resolveIDs();
 
-		// create 'Type' and 'Constant' infos from OpType### and OpConstant### instructions in m_TypesAndConstants and add them to m_TypeToInstr and m_InstrToType
+		// create 'Type' and 'Constant' infos from OpType### and OpConstant### instructions in m_TypesAndConstants and add them to m_TypeNodes and m_InstrToType
 		// resolveIDs() must have been called before to allow sub type lookup
 		bool reconstructTypeAndConstantInfo();
 
@@ -163,9 +196,29 @@ namespace spvgentwo
 		// IDs dont need to be assigned if the module was parsed using read()
 		void write(IWriter* _pWriter, const bool _assingIDs = true);
 
+		// number of words write() produces including the header, finalizes entry point interfaces (adding their operands)
+		// walks all instructions once, use to size the buffer for write(unsigned int*, ...)
+		sgt_size_t computeWordCount();
+
+		// write() into a caller supplied buffer of _wordCount words without any reallocation
+		// returns number of words written or 0 if the buffer is too small
+		sgt_size_t write(unsigned int* _pWords, sgt_size_t _wordCount, const bool _assingIDs = true);
+
+		// write() that encodes function bodies concurrently with _pExecutor (sequentially if nullptr) into disjoint ranges of one buffer
+		// which is then passed to _pWriter at once. Output is identical to write(), the allocator of this module must be thread safe.
+		void writeParallel(IWriter* _pWriter, ITaskExecutor* _pExecutor, const bool _assingIDs = true);
+
 		// parse a binary SPIR-V program from IReader using _grammer generated from SPIR-V machinereadable grammer json
 		bool read(IReader* _pReader, const Grammar& _grammar);
 
+		// read() that resolves <id> operands, type, constant and name infos while parsing, forward references are patched at the end
+		// equivalent to read() + resolveIDs() + reconstructTypeAndConstantInfo() + reconstructNames()
+		bool readAndResolve(IReader* _pReader, const Grammar& _grammar);
+
+		// read() from a complete module binary in memory, function bodies are located up front and parsed concurrently by _pExecutor
+		// (sequentially if nullptr). The allocator of this module must be thread safe, functions keep the order of the binary.
+		bool readParallel(const unsigned int* _pWords, sgt_size_t _wordCount, const Grammar& _grammar, ITaskExecutor* _pExecutor);
+
 		// for use with opString, opSource, opSourceContinued, opSourceExtension
 		Instruction* addSourceStringInstr();
 
@@ -267,21 +320,63 @@ namespace spvgentwo
 		template <class Func> // func takes const Instruction& -> func(instr)
 		void iterateInstructions(Func _func) const { iterateModuleInstructions(*this, _func); }
 
-		// search for instruction assigned to _resultId (for use with resolved instructions generated by assignIDs())
-		Instruction* findInstructionById(const spv::Id _resultId);
+		// lookup instruction assigned to _resultId by the last assignIDs(), resolveIDs() or read() call, walks the module if it is not in the lookup
+		Instruction* findInstructionById(const spv::Id _resultId) const;
 
 		// collect all instructions which consume _pInstr (needs to generate result id) and replase its reference with _pReplacement if not nullptr
+		// uses the def-use index if use tracking is enabled, branch targets are not gathered in either case
 		void gatherUses(const Instruction* _pInstr, List<Instruction*>& _outUses, Instruction* _pReplacement = nullptr);
 
 		// replace any use of _pInstr as an operand with _pReplacement
 		void replaceUses(const Instruction* _pInstr, Instruction* _pReplacement);
 
-		// remove _pInstr from type/constant and name lookup maps
+		// remove _pInstr from type/constant, name, result <id> and def-use lookup maps
 		void removeFromLookupMaps(const Instruction* _pInstr);
 
+		// opt-in def-use index used by gatherUses, replaceUses and remove to avoid scanning the whole module.
+		// enabling (re)builds the index, operands added with Instruction::addOperand/makeOp are tracked afterwards, resolveIDs() rebuilds it.
+		// operands assigned directly (e.g. *it = pInstr) are not tracked, call updateUses(pUser) or setUseTracking(true) after such changes
+		void setUseTracking(const bool _enable);
+		bool isTrackingUses() const { return m_trackUses; }
+
+		// instructions consuming _pInstr in their actual operands (branch targets are tracked by their OpLabel), nullptr if not tracked
+		const List<Instruction*>* getUses(const Instruction* _pInstr) const;
+
+		// opt-in constant folding: arithmetic, bitwise, logical and comparison instructions added to a BasicBlock whose operands are all
+		// non-spec constants are evaluated at generation time, the instruction is removed and the (deduplicated) result constant is returned instead
+		void setConstantFolding(const bool _enable) { m_foldConstants = _enable; }
+		bool isFoldingConstants() const { return m_foldConstants; }
+
+		// opt-in value numbering: side effect free instructions and loads added to a BasicBlock that are equivalent to a previous instruction of
+		// the same block are removed and the previous instruction is returned instead, see BasicBlock::numberValue
+		void setValueNumbering(const bool _enable) { m_numberValues = _enable; }
+		bool isNumberingValues() const { return m_numberValues; }
+
+		// register _pUser as consumer of the instruction referenced by _operand (which must be an operand of _pUser)
+		void addUse(Instruction* _pUser, const Operand& _operand);
+
+		// unregister _pUser from all instructions it consumes
+		void removeUses(const Instruction* _pUser);
+
+		// register the operands of _pUser again after they were assigned directly
+		void updateUses(Instruction* _pUser);
+
+		// gatherUses for the def-use index: appends users of _pDef (operand instruction, or branch target with OpLabel _pDef if _branchTargets is set) to _pOutUses
+		// if not nullptr and replaces the matching operands with _pReplacement if not nullptr, keeping the kind of the replaced operand. returns false if use tracking is disabled
+		bool gatherTrackedUses(const Instruction* _pDef, List<Instruction*>* _pOutUses, const Operand* _pReplacement = nullptr, const bool _branchTargets = false);
+
 		// remove _pInstr if it is homed in this module, its functions and basic blocks, returns true if it was removed
 		bool remove(const Instruction* _pInstr);
 
+		// dead code elimination: mark everything reachable from the entry points (and symbols exported by OpDecorate LinkageAttributes)
+		// and remove unreferenced functions, global variables, types, constants, undefs and the OpName and OpDecorate instructions of removed targets
+		// returns the number of removed functions and instructions
+		unsigned int removeDeadCode();
+
+		// inline calls to functions with at most _maxInstructions instructions in their basic blocks (see Function::inlineCall)
+		// and remove inlined functions that are neither called nor exported anymore. (mutually) recursive functions are not inlined. returns the number of inlined calls
+		unsigned int inlineFunctions(const unsigned int _maxInstructions = 64u);
+
 		// ILogger proxy calls
 		template <typename ...Args>
 		bool log(bool _pred, const LogLevel _level, const char* _pFormat, Args... _args) const;
@@ -322,6 +417,93 @@ namespace spvgentwo
 
 		void updateParentPointers();
 
+		// slot of C++ type T in m_TypeCache, assigned on first use and shared by all modules
+		template <class T>
+		static unsigned int typeCacheIndex();
+
+		Instruction* getCachedType(const unsigned int _index) const { return _index < m_TypeCache.size() ? m_TypeCache[_index] : nullptr; }
+		void setCachedType(const unsigned int _index, Instruction* _pType);
+
+		// create the instruction of the new constant _node.kv.key (which must not have one yet) with type _pType
+		Instruction* addConstantInstr(HashMap<Constant, Instruction*>::Node& _node, Instruction* _pType);
+
+		// add the constituent operands of composite _composite, missing constituent constants are added in one pass over _components
+		void addConstituents(Instruction& _composite, const Vector<Constant>& _components);
+
+		// OpDecorate _target LinkageAttributes "name" Export
+		static bool isExportDecoration(const Instruction& _deco);
+
+		// drop m_TypeCache and m_ScalarConstantCache entries, called when types or constants are removed or their lookups are rebuilt
+		void clearTypeCaches();
+
+		// intern the type with the properties of _type (its sub types are ignored) and sub type nodes _pSubTypes, creates the type instruction if new
+		const TypeNode* internType(const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count, const char* _pName);
+
+		// node with the properties of _type (its sub types are ignored), sub type nodes _pSubTypes and hash _hash, nullptr if not interned
+		TypeNode* findTypeNode(const Hash64 _hash, const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count) const;
+
+		// node of _type, its sub types are looked up bottom up. nullptr if not interned
+		const TypeNode* findTypeNode(const Type& _type) const;
+
+		// register type instruction _pInstr as declaration of _type with sub type nodes _pSubTypes, the node is created if _type is new.
+		// a node whose declaration was removed adopts _pInstr, otherwise _pInstr is a duplicate declaration sharing the node
+		const TypeNode* addTypeNode(Type&& _type, Instruction* _pInstr, const TypeNode* const* _pSubTypes, const unsigned int _count);
+
+		// create the OpType### instruction of _node (and of its sub types missing theirs)
+		Instruction* declareType(TypeNode& _node);
+
+		// add a node to m_TypeNodes and count it as parent of its sub types, nullptr if allocation failed
+		TypeNode* emplaceTypeNode(const Hash64 _hash, Type&& _type, Instruction* _pInstr, const TypeNode* const* _pSubTypes, const unsigned int _count);
+
+		// erase _pNode if it has neither an instruction nor parents and release its sub types the same way
+		void releaseTypeNode(TypeNode* _pNode);
+
+		// fill m_IdToInstr with all instructions that have a result <id> operand, returns false if a result operand is not an <id> or exceeds m_spvBound
+		bool buildIdLookup();
+
+		// clear the <id> lookup and reserve the dense table for m_spvBound <id>s, but at most MaxIdLookupReserve as the bound might come from an untrusted header
+		bool resetIdLookup();
+
+		// set the lookup entry of _id. the dense table grows geometrically for <id>s close to its size, sparse <id>s go to m_SparseIdToInstr
+		bool addIdLookup(spv::Id _id, Instruction* _pInstr);
+
+		Instruction* lookupId(spv::Id _id) const;
+
+		// finalize entry point interfaces and assign ids if _assingIDs
+		void prepareWrite(const bool _assingIDs);
+
+		void finalizeEntryPoints();
+
+		// parse instructions & operands without building any lookups
+		bool readInstructions(IReader* _pReader, const Grammar& _grammar);
+
+		// replace <id> operands with instructions from the <id> lookup, returns the first <id> not found or InvalidId
+		spv::Id resolveOperands(Instruction& _instr) const;
+
+		// create Type or Constant info for a single resolved OpType### or OpConstant### instruction
+		bool addTypeOrConstantInfo(Instruction& _instr);
+
+		// set the function types of all functions and entry points, types of parameters & return must be resolved
+		bool updateFunctionTypes();
+
+		// add m_NameLookup entry of a resolved OpName or OpMemberName instruction
+		bool addNameInfo(const Instruction& _instr);
+
+		// fill m_Uses with the consumers of all instructions in this module
+		void buildUseLookup();
+
+		// instruction referenced by _operand, OpLabel for branch targets, nullptr otherwise
+		static const Instruction* getUseKey(const Operand& _operand);
+
+		// append _pUser to the users of _pDef
+		void addUseEntry(const Instruction* _pDef, Instruction* _pUser);
+
+		// remove _pUser from the users of _pDef
+		void removeUseEntry(const Instruction* _pDef, const Instruction* _pUser);
+
+		// drop the user list of _pDef
+		void removeUsesOf(const Instruction* _pDef);
+
 	private:
 		IAllocator* m_pAllocator = nullptr;
 		ILogger* m_pLogger = nullptr;
@@ -345,14 +527,48 @@ namespace spvgentwo
 		List<Instruction> m_Decorations; // opDecorate, opMemberDecorate
 		
 		List<Instruction> m_TypesAndConstants;
-		HashMap<Type, Instruction*> m_TypeToInstr;
-		HashMap<const Instruction*, const Type*> m_InstrToType;
+		HashMap<const Instruction*, const TypeNode*> m_InstrToType;
+		HashMap<Hash64, TypeNode> m_TypeNodes; // TypeNode::getHash() -> interned node, owns the builder facing Type
 		HashMap<Constant, Instruction*> m_ConstantToInstr;
 		HashMap<const Instruction*, const Constant*> m_InstrToConstant;
 
+		// type<T>() results indexed by typeCacheIndex<T>(), nullptr if not requested yet
+		Vector<Instruction*> m_TypeCache;
+
+		// constant<T>() results of scalar T
+		struct ScalarConstantKey
+		{
+			unsigned int typeIndex = 0u;
+			unsigned int spec = 0u;
+			unsigned long long bits = 0ull;
+
+			bool operator==(const ScalarConstantKey& _other) const { return typeIndex == _other.typeIndex && spec == _other.spec && bits == _other.bits; }
+		};
+		HashMap<ScalarConstantKey, Instruction*> m_ScalarConstantCache;
+
 		// instruction that was decorated with opName or OpMemberName(Target) -> name
 		HashMap<const Instruction*, MemberName> m_NameLookup;
 
+		// result <id> -> instruction, ids are usually dense and below m_spvBound so this is a flat table indexed by <id>
+		Vector<Instruction*> m_IdToInstr;
+		// result <id>s too far above the dense table to grow it
+		HashMap<spv::Id, Instruction*> m_SparseIdToInstr;
+		static constexpr spv::Id MaxIdLookupReserve = 1u << 16u;
+
+		// instruction -> instructions using it as an operand, only populated if m_trackUses is set
+		HashMap<const Instruction*, List<Instruction*>> m_Uses;
+		// user -> its entries in m_Uses, so that removing a user does not search the user lists
+		struct UseEntry
+		{
+			List<Instruction*>* pUsers;
+			Entry<Instruction*>* pEntry;
+		};
+		HashMap<const Instruction*, UseEntry> m_UseEntries;
+		bool m_trackUses = false;
+
+		bool m_foldConstants = false;
+		bool m_numberValues = false;
+
 		List<Instruction> m_GlobalVariables; //opVariable with StorageClass != Function
 
 		List<Instruction> m_Undefs; // opUndef
@@ -402,15 +618,110 @@ namespace spvgentwo
 	template<class T, class ... Props>
 	inline Instruction* Module::type(const Props& ... _props)
 	{
-		Type dummy(m_pAllocator);
-		return addType(dummy.make<T>(_props...));
+		if constexpr (sizeof...(_props) == 0u)
+		{
+			const unsigned int index = typeCacheIndex<T>();
+
+			if (Instruction* pType = getCachedType(index); pType != nullptr)
+			{
+				return pType;
+			}
+
+			Type dummy(m_pAllocator);
+			Instruction* pType = addType(dummy.make<T>());
+			setCachedType(index, pType);
+			return pType;
+		}
+		else
+		{
+			Type dummy(m_pAllocator);
+			return addType(dummy.make<T>(_props...));
+		}
 	}
 
 	template<class T>
 	inline Instruction* Module::constant(const T& _value, const bool _spec)
 	{
-		Constant dummy(m_pAllocator);
-		return addConstant(dummy.make<T>(_value, _spec));
+		using S = traits::remove_cvref_t<T>;
+
+		if constexpr ((stdrep::is_same_v<S, bool> || traits::is_primitive_type_v<S>) && sizeof(S) <= sizeof(unsigned long long))
+		{
+			ScalarConstantKey key{ typeCacheIndex<S>(), _spec ? 1u : 0u, 0ull };
+			const unsigned char* pBytes = reinterpret_cast<const unsigned char*>(&_value);
+			for (unsigned int i = 0u; i < sizeof(S); ++i)
+			{
+				key.bits |= static_cast<unsigned long long>(pBytes[i]) << (i * 8u);
+			}
+
+			auto* pNode = m_ScalarConstantCache.emplaceUnique(key, nullptr);
+			if (pNode == nullptr || pNode->kv.value == nullptr)
+			{
+				Constant dummy(m_pAllocator);
+				Instruction* pInstr = addConstant(dummy.make<T>(_value, _spec));
+				if (pNode != nullptr)
+				{
+					pNode->kv.value = pInstr; // the cache is optional, only skip it if the entry could not be allocated
+				}
+				return pInstr;
+			}
+			return pNode->kv.value;
+		}
+		else if constexpr (is_const_array_v<S>)
+		{
+			return constantArray(_value.data, S::Elements, _spec);
+		}
+		else
+		{
+			Constant dummy(m_pAllocator);
+			return addConstant(dummy.make<T>(_value, _spec));
+		}
+	}
+
+	template<class T>
+	inline Instruction* Module::constantArray(const T* _pValues, const unsigned int _count, const bool _spec)
+	{
+		if (_pValues == nullptr || _count == 0u)
+		{
+			logError("constantArray requires at least one element");
+			return getErrorInstr();
+		}
+
+		Constant composite(m_pAllocator);
+		composite.setOperation(_spec ? spv::Op::OpSpecConstantComposite : spv::Op::OpConstantComposite);
+		composite.getComponents().reserve(_count);
+
+		for (unsigned int i = 0u; i < _count; ++i)
+		{
+			Constant* pComponent = composite.Component();
+			if (pComponent == nullptr)
+			{
+				logError("Failed to allocate constant component");
+				return getErrorInstr();
+			}
+			pComponent->make(_pValues[i]); // elements are plain constants like in Constant::make
+		}
+
+		composite.getType().Array(_count, &composite.getComponents().front().getType());
+
+		auto* pNode = m_ConstantToInstr.emplaceUnique(stdrep::move(composite), nullptr);
+		if (pNode == nullptr)
+		{
+			logError("Failed to allocate constant lookup entry");
+			return getErrorInstr();
+		}
+		else if (pNode->kv.value != nullptr)
+		{
+			return pNode->kv.value;
+		}
+
+		return addConstantInstr(*pNode, addType(pNode->kv.key.getType()));
+	}
+
+	template<class T>
+	inline unsigned int Module::typeCacheIndex()
+	{
+		static const unsigned int index = detail::nextTypeCacheIndex();
+		return index;
 	}
 
 	template<class ...TypeInstr>
@@ -57,6 +57,9 @@ namespace spvgentwo
 		Operand(const literal_t _value) : type(Type::Literal), instruction(nullptr) { literal = _value; }
 		Operand(const spv::Id _resutlId) : type(Type::Id), instruction(nullptr) { id = _resutlId; }
 
+		// spv word this operand serializes to
+		unsigned int getWord() const;
+
 		void write(IWriter* _pWriter) const;
 
 		Operand& operator=(const Operand& _other);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "stdreplacement.h"
+
 namespace spvgentwo
 {
 	class IReader
@@ -7,5 +9,46 @@ namespace spvgentwo
 	public:
 		// return value TRUE indicates success, FALSE fail or EOF
 		virtual bool get(unsigned int& _word) = 0;
+
+		// read _count words to _pWords, return value TRUE indicates all words were read
+		virtual bool read(unsigned int* _pWords, sgt_size_t _count)
+		{
+			for (sgt_size_t i = 0u; i < _count; ++i)
+			{
+				if (get(_pWords[i]) == false) return false;
+			}
+			return true;
+		}
+	};
+
+	// reads from a word buffer owned by the caller, e.g. a sub range of a module binary
+	class BinaryBufferReader : public IReader
+	{
+	public:
+		BinaryBufferReader(const unsigned int* _pWords = nullptr, sgt_size_t _wordCount = 0u) : m_pWords(_pWords), m_wordCount(_wordCount) {}
+
+		bool get(unsigned int& _word) final
+		{
+			if (m_position == m_wordCount) return false;
+			_word = m_pWords[m_position++];
+			return true;
+		}
+
+		bool read(unsigned int* _pWords, sgt_size_t _count) final
+		{
+			if (_count > m_wordCount - m_position) return false;
+			for (sgt_size_t i = 0u; i < _count; ++i)
+			{
+				_pWords[i] = m_pWords[m_position++];
+			}
+			return true;
+		}
+
+		sgt_size_t position() const { return m_position; }
+
+	private:
+		const unsigned int* m_pWords = nullptr;
+		sgt_size_t m_wordCount = 0u;
+		sgt_size_t m_position = 0u;
 	};
-} // !spvgentwo
\ No newline at end of file
+} // !spvgentwo
@@ -0,0 +1,400 @@
+#pragma once
+
+#include "Allocator.h"
+#include "SmallVectorIterator.h"
+
+namespace spvgentwo
+{
+	// contiguous container storing up to InlineCapacity elements without allocating, larger sizes spill to _pAllocator
+	template <class T, sgt_size_t InlineCapacity = 8u>
+	class SmallVector
+	{
+		static_assert(InlineCapacity > 0u, "InlineCapacity must not be zero");
+	public:
+		using Iterator = SmallVectorIterator<T>;
+		using ValueType = T;
+		using ReferenceType = T&;
+		using PointerType = T*;
+
+		SmallVector(IAllocator* _pAllocator = nullptr) : m_pAllocator(_pAllocator) {}
+		SmallVector(const SmallVector& _other);
+		SmallVector(SmallVector&& _other) noexcept;
+
+		~SmallVector();
+
+		SmallVector& operator=(const SmallVector& _other);
+		SmallVector& operator=(SmallVector&& _other) noexcept;
+
+		bool operator==(const SmallVector& _other) const;
+		bool operator!=(const SmallVector& _other) const { return !operator==(_other); }
+
+		IAllocator* getAllocator() const { return m_pAllocator; }
+
+		T& operator[](sgt_size_t _idx) { return m_pData[_idx]; }
+		const T& operator[](sgt_size_t _idx) const { return m_pData[_idx]; }
+
+		// reserve can only grow, returns false if the inline capacity is exceeded and no allocator is available
+		bool reserve(sgt_size_t _size);
+
+		// destructs all elements, keeps the allocated capacity
+		void clear();
+
+		// returns nullptr if capacity could not be increased
+		template <class ...Args>
+		T* emplace_back(Args&& ..._args);
+
+		// insert new element before _pos (append if _pos is the end), returns iterator to the new element
+		template <class ...Args>
+		Iterator insert_before(Iterator _pos, Args&& ..._args);
+
+		// removes element at _pos, returns iterator to the next element
+		Iterator erase(Iterator _pos);
+
+		void pop_back();
+
+		Iterator begin() const { return makeIterator(0u); }
+		Iterator end() const { return Iterator(nullptr); }
+
+		Iterator last() const { return m_elements == 0u ? Iterator(nullptr) : makeIterator(m_elements - 1u); }
+
+		T& front() { return m_pData[0]; }
+		const T& front() const { return m_pData[0]; }
+
+		T& back() { return m_pData[m_elements - 1u]; }
+		const T& back() const { return m_pData[m_elements - 1u]; }
+
+		T* data() const { return m_pData; }
+		sgt_size_t size() const { return m_elements; }
+		sgt_size_t capacity() const { return m_capacity; }
+		bool empty() const { return m_elements == 0u; }
+
+		// true if elements are stored in the inline buffer
+		bool isInline() const { return m_pData == inlineData(); }
+
+		template <class Comparable>
+		Iterator find(const Comparable& _val) const;
+
+		template<class Pred>
+		Iterator find_if(const Pred& _pred) const;
+
+		template <class Comparable>
+		bool contains(const Comparable& _val) const { return find(_val) != nullptr; }
+
+	private:
+		T* inlineData() const { return reinterpret_cast<T*>(const_cast<unsigned char*>(m_inlineStorage)); }
+
+		Iterator makeIterator(sgt_size_t _idx) const { return _idx < m_elements ? Iterator(&m_pData, &m_elements, _idx) : Iterator(nullptr); }
+
+		// allocates _size elements and constructs the element at m_elements from _args before relocating the existing ones (_args may alias them)
+		template <class ...Args>
+		T* grow(sgt_size_t _size, Args&& ..._args);
+
+		// move construct _pSrc into _pDst and destruct _pSrc
+		static void relocate(T* _pDst, T* _pSrc);
+
+		// takes over elements or heap storage of _other, this must be empty and inline
+		void steal(SmallVector& _other);
+
+		void deallocate();
+
+	private:
+		IAllocator* m_pAllocator = nullptr;
+		T* m_pData = inlineData();
+		sgt_size_t m_elements = 0u;
+		sgt_size_t m_capacity = InlineCapacity;
+		alignas(T) unsigned char m_inlineStorage[InlineCapacity * sizeof(T)];
+	};
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline SmallVector<T, InlineCapacity>::SmallVector(const SmallVector& _other) :
+		m_pAllocator(_other.m_pAllocator)
+	{
+		if (reserve(_other.m_elements))
+		{
+			for (const T& e : _other)
+			{
+				emplace_back(e);
+			}
+		}
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline SmallVector<T, InlineCapacity>::SmallVector(SmallVector&& _other) noexcept :
+		m_pAllocator(_other.m_pAllocator)
+	{
+		steal(_other);
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline SmallVector<T, InlineCapacity>::~SmallVector()
+	{
+		clear();
+		deallocate();
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline SmallVector<T, InlineCapacity>& SmallVector<T, InlineCapacity>::operator=(const SmallVector& _other)
+	{
+		if (this == &_other) return *this;
+
+		clear();
+
+		if (reserve(_other.m_elements))
+		{
+			for (const T& e : _other)
+			{
+				emplace_back(e);
+			}
+		}
+
+		return *this;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline SmallVector<T, InlineCapacity>& SmallVector<T, InlineCapacity>::operator=(SmallVector&& _other) noexcept
+	{
+		if (this == &_other) return *this;
+
+		clear();
+		deallocate();
+
+		m_pAllocator = _other.m_pAllocator;
+		steal(_other);
+
+		return *this;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline bool SmallVector<T, InlineCapacity>::operator==(const SmallVector& _other) const
+	{
+		if (m_elements != _other.m_elements) return false;
+
+		for (sgt_size_t i = 0u; i < m_elements; ++i)
+		{
+			if ((m_pData[i] == _other.m_pData[i]) == false) return false;
+		}
+
+		return true;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline bool SmallVector<T, InlineCapacity>::reserve(sgt_size_t _size)
+	{
+		if (m_capacity >= _size)
+		{
+			return true;
+		}
+
+		if (m_pAllocator == nullptr)
+		{
+			return false;
+		}
+
+		T* pNewData = reinterpret_cast<T*>(m_pAllocator->allocate(_size * sizeof(T), alignof(T)));
+
+		if (pNewData == nullptr)
+		{
+			return false;
+		}
+
+		for (sgt_size_t i = 0u; i < m_elements; ++i)
+		{
+			relocate(pNewData + i, m_pData + i);
+		}
+
+		deallocate();
+
+		m_pData = pNewData;
+		m_capacity = _size;
+
+		return true;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline void SmallVector<T, InlineCapacity>::clear()
+	{
+		for (sgt_size_t i = 0u; i < m_elements; ++i)
+		{
+			m_pData[i].~T();
+		}
+
+		m_elements = 0u;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	template<class ...Args>
+	inline T* SmallVector<T, InlineCapacity>::emplace_back(Args&& ..._args)
+	{
+		if (m_elements == m_capacity)
+		{
+			return grow(m_capacity * 2u, stdrep::forward<Args>(_args)...);
+		}
+
+		return traits::constructWithArgs(m_pData + m_elements++, stdrep::forward<Args>(_args)...);
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	template<class ...Args>
+	inline T* SmallVector<T, InlineCapacity>::grow(sgt_size_t _size, Args&& ..._args)
+	{
+		if (m_pAllocator == nullptr)
+		{
+			return nullptr;
+		}
+
+		T* pNewData = reinterpret_cast<T*>(m_pAllocator->allocate(_size * sizeof(T), alignof(T)));
+
+		if (pNewData == nullptr)
+		{
+			return nullptr;
+		}
+
+		T* pElement = traits::constructWithArgs(pNewData + m_elements, stdrep::forward<Args>(_args)...);
+
+		for (sgt_size_t i = 0u; i < m_elements; ++i)
+		{
+			relocate(pNewData + i, m_pData + i);
+		}
+
+		deallocate();
+
+		m_pData = pNewData;
+		m_capacity = _size;
+		++m_elements;
+
+		return pElement;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	template<class ...Args>
+	inline typename SmallVector<T, InlineCapacity>::Iterator SmallVector<T, InlineCapacity>::insert_before(Iterator _pos, Args&& ..._args)
+	{
+		if (_pos == nullptr)
+		{
+			return emplace_back(stdrep::forward<Args>(_args)...) != nullptr ? last() : end();
+		}
+
+		// index stays valid across reallocation
+		const sgt_size_t index = static_cast<sgt_size_t>(_pos.element() - m_pData);
+
+		// append the new element (growing handles _args aliasing an element) and rotate it into place
+		if (emplace_back(stdrep::forward<Args>(_args)...) == nullptr)
+		{
+			return end();
+		}
+
+		alignas(T) unsigned char tmp[sizeof(T)];
+		relocate(reinterpret_cast<T*>(tmp), m_pData + m_elements - 1u);
+
+		for (sgt_size_t i = m_elements - 1u; i > index; --i)
+		{
+			relocate(m_pData + i, m_pData + i - 1u);
+		}
+
+		relocate(m_pData + index, reinterpret_cast<T*>(tmp));
+
+		return makeIterator(index);
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline typename SmallVector<T, InlineCapacity>::Iterator SmallVector<T, InlineCapacity>::erase(Iterator _pos)
+	{
+		if (_pos == nullptr)
+		{
+			return end();
+		}
+
+		const sgt_size_t index = static_cast<sgt_size_t>(_pos.element() - m_pData);
+
+		m_pData[index].~T();
+
+		for (sgt_size_t i = index + 1u; i < m_elements; ++i)
+		{
+			relocate(m_pData + i - 1u, m_pData + i);
+		}
+
+		--m_elements;
+
+		return makeIterator(index);
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline void SmallVector<T, InlineCapacity>::pop_back()
+	{
+		if (m_elements != 0u)
+		{
+			m_pData[--m_elements].~T();
+		}
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	template<class Comparable>
+	inline typename SmallVector<T, InlineCapacity>::Iterator SmallVector<T, InlineCapacity>::find(const Comparable& _val) const
+	{
+		for (sgt_size_t i = 0u; i < m_elements; ++i)
+		{
+			if (m_pData[i] == _val) return makeIterator(i);
+		}
+		return end();
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	template<class Pred>
+	inline typename SmallVector<T, InlineCapacity>::Iterator SmallVector<T, InlineCapacity>::find_if(const Pred& _pred) const
+	{
+		for (sgt_size_t i = 0u; i < m_elements; ++i)
+		{
+			if (_pred(m_pData[i])) return makeIterator(i);
+		}
+		return end();
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline void SmallVector<T, InlineCapacity>::relocate(T* _pDst, T* _pSrc)
+	{
+		if constexpr (stdrep::is_constructible_v<T, T&&>)
+		{
+			new(_pDst) T(stdrep::move(*_pSrc));
+		}
+		else
+		{
+			new(_pDst) T(*_pSrc);
+		}
+		_pSrc->~T();
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline void SmallVector<T, InlineCapacity>::steal(SmallVector& _other)
+	{
+		if (_other.isInline())
+		{
+			for (sgt_size_t i = 0u; i < _other.m_elements; ++i)
+			{
+				relocate(m_pData + i, _other.m_pData + i);
+			}
+		}
+		else // take over heap storage
+		{
+			m_pData = _other.m_pData;
+			m_capacity = _other.m_capacity;
+
+			_other.m_pData = _other.inlineData();
+			_other.m_capacity = InlineCapacity;
+		}
+
+		m_elements = _other.m_elements;
+		_other.m_elements = 0u;
+	}
+
+	template<class T, sgt_size_t InlineCapacity>
+	inline void SmallVector<T, InlineCapacity>::deallocate()
+	{
+		if (isInline() == false && m_pAllocator != nullptr)
+		{
+			m_pAllocator->deallocate(m_pData, m_capacity * sizeof(T));
+		}
+
+		m_pData = inlineData();
+		m_capacity = InlineCapacity;
+	}
+} // !spvgentwo
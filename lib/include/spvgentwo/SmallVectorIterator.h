@@ -0,0 +1,106 @@
+#pragma once
+
+#include "stdreplacement.h"
+
+namespace spvgentwo
+{
+	// iterator over contiguous elements that mimics EntryIterator: stepping past the first or last element yields the null iterator (end).
+	// it refers to the containers data pointer and element count by index, so it stays valid when elements are appended or the storage grows
+	template <class T>
+	class SmallVectorIterator
+	{
+	public:
+		SmallVectorIterator(sgt_nullptr_t = nullptr) {}
+		SmallVectorIterator(T* const* _ppData, const sgt_size_t* _pSize, sgt_size_t _index) : m_ppData(_ppData), m_pSize(_pSize), m_index(_index) {}
+
+		bool operator==(const SmallVectorIterator<T>& _other) const { return m_ppData == _other.m_ppData && (m_ppData == nullptr || m_index == _other.m_index); }
+		bool operator!=(const SmallVectorIterator<T>& _other) const { return !operator==(_other); }
+
+		bool operator==(sgt_nullptr_t) const { return m_ppData == nullptr; }
+		bool operator!=(sgt_nullptr_t) const { return m_ppData != nullptr; }
+
+		SmallVectorIterator<T> operator+(unsigned int n) const;
+		SmallVectorIterator<T> operator-(unsigned int n) const;
+
+		SmallVectorIterator<T> prev() const { return operator-(1u); }
+		SmallVectorIterator<T> next() const { return operator+(1u); }
+
+		// pre
+		SmallVectorIterator<T>& operator++();
+		SmallVectorIterator<T>& operator--();
+
+		// post
+		SmallVectorIterator<T> operator++(int);
+		SmallVectorIterator<T> operator--(int);
+
+		T& operator*() { return *element(); }
+		const T& operator*() const { return *element(); }
+
+		T* operator->() { return element(); }
+		const T* operator->() const { return element(); }
+
+		T* element() { return m_ppData != nullptr ? *m_ppData + m_index : nullptr; }
+		const T* element() const { return m_ppData != nullptr ? *m_ppData + m_index : nullptr; }
+
+		explicit operator bool() const { return m_ppData != nullptr; }
+
+	private:
+		T* const* m_ppData = nullptr; // nullptr => end
+		const sgt_size_t* m_pSize = nullptr;
+		sgt_size_t m_index = 0u;
+	};
+
+	template<class T>
+	inline SmallVectorIterator<T> SmallVectorIterator<T>::operator+(unsigned int n) const
+	{
+		if (m_ppData == nullptr || m_index + n >= *m_pSize)
+		{
+			return nullptr;
+		}
+		return SmallVectorIterator<T>(m_ppData, m_pSize, m_index + n);
+	}
+
+	template<class T>
+	inline SmallVectorIterator<T> SmallVectorIterator<T>::operator-(unsigned int n) const
+	{
+		if (m_ppData == nullptr || n > m_index)
+		{
+			return nullptr;
+		}
+		return SmallVectorIterator<T>(m_ppData, m_pSize, m_index - n);
+	}
+
+	template<class T>
+	inline SmallVectorIterator<T>& SmallVectorIterator<T>::operator++()
+	{
+		if (m_ppData != nullptr && ++m_index >= *m_pSize) *this = nullptr;
+		return *this;
+	}
+
+	template<class T>
+	inline SmallVectorIterator<T>& SmallVectorIterator<T>::operator--()
+	{
+		if (m_ppData != nullptr)
+		{
+			if (m_index == 0u) *this = nullptr;
+			else --m_index;
+		}
+		return *this;
+	}
+
+	template<class T>
+	inline SmallVectorIterator<T> SmallVectorIterator<T>::operator++(int)
+	{
+		SmallVectorIterator<T> ret(*this);
+		operator++();
+		return ret;
+	}
+
+	template<class T>
+	inline SmallVectorIterator<T> SmallVectorIterator<T>::operator--(int)
+	{
+		SmallVectorIterator<T> ret(*this);
+		operator--();
+		return ret;
+	}
+} // !spvgentwo
@@ -4,7 +4,9 @@
 
 // base
 #include "Type.h"
+#include "TypeNode.h"
 #include "Constant.h"
+#include "ConstantFolding.h"
 
 #include "Operand.h"
 #include "Instruction.h"
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace spvgentwo
+{
+	class ITaskExecutor
+	{
+	public:
+		using Task = void (*) (void* _pUserData, unsigned int _index);
+
+		virtual ~ITaskExecutor() {}
+
+		// invoke _task for every index in [0, _count), invocations may run concurrently in any order
+		// must only return once all invocations have finished
+		virtual void run(Task _task, void* _pUserData, unsigned int _count) = 0;
+	};
+} // !spvgentwo
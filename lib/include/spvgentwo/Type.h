@@ -87,6 +87,9 @@ namespace spvgentwo
 		bool operator==(const Type& _other) const;
 		bool operator!=(const Type& _other) const { return !operator==(_other); }
 
+		// compares everything but the sub types
+		bool hasSameProperties(const Type& _other) const;
+
 		void reset();
 
 		spv::Op getType() const { return m_Type; }
@@ -566,6 +569,18 @@ namespace spvgentwo
 	struct Hasher<Type>
 	{
 		Hash64 operator()(const Type& _type, FNV1aHasher& _hasher) const
+		{
+			properties(_type, _hasher);
+
+			for (const Type& sub : _type.getSubTypes()) {
+				operator()(sub, _hasher); // go deeper
+			}
+
+			return _hasher;
+		}
+
+		// hash everything but the sub types
+		void properties(const Type& _type, FNV1aHasher& _hasher) const
 		{
 			_hasher << _type.getType();
 			_hasher << _type.getIntWidth(); // image depth, float width
@@ -577,12 +592,6 @@ namespace spvgentwo
 			_hasher << _type.getImageSamplerAccess();
 			_hasher << _type.getImageFormat();
 			_hasher << _type.getAccessQualifier();
-				
-			for (const Type& sub : _type.getSubTypes()) {
-				operator()(sub, _hasher); // go deeper
-			}
-
-			return _hasher;
 		}
 
 		Hash64 operator()(const Type& _type) const
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Type.h"
+#include "SmallVector.h"
+#include "Vector.h"
+
+namespace spvgentwo
+{
+	// forward decls
+	class Instruction;
+
+	// immutable, interned type owned by a Module: each distinct type exists exactly once and sub types are shared nodes,
+	// so two nodes of the same module describe the same type if and only if their pointers are equal
+	class TypeNode
+	{
+		friend class Module;
+	public:
+		TypeNode(IAllocator* _pAllocator, Type&& _type, Instruction* _pInstr, const Hash64 _hash, const TypeNode* const* _pSubTypes, const unsigned int _count);
+
+		// builder facing representation
+		const Type& getType() const { return m_type; }
+
+		// OpType### instruction of this type, nullptr if it was removed while other types are still composed of this node (see Module::addType(const TypeNode*))
+		Instruction* getInstruction() const { return m_pInstr; }
+
+		// computed once from the types own properties and the hashes of its sub types
+		Hash64 getHash() const { return m_hash; }
+
+		// sub type nodes can be nullptr for pointers to not yet declared types (OpTypeForwardPointer)
+		const SmallVector<const TypeNode*, 2u>& getSubTypes() const { return m_subTypes; }
+		const TypeNode* front() const { return m_subTypes.empty() ? nullptr : m_subTypes.front(); }
+
+		// hash of a node with the properties of _type (its sub types are ignored) and the sub type nodes _pSubTypes
+		static Hash64 hash(const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count);
+
+		// shallow comparison: properties of _type (ignoring its sub types) and sub type nodes by pointer
+		bool equals(const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count) const;
+
+	private:
+		Type m_type;
+		Instruction* m_pInstr = nullptr; // first declaration
+		Vector<Instruction*> m_duplicates; // further declarations sharing this node, one of them takes over if m_pInstr is removed
+		Hash64 m_hash = 0u;
+		SmallVector<const TypeNode*, 2u> m_subTypes;
+		unsigned int m_parents = 0u; // number of sub type references from other nodes, the node is kept without instruction while > 0
+	};
+} // !spvgentwo
@@ -206,7 +206,7 @@ namespace spvgentwo
 			return false;
 		}
 
-		T* pNewData = reinterpret_cast<T*>(m_pAllocator->allocate(_size * sizeof(T)));
+		T* pNewData = reinterpret_cast<T*>(m_pAllocator->allocate(_size * sizeof(T), alignof(T)));
 
 		if (pNewData == nullptr)
 		{
@@ -246,29 +246,29 @@ namespace spvgentwo
 	template<class U>
 	inline bool Vector<U>::resize(sgt_size_t _size, const T* _pInitValue)
 	{
-		if (_size > m_capacity)
+		if (reserve(_size) == false)
 		{
-			if (reserve(_size) == false)
-			{
-				return false;
-			}
+			return false;
+		}
 
+		if (_size > m_elements)
+		{
 			if (_pInitValue == nullptr)
 			{
-				for (sgt_size_t i = m_elements; i < m_capacity; ++i)
+				for (sgt_size_t i = m_elements; i < _size; ++i)
 				{
 					new(m_pData + i) T{};
 				}
 			}
 			else if constexpr(stdrep::is_constructible_v<T, const T&>)
 			{
-				for (sgt_size_t i = m_elements; i < m_capacity; ++i)
+				for (sgt_size_t i = m_elements; i < _size; ++i)
 				{
 					new(m_pData + i) T{*_pInitValue };
 				}
 			}
 		}
-		else if (_size < m_elements) // shrink
+		else // shrink
 		{
 			// destruct shrinke elements
 			for (sgt_size_t i = _size; i < m_elements; ++i)
@@ -277,7 +277,7 @@ namespace spvgentwo
 			}
 		}
 
-		m_elements = m_capacity;
+		m_elements = _size;
 
 		return true;
 	}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "stdreplacement.h"
+
 namespace spvgentwo
 {
 	class IWriter
@@ -7,5 +9,59 @@ namespace spvgentwo
 	public:
 		// append spv word to the output stream
 		virtual void put(unsigned int word) = 0;
+
+		// append _count spv words to the output stream
+		virtual void write(const unsigned int* _pWords, sgt_size_t _count)
+		{
+			for (sgt_size_t i = 0u; i < _count; ++i)
+			{
+				put(_pWords[i]);
+			}
+		}
+	};
+
+	// writes to a word buffer of fixed size owned by the caller, words exceeding the buffer are dropped
+	class BinaryBufferWriter : public IWriter
+	{
+	public:
+		BinaryBufferWriter(unsigned int* _pWords = nullptr, sgt_size_t _wordCount = 0u) : m_pWords(_pWords), m_wordCount(_wordCount) {}
+
+		void put(unsigned int _word) final
+		{
+			if (m_position != m_wordCount)
+			{
+				m_pWords[m_position++] = _word;
+			}
+			else
+			{
+				m_overflow = true;
+			}
+		}
+
+		void write(const unsigned int* _pWords, sgt_size_t _count) final
+		{
+			if (_count > m_wordCount - m_position)
+			{
+				_count = m_wordCount - m_position;
+				m_overflow = true;
+			}
+
+			for (sgt_size_t i = 0u; i < _count; ++i)
+			{
+				m_pWords[m_position++] = _pWords[i];
+			}
+		}
+
+		// number of words written so far
+		sgt_size_t position() const { return m_position; }
+
+		// true if words were dropped because the buffer was full
+		bool overflow() const { return m_overflow; }
+
+	private:
+		unsigned int* m_pWords = nullptr;
+		sgt_size_t m_wordCount = 0u;
+		sgt_size_t m_position = 0u;
+		bool m_overflow = false;
 	};
-} // !spvgentwo
\ No newline at end of file
+} // !spvgentwo
@@ -3,9 +3,188 @@
 #include "spvgentwo/Module.h"
 #include "spvgentwo/Reader.h"
 
+namespace
+{
+	using namespace spvgentwo;
+
+	enum class ValueKind
+	{
+		Pure,
+		Load,
+		SideEffect,
+		None // neither numbered nor invalidating
+	};
+
+	ValueKind getValueKind(const Instruction& _instr)
+	{
+		switch (_instr.getOperation())
+		{
+		case spv::Op::OpNop: // instructions start out as OpNop before they are made
+		case spv::Op::OpLine:
+		case spv::Op::OpNoLine:
+		case spv::Op::OpVariable:
+		case spv::Op::OpSelectionMerge:
+		case spv::Op::OpLoopMerge:
+			return ValueKind::None;
+		case spv::Op::OpLoad:
+		{
+			// volatile loads are not numbered
+			auto it = _instr.getFirstActualOperand();
+			const bool isVolatile = ++it != _instr.end() && it->isLiteral() && (it->getLiteral().value & static_cast<unsigned int>(spv::MemoryAccessMask::Volatile)) != 0u;
+			return isVolatile ? ValueKind::SideEffect : ValueKind::Load;
+		}
+		case spv::Op::OpAccessChain:
+		case spv::Op::OpInBoundsAccessChain:
+		case spv::Op::OpPtrAccessChain:
+		case spv::Op::OpInBoundsPtrAccessChain:
+		case spv::Op::OpSampledImage:
+		case spv::Op::OpImage:
+		case spv::Op::OpConvertFToU:
+		case spv::Op::OpConvertFToS:
+		case spv::Op::OpConvertSToF:
+		case spv::Op::OpConvertUToF:
+		case spv::Op::OpUConvert:
+		case spv::Op::OpSConvert:
+		case spv::Op::OpFConvert:
+		case spv::Op::OpQuantizeToF16:
+		case spv::Op::OpBitcast:
+		case spv::Op::OpVectorExtractDynamic:
+		case spv::Op::OpVectorInsertDynamic:
+		case spv::Op::OpVectorShuffle:
+		case spv::Op::OpCompositeConstruct:
+		case spv::Op::OpCompositeExtract:
+		case spv::Op::OpCompositeInsert:
+		case spv::Op::OpCopyObject:
+		case spv::Op::OpTranspose:
+		case spv::Op::OpSNegate:
+		case spv::Op::OpFNegate:
+		case spv::Op::OpIAdd:
+		case spv::Op::OpFAdd:
+		case spv::Op::OpISub:
+		case spv::Op::OpFSub:
+		case spv::Op::OpIMul:
+		case spv::Op::OpFMul:
+		case spv::Op::OpUDiv:
+		case spv::Op::OpSDiv:
+		case spv::Op::OpFDiv:
+		case spv::Op::OpUMod:
+		case spv::Op::OpSRem:
+		case spv::Op::OpSMod:
+		case spv::Op::OpFRem:
+		case spv::Op::OpFMod:
+		case spv::Op::OpVectorTimesScalar:
+		case spv::Op::OpMatrixTimesScalar:
+		case spv::Op::OpVectorTimesMatrix:
+		case spv::Op::OpMatrixTimesVector:
+		case spv::Op::OpMatrixTimesMatrix:
+		case spv::Op::OpOuterProduct:
+		case spv::Op::OpDot:
+		case spv::Op::OpAny:
+		case spv::Op::OpAll:
+		case spv::Op::OpIsNan:
+		case spv::Op::OpIsInf:
+		case spv::Op::OpLogicalEqual:
+		case spv::Op::OpLogicalNotEqual:
+		case spv::Op::OpLogicalOr:
+		case spv::Op::OpLogicalAnd:
+		case spv::Op::OpLogicalNot:
+		case spv::Op::OpSelect:
+		case spv::Op::OpIEqual:
+		case spv::Op::OpINotEqual:
+		case spv::Op::OpUGreaterThan:
+		case spv::Op::OpSGreaterThan:
+		case spv::Op::OpUGreaterThanEqual:
+		case spv::Op::OpSGreaterThanEqual:
+		case spv::Op::OpULessThan:
+		case spv::Op::OpSLessThan:
+		case spv::Op::OpULessThanEqual:
+		case spv::Op::OpSLessThanEqual:
+		case spv::Op::OpFOrdEqual:
+		case spv::Op::OpFUnordEqual:
+		case spv::Op::OpFOrdNotEqual:
+		case spv::Op::OpFUnordNotEqual:
+		case spv::Op::OpFOrdLessThan:
+		case spv::Op::OpFUnordLessThan:
+		case spv::Op::OpFOrdGreaterThan:
+		case spv::Op::OpFUnordGreaterThan:
+		case spv::Op::OpFOrdLessThanEqual:
+		case spv::Op::OpFUnordLessThanEqual:
+		case spv::Op::OpFOrdGreaterThanEqual:
+		case spv::Op::OpFUnordGreaterThanEqual:
+		case spv::Op::OpShiftRightLogical:
+		case spv::Op::OpShiftRightArithmetic:
+		case spv::Op::OpShiftLeftLogical:
+		case spv::Op::OpBitwiseOr:
+		case spv::Op::OpBitwiseXor:
+		case spv::Op::OpBitwiseAnd:
+		case spv::Op::OpNot:
+		case spv::Op::OpBitFieldInsert:
+		case spv::Op::OpBitFieldSExtract:
+		case spv::Op::OpBitFieldUExtract:
+		case spv::Op::OpBitReverse:
+		case spv::Op::OpBitCount:
+			return ValueKind::Pure;
+		default:
+			return ValueKind::SideEffect; // conservatively assume anything else may write memory
+		}
+	}
+
+	// index of the Result <id> operand which differs between otherwise equivalent instructions
+	unsigned int resultIdIndex(const Instruction& _instr)
+	{
+		return _instr.hasResult() ? (_instr.hasResultType() ? 1u : 0u) : ~0u;
+	}
+
+	Hash64 hashValue(const Instruction& _instr)
+	{
+		FNV1aHasher h;
+		h << _instr.getOperation();
+
+		const unsigned int skip = resultIdIndex(_instr);
+		unsigned int i = 0u;
+		for (const Operand& op : _instr)
+		{
+			if (i++ == skip) continue;
+
+			h << op.type;
+			switch (op.type)
+			{
+			case Operand::Type::Instruction: h << static_cast<const Instruction*>(op.instruction); break;
+			case Operand::Type::BranchTarget: h << static_cast<const BasicBlock*>(op.branchTarget); break;
+			case Operand::Type::Literal: h << op.literal.value; break;
+			case Operand::Type::Id: h << op.id; break;
+			}
+		}
+
+		return h;
+	}
+
+	bool isEquivalent(const Instruction& _left, const Instruction& _right)
+	{
+		if (_left.getOperation() != _right.getOperation() || _left.size() != _right.size())
+		{
+			return false;
+		}
+
+		const unsigned int skip = resultIdIndex(_left);
+		unsigned int i = 0u;
+		for (auto l = _left.begin(), r = _right.begin(), end = _left.end(); l != end; ++l, ++r)
+		{
+			if (i++ != skip && (*l == *r) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+} // anon
+
 spvgentwo::BasicBlock::BasicBlock(Function* _pFunction, const char* _pName) : List(_pFunction->getAllocator()),
 	m_pFunction(_pFunction),
-	m_Label(this)
+	m_Label(this),
+	m_ValueNumbers(_pFunction->getAllocator()),
+	m_NumberedValues(_pFunction->getAllocator())
 {
 	m_Label.opLabel();
 
@@ -18,7 +197,10 @@ spvgentwo::BasicBlock::BasicBlock(Function* _pFunction, const char* _pName) : Li
 spvgentwo::BasicBlock::BasicBlock(Function* _pFunction, BasicBlock&& _other) noexcept :
 	List(stdrep::move(_other)),
 	m_pFunction(_pFunction),
-	m_Label(this)
+	m_Label(this),
+	m_ValueNumbers(stdrep::move(_other.m_ValueNumbers)),
+	m_NumberedValues(stdrep::move(_other.m_NumberedValues)),
+	m_memoryVersion(_other.m_memoryVersion)
 {
 	m_Label.opLabel();
 
@@ -37,6 +219,9 @@ spvgentwo::BasicBlock& spvgentwo::BasicBlock::operator=(BasicBlock&& _other) noe
 	if (this == &_other) return *this;
 
 	List::operator=(stdrep::move(_other));
+	m_ValueNumbers = stdrep::move(_other.m_ValueNumbers);
+	m_NumberedValues = stdrep::move(_other.m_NumberedValues);
+	m_memoryVersion = _other.m_memoryVersion;
 
 	for (Instruction& instr : *this)
 	{
@@ -148,10 +333,20 @@ bool spvgentwo::BasicBlock::remove(const Instruction* _pInstr)
 {
 	if(_pInstr != nullptr && this == _pInstr->getBasicBlock())
 	{
+		forgetValueNumber(_pInstr);
+
+		if (empty() == false && &back() == _pInstr) // most recently added instruction
+		{
+			getModule()->removeFromLookupMaps(_pInstr);
+			erase(last());
+			return true;
+		}
+
 		for(auto it = begin(), e = end(); it != e; ++it)
 		{
 			if(it.operator->() == _pInstr)
 			{
+				getModule()->removeFromLookupMaps(_pInstr);
 				erase(it);
 				return true;
 			}
@@ -161,6 +356,91 @@ bool spvgentwo::BasicBlock::remove(const Instruction* _pInstr)
 	return false;
 }
 
+spvgentwo::Instruction* spvgentwo::BasicBlock::numberValue(Instruction* _pInstr)
+{
+	const ValueKind kind = getValueKind(*_pInstr);
+
+	if (kind == ValueKind::SideEffect)
+	{
+		++m_memoryVersion;
+		return _pInstr;
+	}
+	else if (kind == ValueKind::None)
+	{
+		return _pInstr;
+	}
+
+	const unsigned int version = kind == ValueKind::Load ? m_memoryVersion : 0u;
+	const Hash64 h = hashValue(*_pInstr);
+
+	for (auto& node : m_ValueNumbers.getRange(h))
+	{
+		const ValueNumber& vn = node.kv.value;
+		if (vn.pInstr == _pInstr)
+		{
+			return _pInstr; // already numbered
+		}
+		if (vn.memoryVersion == version && isEquivalent(*vn.pInstr, *_pInstr))
+		{
+			return vn.pInstr;
+		}
+	}
+
+	m_ValueNumbers.emplace(h, ValueNumber{ _pInstr, version });
+	m_NumberedValues.emplaceUnique(static_cast<const Instruction*>(_pInstr), h);
+
+	return _pInstr;
+}
+
+void spvgentwo::BasicBlock::clearValueNumbers()
+{
+	m_ValueNumbers.clear();
+	m_NumberedValues.clear();
+	m_memoryVersion = 0u;
+}
+
+bool spvgentwo::BasicBlock::moveInstructionsAfter(const Instruction* _pInstr, BasicBlock& _target)
+{
+	auto it = find_if([_pInstr](const Instruction& _instr) { return &_instr == _pInstr; });
+	if (it == end())
+	{
+		return false;
+	}
+
+	for (Entry<Instruction>* pEntry = it.entry()->next(); pEntry != nullptr;)
+	{
+		Entry<Instruction>* pNext = erase(Iterator(pEntry), false);
+		pEntry->inner().m_parent.pBasicBlock = &_target;
+		_target.append_entry(pEntry);
+		pEntry = pNext;
+	}
+
+	clearValueNumbers();
+	_target.clearValueNumbers();
+
+	return true;
+}
+
+void spvgentwo::BasicBlock::forgetValueNumber(const Instruction* _pInstr)
+{
+	const Hash64* pHash = m_NumberedValues.get(_pInstr);
+	if (pHash == nullptr)
+	{
+		return;
+	}
+
+	for (auto& node : m_ValueNumbers.getRange(*pHash))
+	{
+		if (node.kv.value.pInstr == _pInstr)
+		{
+			m_ValueNumbers.erase(node.kv.key, &node.kv.value);
+			break;
+		}
+	}
+
+	m_NumberedValues.erase(hash(_pInstr), pHash);
+}
+
 spvgentwo::BasicBlock& spvgentwo::BasicBlock::If(Instruction* _pCondition, BasicBlock& _trueBlock, BasicBlock& _falseBlock, BasicBlock* _pMergeBlock, const Flag<spv::SelectionControlMask> _mask)
 {
 	// this block has not been terminated yet
@@ -52,7 +52,7 @@ spvgentwo::Constant& spvgentwo::Constant::operator=(Constant&& _other) noexcept
 	return *this;
 }
 
-spvgentwo::Constant& spvgentwo::Constant::Component()
+spvgentwo::Constant* spvgentwo::Constant::Component()
 {
 	return m_Components.emplace_back(m_Components.getAllocator());
 }
@@ -0,0 +1,382 @@
+#include "spvgentwo/ConstantFolding.h"
+#include "spvgentwo/Module.h"
+
+namespace
+{
+	using namespace spvgentwo;
+
+	using Bits = unsigned long long;
+
+	constexpr unsigned int MaxComponents = 16u; // Vector16
+
+	struct Components
+	{
+		Bits values[MaxComponents]{};
+		unsigned int count = 0u;
+	};
+
+	bool getScalar(const Constant& _const, Bits& _out)
+	{
+		switch (_const.getOperation())
+		{
+		case spv::Op::OpConstantTrue:
+			_out = 1u;
+			return true;
+		case spv::Op::OpConstantFalse:
+			_out = 0u;
+			return true;
+		case spv::Op::OpConstant:
+		{
+			const auto& data = _const.getData();
+			if (data.size() == 1u)
+			{
+				_out = data[0];
+				return true;
+			}
+			else if (data.size() == 2u)
+			{
+				_out = (static_cast<Bits>(data[1]) << 32u) | data[0];
+				return true;
+			}
+			return false;
+		}
+		default:
+			return false; // spec constants must not be folded
+		}
+	}
+
+	bool getComponents(const Constant& _const, Components& _out)
+	{
+		if (_const.getOperation() != spv::Op::OpConstantComposite)
+		{
+			_out.count = 1u;
+			return getScalar(_const, _out.values[0]);
+		}
+
+		const Vector<Constant>& components = _const.getComponents();
+		if (components.empty() || components.size() > MaxComponents)
+		{
+			return false;
+		}
+
+		for (const Constant& c : components)
+		{
+			if (getScalar(c, _out.values[_out.count++]) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	unsigned int getWidth(const Type& _scalar)
+	{
+		return _scalar.isInt() ? _scalar.getIntWidth() : (_scalar.isFloat() ? _scalar.getFloatWidth() : 1u);
+	}
+
+	Bits mask(const Bits _value, const unsigned int _width)
+	{
+		return _width < 64u ? _value & ((Bits(1u) << _width) - 1u) : _value;
+	}
+
+	long long toSigned(const Bits _value, const unsigned int _width)
+	{
+		if (_width >= 64u)
+		{
+			return static_cast<long long>(_value);
+		}
+		const Bits sign = Bits(1u) << (_width - 1u);
+		return static_cast<long long>((mask(_value, _width) ^ sign) - sign);
+	}
+
+	double toFloat(const Bits _value, const unsigned int _width)
+	{
+		if (_width == 32u)
+		{
+			const unsigned int word = static_cast<unsigned int>(_value);
+			return *reinterpret_cast<const float*>(&word);
+		}
+		return *reinterpret_cast<const double*>(&_value);
+	}
+
+	Bits fromFloat(const double _value, const unsigned int _width)
+	{
+		if (_width == 32u)
+		{
+			const float f = static_cast<float>(_value);
+			return *reinterpret_cast<const unsigned int*>(&f);
+		}
+		return *reinterpret_cast<const Bits*>(&_value);
+	}
+
+	bool isNaN(const double _value) { return _value != _value; }
+
+	// _l and _r are components of the operand type _scalar
+	bool evaluate(const spv::Op _op, const Type& _scalar, const Bits _l, const Bits _r, Bits& _out)
+	{
+		const unsigned int width = getWidth(_scalar);
+
+		if (_scalar.isFloat())
+		{
+			if (width != 32u && width != 64u)
+			{
+				return false; // half precision is not evaluated on the host
+			}
+
+			const double l = toFloat(_l, width), r = toFloat(_r, width);
+			const bool unordered = isNaN(l) || isNaN(r);
+
+			switch (_op)
+			{
+			case spv::Op::OpFAdd: _out = fromFloat(l + r, width); return true;
+			case spv::Op::OpFSub: _out = fromFloat(l - r, width); return true;
+			case spv::Op::OpFMul:
+			case spv::Op::OpVectorTimesScalar: _out = fromFloat(l * r, width); return true;
+			case spv::Op::OpFDiv:
+				if (r == 0.0) return false;
+				_out = fromFloat(l / r, width); return true;
+			case spv::Op::OpFNegate: _out = fromFloat(-l, width); return true;
+			case spv::Op::OpFOrdEqual: _out = !unordered && l == r; return true;
+			case spv::Op::OpFOrdNotEqual: _out = !unordered && l != r; return true;
+			case spv::Op::OpFOrdLessThan: _out = !unordered && l < r; return true;
+			case spv::Op::OpFOrdGreaterThan: _out = !unordered && l > r; return true;
+			case spv::Op::OpFOrdLessThanEqual: _out = !unordered && l <= r; return true;
+			case spv::Op::OpFOrdGreaterThanEqual: _out = !unordered && l >= r; return true;
+			case spv::Op::OpFUnordEqual: _out = unordered || l == r; return true;
+			case spv::Op::OpFUnordNotEqual: _out = unordered || l != r; return true;
+			case spv::Op::OpFUnordLessThan: _out = unordered || l < r; return true;
+			case spv::Op::OpFUnordGreaterThan: _out = unordered || l > r; return true;
+			case spv::Op::OpFUnordLessThanEqual: _out = unordered || l <= r; return true;
+			case spv::Op::OpFUnordGreaterThanEqual: _out = unordered || l >= r; return true;
+			default: return false;
+			}
+		}
+
+		const Bits ul = mask(_l, width), ur = mask(_r, width);
+		const long long sl = toSigned(_l, width), sr = toSigned(_r, width);
+		const long long sMin = toSigned(Bits(1u) << (width - 1u), width);
+
+		switch (_op)
+		{
+		case spv::Op::OpIAdd: _out = ul + ur; return true;
+		case spv::Op::OpISub: _out = ul - ur; return true;
+		case spv::Op::OpIMul: _out = ul * ur; return true;
+		case spv::Op::OpSNegate: _out = Bits(0u) - ul; return true;
+		case spv::Op::OpNot: _out = ~ul; return true;
+		case spv::Op::OpUDiv:
+			if (ur == 0u) return false;
+			_out = ul / ur; return true;
+		case spv::Op::OpUMod:
+			if (ur == 0u) return false;
+			_out = ul % ur; return true;
+		case spv::Op::OpSDiv:
+		case spv::Op::OpSRem:
+		case spv::Op::OpSMod:
+		{
+			if (sr == 0 || (sl == sMin && sr == -1)) return false; // undefined
+			if (_op == spv::Op::OpSDiv) { _out = static_cast<Bits>(sl / sr); return true; }
+			long long rem = sl % sr;
+			if (_op == spv::Op::OpSMod && rem != 0 && ((rem < 0) != (sr < 0))) rem += sr; // sign of divisor
+			_out = static_cast<Bits>(rem);
+			return true;
+		}
+		case spv::Op::OpShiftLeftLogical:
+			if (ur >= width) return false;
+			_out = ul << ur; return true;
+		case spv::Op::OpShiftRightLogical:
+			if (ur >= width) return false;
+			_out = ul >> ur; return true;
+		case spv::Op::OpShiftRightArithmetic:
+			if (ur >= width) return false;
+			_out = static_cast<Bits>(sl >> ur); return true;
+		case spv::Op::OpBitwiseOr: _out = ul | ur; return true;
+		case spv::Op::OpBitwiseXor: _out = ul ^ ur; return true;
+		case spv::Op::OpBitwiseAnd: _out = ul & ur; return true;
+		case spv::Op::OpIEqual:
+		case spv::Op::OpLogicalEqual: _out = ul == ur; return true;
+		case spv::Op::OpINotEqual:
+		case spv::Op::OpLogicalNotEqual: _out = ul != ur; return true;
+		case spv::Op::OpLogicalOr: _out = ul || ur; return true;
+		case spv::Op::OpLogicalAnd: _out = ul && ur; return true;
+		case spv::Op::OpLogicalNot: _out = !ul; return true;
+		case spv::Op::OpUGreaterThan: _out = ul > ur; return true;
+		case spv::Op::OpUGreaterThanEqual: _out = ul >= ur; return true;
+		case spv::Op::OpULessThan: _out = ul < ur; return true;
+		case spv::Op::OpULessThanEqual: _out = ul <= ur; return true;
+		case spv::Op::OpSGreaterThan: _out = sl > sr; return true;
+		case spv::Op::OpSGreaterThanEqual: _out = sl >= sr; return true;
+		case spv::Op::OpSLessThan: _out = sl < sr; return true;
+		case spv::Op::OpSLessThanEqual: _out = sl <= sr; return true;
+		default: return false;
+		}
+	}
+
+	void makeScalar(Constant& _out, const Type& _scalar, const Bits _value)
+	{
+		if (_scalar.isBool())
+		{
+			_out.make(_value != 0u);
+			return;
+		}
+
+		_out.setOperation(spv::Op::OpConstant);
+		_out.getType() = _scalar;
+
+		const unsigned int width = getWidth(_scalar);
+		if (width > 32u)
+		{
+			_out.addData(_value);
+		}
+		else // narrower types are zero padded to a full word, matching Constant::make
+		{
+			_out.addData(static_cast<unsigned int>(mask(_value, width)));
+		}
+	}
+} // anon
+
+spvgentwo::Instruction* spvgentwo::foldConstant(const Instruction& _instr)
+{
+	switch (_instr.getOperation())
+	{
+	case spv::Op::OpSNegate:
+	case spv::Op::OpFNegate:
+	case spv::Op::OpNot:
+	case spv::Op::OpLogicalNot:
+	case spv::Op::OpIAdd:
+	case spv::Op::OpFAdd:
+	case spv::Op::OpISub:
+	case spv::Op::OpFSub:
+	case spv::Op::OpIMul:
+	case spv::Op::OpFMul:
+	case spv::Op::OpUDiv:
+	case spv::Op::OpSDiv:
+	case spv::Op::OpFDiv:
+	case spv::Op::OpUMod:
+	case spv::Op::OpSRem:
+	case spv::Op::OpSMod:
+	case spv::Op::OpVectorTimesScalar:
+	case spv::Op::OpLogicalEqual:
+	case spv::Op::OpLogicalNotEqual:
+	case spv::Op::OpLogicalOr:
+	case spv::Op::OpLogicalAnd:
+	case spv::Op::OpIEqual:
+	case spv::Op::OpINotEqual:
+	case spv::Op::OpUGreaterThan:
+	case spv::Op::OpSGreaterThan:
+	case spv::Op::OpUGreaterThanEqual:
+	case spv::Op::OpSGreaterThanEqual:
+	case spv::Op::OpULessThan:
+	case spv::Op::OpSLessThan:
+	case spv::Op::OpULessThanEqual:
+	case spv::Op::OpSLessThanEqual:
+	case spv::Op::OpFOrdEqual:
+	case spv::Op::OpFUnordEqual:
+	case spv::Op::OpFOrdNotEqual:
+	case spv::Op::OpFUnordNotEqual:
+	case spv::Op::OpFOrdLessThan:
+	case spv::Op::OpFUnordLessThan:
+	case spv::Op::OpFOrdGreaterThan:
+	case spv::Op::OpFUnordGreaterThan:
+	case spv::Op::OpFOrdLessThanEqual:
+	case spv::Op::OpFUnordLessThanEqual:
+	case spv::Op::OpFOrdGreaterThanEqual:
+	case spv::Op::OpFUnordGreaterThanEqual:
+	case spv::Op::OpShiftRightLogical:
+	case spv::Op::OpShiftRightArithmetic:
+	case spv::Op::OpShiftLeftLogical:
+	case spv::Op::OpBitwiseOr:
+	case spv::Op::OpBitwiseXor:
+	case spv::Op::OpBitwiseAnd:
+		break;
+	default:
+		return nullptr;
+	}
+
+	Module* pModule = _instr.getModule();
+	const Type* pResultType = _instr.getType();
+
+	if (pModule == nullptr || pResultType == nullptr)
+	{
+		return nullptr;
+	}
+
+	const Constant* operands[2]{};
+	unsigned int count = 0u;
+
+	for (auto it = _instr.getFirstActualOperand(), end = _instr.end(); it != end; ++it)
+	{
+		if (count == 2u)
+		{
+			return nullptr;
+		}
+
+		operands[count] = pModule->getConstantInfo(it->getInstruction());
+		if (operands[count++] == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	if (count == 0u)
+	{
+		return nullptr;
+	}
+
+	Components left, right;
+	if (getComponents(*operands[0], left) == false || (count == 2u && getComponents(*operands[1], right) == false))
+	{
+		return nullptr;
+	}
+
+	// OpVectorTimesScalar broadcasts its scalar operand
+	const bool broadcast = count == 2u && right.count == 1u;
+	if (count == 2u && broadcast == false && right.count != left.count)
+	{
+		return nullptr;
+	}
+
+	const Type& operandType = operands[0]->getType();
+	const Type& scalarOperandType = operandType.isVector() ? operandType.front() : operandType;
+	const Type& scalarResultType = pResultType->isVector() ? pResultType->front() : *pResultType;
+
+	if (pResultType->isVector() && pResultType->getVectorComponentCount() != left.count)
+	{
+		return nullptr;
+	}
+
+	Bits results[MaxComponents]{};
+	for (unsigned int i = 0u; i < left.count; ++i)
+	{
+		const Bits r = count == 2u ? right.values[broadcast ? 0u : i] : 0u;
+		if (evaluate(_instr.getOperation(), scalarOperandType, left.values[i], r, results[i]) == false)
+		{
+			return nullptr;
+		}
+	}
+
+	Constant result(pModule->getAllocator());
+
+	if (pResultType->isVector())
+	{
+		result.setOperation(spv::Op::OpConstantComposite);
+		result.getType() = *pResultType;
+		result.getComponents().reserve(left.count);
+
+		for (unsigned int i = 0u; i < left.count; ++i)
+		{
+			Constant* pComponent = result.Component();
+			if (pComponent == nullptr)
+			{
+				return nullptr;
+			}
+			makeScalar(*pComponent, scalarResultType, results[i]);
+		}
+	}
+	else
+	{
+		makeScalar(result, scalarResultType, results[0]);
+	}
+
+	return pModule->addConstant(result);
+}
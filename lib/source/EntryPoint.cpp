@@ -11,7 +11,7 @@ spvgentwo::EntryPoint::~EntryPoint()
 {
 }
 
-void spvgentwo::EntryPoint::getGlobalVariableInterface(List<Operand>& _outVarInstr, const GlobalInterfaceVersion _version) const
+void spvgentwo::EntryPoint::getGlobalVariableInterface(OperandContainer& _outVarInstr, const GlobalInterfaceVersion _version) const
 {
 	struct VisitedBB
 	{
@@ -102,8 +102,18 @@ void spvgentwo::EntryPoint::finalizeGlobalInterface(const GlobalInterfaceVersion
 {
 	if (m_finalized == false)
 	{
-		getGlobalVariableInterface(m_EntryPoint, _version);
-		
+		OperandContainer vars(m_pAllocator);
+		getGlobalVariableInterface(vars, _version);
+
+		// add through addOperand so the uses are registered in the def-use index
+		for (const Operand& var : vars)
+		{
+			if (m_EntryPoint.contains(var) == false)
+			{
+				m_EntryPoint.addOperand(var);
+			}
+		}
+
 		m_finalized = true;
 	}
 }
@@ -67,6 +67,28 @@ void spvgentwo::Function::write(IWriter* _pWriter)
 	m_FunctionEnd.write(_pWriter);
 }
 
+spvgentwo::sgt_size_t spvgentwo::Function::getWordCount() const
+{
+	sgt_size_t count = m_Function.getWordCount() + m_FunctionEnd.getWordCount();
+
+	for (const Instruction& instr : m_Parameters)
+	{
+		count += instr.getWordCount();
+	}
+
+	for (const BasicBlock& bb : *this)
+	{
+		count += bb.getLabel()->getWordCount();
+
+		for (const Instruction& instr : bb)
+		{
+			count += instr.getWordCount();
+		}
+	}
+
+	return count;
+}
+
 bool spvgentwo::Function::read(IReader* _pReader, const Grammar& _grammar, Instruction&& _opFunc)
 {
 	// module already consumed OpFunction
@@ -115,11 +137,22 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Function::remove(const Basic
 
 	const Instruction* opLabel = _pBB->getLabel();
 
-	bool found = false;
+	bool found = false, tracked = false;
 	for (auto it = begin(); it != end(); ++it) 
 	{
 		if (it.operator->() == _pBB)
 		{
+			for (const Instruction& instr : *it)
+			{
+				module->removeFromLookupMaps(&instr);
+			}
+
+			// only uses outside of the block remain
+			const Operand replacement(_pReplacement);
+			tracked = module->gatherTrackedUses(opLabel, &uses, &replacement, true);
+
+			module->removeFromLookupMaps(opLabel);
+
 			erase(it);
 			found = true;
 			break;
@@ -132,15 +165,25 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Function::remove(const Basic
 		return uses;
 	}
 
+	if (tracked)
+	{
+		return uses;
+	}
+
 	auto gatherUse = [opLabel, _pBB, _pReplacement, &uses](Instruction& instr)
 	{
 		for (auto it = instr.getFirstActualOperand(), end = instr.end(); it != end; ++it)
 		{
-			if (*it == _pBB || *it == opLabel)
+			if (*it == _pBB)
 			{
 				uses.emplace_back(&instr);
 				*it = _pReplacement;
 			}
+			else if (*it == opLabel)
+			{
+				uses.emplace_back(&instr);
+				*it = _pReplacement != nullptr ? _pReplacement->getLabel() : static_cast<Instruction*>(nullptr);
+			}
 		}
 	};
 
@@ -210,4 +253,322 @@ spvgentwo::Instruction* spvgentwo::Function::finalize(const Flag<spv::FunctionCo
 	}
 
 	return pFunc;
-}
\ No newline at end of file
+}
+
+unsigned int spvgentwo::Function::removeRedundantInstructions()
+{
+	IAllocator* pAllocator = getAllocator();
+
+	// decorations like NoContraction or RelaxedPrecision make equivalent looking instructions differ
+	HashMap<const Instruction*, bool> keep(pAllocator);
+	for (const Instruction& decoration : m_pModule->getDecorations())
+	{
+		if (decoration.empty() == false && decoration.front().isInstruction())
+		{
+			keep.emplaceUnique(static_cast<const Instruction*>(decoration.front().getInstruction()), true);
+		}
+	}
+
+	HashMap<const Instruction*, Instruction*> replacements(pAllocator);
+
+	auto remap = [this, &replacements](Instruction& _instr)
+	{
+		bool changed = false;
+		for (Operand& op : _instr)
+		{
+			if (op.isInstruction())
+			{
+				if (Instruction** ppReplacement = replacements.get(static_cast<const Instruction*>(op.instruction)); ppReplacement != nullptr)
+				{
+					op.instruction = *ppReplacement;
+					changed = true;
+				}
+			}
+		}
+
+		if (changed)
+		{
+			m_pModule->updateUses(&_instr); // operands were assigned directly
+		}
+	};
+
+	unsigned int removed = 0u;
+
+	for (BasicBlock& bb : *this)
+	{
+		bb.clearValueNumbers();
+
+		for (auto it = bb.begin(); it != bb.end();)
+		{
+			Instruction* pInstr = it.operator->();
+
+			if (replacements.elements() != 0u)
+			{
+				remap(*pInstr);
+			}
+
+			Instruction* pValue = bb.numberValue(pInstr);
+
+			if (pValue != pInstr && keep.get(static_cast<const Instruction*>(pInstr)) == nullptr && pInstr->getName() == nullptr)
+			{
+				replacements.emplaceUnique(static_cast<const Instruction*>(pInstr), pValue);
+				m_pModule->removeFromLookupMaps(pInstr);
+				it = bb.erase(it);
+				++removed;
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		bb.clearValueNumbers();
+	}
+
+	if (removed != 0u)
+	{
+		// uses in blocks preceding the definition (e.g. OpPhi of loop headers)
+		for (BasicBlock& bb : *this)
+		{
+			for (Instruction& instr : bb)
+			{
+				remap(instr);
+			}
+		}
+	}
+
+	return removed;
+}
+
+bool spvgentwo::Function::inlineCall(Instruction* _pCall)
+{
+	if (_pCall == nullptr || *_pCall != spv::Op::OpFunctionCall || _pCall->getFunction() != this)
+	{
+		m_pModule->logError("_pCall is not an OpFunctionCall of this function");
+		return false;
+	}
+
+	auto arg = _pCall->getFirstActualOperand();
+	const Instruction* pOpFunction = arg->getInstruction();
+	Function* pCallee = pOpFunction != nullptr ? pOpFunction->getFunction() : nullptr;
+
+	// imported functions have no body
+	if (pCallee == nullptr || pCallee == this || pCallee->empty())
+	{
+		return false;
+	}
+
+	BasicBlock* pCallBB = _pCall->getBasicBlock();
+
+	// OpLoopMerge must stay in the header targeted by the back edge
+	if (pCallBB->find_if([](const Instruction& _instr) { return _instr == spv::Op::OpLoopMerge; }) != pCallBB->end())
+	{
+		return false;
+	}
+
+	unsigned int returns = 0u;
+	for (const BasicBlock& bb : *pCallee)
+	{
+		if (const Instruction* pTerm = bb.getTerminator(); pTerm != nullptr && (*pTerm == spv::Op::OpReturn || *pTerm == spv::Op::OpReturnValue))
+		{
+			++returns;
+		}
+	}
+
+	bool structured = false;
+	for (const Instruction& cap : m_pModule->getCapabilities())
+	{
+		structured |= cap.empty() == false && cap.front().getLiteral() == static_cast<unsigned int>(spv::Capability::Shader);
+	}
+
+	// early returns would leave structured constructs
+	if (returns == 0u || (returns > 1u && structured))
+	{
+		return false;
+	}
+
+	IAllocator* pAllocator = getAllocator();
+
+	HashMap<const Instruction*, Instruction*> values(pAllocator);
+	HashMap<const BasicBlock*, BasicBlock*> blocks(pAllocator);
+
+	// parameters are replaced by the call arguments
+	++arg;
+	for (const Instruction& param : pCallee->getParameters())
+	{
+		if (arg == _pCall->end())
+		{
+			m_pModule->logError("Argument count of OpFunctionCall does not match the callee");
+			return false;
+		}
+		values.emplaceUnique(&param, arg->getInstruction());
+		++arg;
+	}
+
+	Iterator callBB = find_if([pCallBB](const BasicBlock& _bb) { return &_bb == pCallBB; });
+
+	// instructions following the call continue in a new block
+	BasicBlock& cont = insert_after(callBB, this)->inner();
+	pCallBB->moveInstructionsAfter(_pCall, cont);
+
+	for (BasicBlock& bb : *this)
+	{
+		for (Instruction& instr : bb)
+		{
+			if (instr == spv::Op::OpPhi)
+			{
+				bool changed = false;
+				for (Operand& op : instr)
+				{
+					if (op == pCallBB)
+					{
+						op.branchTarget = &cont;
+						changed = true;
+					}
+				}
+
+				if (changed)
+				{
+					m_pModule->updateUses(&instr); // parents were assigned directly
+				}
+			}
+		}
+	}
+
+	// clone blocks in callee order between the call and its continuation
+	Iterator pos = callBB;
+	for (const BasicBlock& bb : *pCallee)
+	{
+		pos = Iterator(insert_after(pos, this));
+		blocks.emplaceUnique(&bb, pos.operator->());
+		values.emplaceUnique(bb.getLabel(), pos->getLabel());
+	}
+
+	BasicBlock& entry = front();
+	BasicBlock* pCalleeEntry = *blocks.get(static_cast<const BasicBlock*>(&pCallee->front()));
+
+	Vector<const Instruction*> sources(pAllocator);
+	Vector<Instruction*> clones(pAllocator);
+	Vector<Instruction*> returnValues(pAllocator);
+	Vector<BasicBlock*> returnBlocks(pAllocator);
+
+	// first create all clones so that forward references (OpPhi, branches) can be remapped
+	for (const BasicBlock& bb : *pCallee)
+	{
+		BasicBlock* pClone = *blocks.get(&bb);
+
+		for (const Instruction& instr : bb)
+		{
+			if (instr == spv::Op::OpReturn || instr == spv::Op::OpReturnValue)
+			{
+				if (instr == spv::Op::OpReturnValue)
+				{
+					returnValues.emplace_back(instr.getFirstActualOperand()->getInstruction());
+					returnBlocks.emplace_back(pClone);
+				}
+				pClone->addInstruction()->opBranch(&cont);
+				continue;
+			}
+
+			// variables must be declared in the first block of the caller
+			Instruction* pNew = instr == spv::Op::OpVariable ? &entry.emplace_front(&entry) : pClone->addInstruction();
+			pNew->setOperation(instr.getOperation());
+
+			values.emplaceUnique(&instr, pNew);
+			sources.emplace_back(&instr);
+			clones.emplace_back(pNew);
+		}
+	}
+
+	auto remap = [&values](Instruction* _pInstr) -> Instruction*
+	{
+		Instruction** ppClone = values.get(static_cast<const Instruction*>(_pInstr));
+		return ppClone != nullptr ? *ppClone : _pInstr;
+	};
+
+	for (sgt_size_t i = 0u; i < sources.size(); ++i)
+	{
+		const Instruction& src = *sources[i];
+		Instruction* pNew = clones[i];
+
+		const unsigned int resultIndex = src.hasResult() ? (src.hasResultType() ? 1u : 0u) : ~0u;
+		unsigned int index = 0u;
+
+		for (const Operand& op : src)
+		{
+			if (src == spv::Op::OpVariable && index == 3u)
+			{
+				// initializers are applied each time the callee is entered
+				pCalleeEntry->emplace_front(pCalleeEntry).opStore(pNew, remap(op.getInstruction()));
+				break;
+			}
+
+			if (index++ == resultIndex)
+			{
+				pNew->addOperand(InvalidId);
+			}
+			else if (op.isInstruction())
+			{
+				pNew->addOperand(remap(op.getInstruction()));
+			}
+			else if (BasicBlock** ppTarget = op.isBranchTarget() ? blocks.get(static_cast<const BasicBlock*>(op.getBranchTarget())) : nullptr; ppTarget != nullptr)
+			{
+				pNew->addOperand(*ppTarget);
+			}
+			else
+			{
+				pNew->addOperand(op);
+			}
+		}
+	}
+
+	// decorations (e.g. NoContraction) apply to the clones as well
+	Vector<const Instruction*> decorations(pAllocator);
+	for (const Instruction& deco : m_pModule->getDecorations())
+	{
+		const Instruction* pTarget = deco.empty() ? nullptr : deco.front().getInstruction();
+		if (deco == spv::Op::OpDecorate && pTarget != nullptr && pTarget->getBasicBlock() != nullptr && pTarget->getFunction() == pCallee)
+		{
+			decorations.emplace_back(&deco);
+		}
+	}
+	for (const Instruction* pDeco : decorations)
+	{
+		Instruction* pNew = m_pModule->addDecorationInstr();
+		pNew->setOperation(spv::Op::OpDecorate);
+		for (const Operand& op : *pDeco)
+		{
+			pNew->addOperand(op.isInstruction() ? Operand(remap(op.getInstruction())) : op);
+		}
+	}
+
+	Instruction* pResult = nullptr;
+	if (returnValues.size() == 1u)
+	{
+		pResult = remap(returnValues[0]);
+	}
+	else if (returnValues.size() > 1u)
+	{
+		pResult = &cont.emplace_front(&cont);
+		pResult->setOperation(spv::Op::OpPhi);
+		pResult->addOperand(_pCall->getTypeInstr());
+		pResult->addOperand(InvalidId);
+		for (sgt_size_t i = 0u; i < returnValues.size(); ++i)
+		{
+			pResult->addOperand(remap(returnValues[i]));
+			pResult->addOperand(returnBlocks[i]);
+		}
+	}
+
+	// every block needs its terminator before the module can be iterated by replaceUses
+	pCallBB->addInstruction()->opBranch(pCalleeEntry);
+
+	if (pResult != nullptr)
+	{
+		m_pModule->replaceUses(_pCall, pResult);
+	}
+
+	pCallBB->remove(_pCall);
+
+	return true;
+}
@@ -4,6157 +4,7354 @@
 #include "spvgentwo/OpenCl.h"
 using namespace spvgentwo;
 
-Grammar::Grammar(IAllocator* _pAllocator) : m_instructions(_pAllocator, 796), m_operandNames(_pAllocator, 720)
+namespace
 {
-	m_instructions.emplaceUnique(Hash64(0u, 0u), Instruction{"OpNop", _pAllocator, _pAllocator, _pAllocator, 0});
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(1u, 0u), Instruction{"OpUndef", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(2u, 0u), Instruction{"OpSourceContinued", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Continued Source'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(3u, 0u), Instruction{"OpSource", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::SourceLanguage, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Version'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'File'",Quantifier::ZeroOrOne);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Source'",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4u, 0u), Instruction{"OpSourceExtension", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Extension'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5u, 0u), Instruction{"OpName", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Name'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6u, 0u), Instruction{"OpMemberName", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Member'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Name'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(7u, 0u), Instruction{"OpString", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'String'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(8u, 0u), Instruction{"OpLine", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'File'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Line'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Column'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(10u, 0u), Instruction{"OpExtension", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Name'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(11u, 0u), Instruction{"OpExtInstImport", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Name'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(12u, 0u), Instruction{"OpExtInst", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Set'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralExtInstInteger, OperandCategory::Literal, "'Instruction'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1', +'Operand 2', +...",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(14u, 0u), Instruction{"OpMemoryModel", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::AddressingModel, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryModel, OperandCategory::ValueEnum, "",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(15u, 0u), Instruction{"OpEntryPoint", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::ExecutionModel, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Entry Point'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Name'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Interface'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(16u, 0u), Instruction{"OpExecutionMode", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Entry Point'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ExecutionMode, OperandCategory::ValueEnum, "'Mode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(17u, 0u), Instruction{"OpCapability", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::Capability, OperandCategory::ValueEnum, "'Capability'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(19u, 0u), Instruction{"OpTypeVoid", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(20u, 0u), Instruction{"OpTypeBool", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(21u, 0u), Instruction{"OpTypeInt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Width'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Signedness'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(22u, 0u), Instruction{"OpTypeFloat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Width'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(23u, 0u), Instruction{"OpTypeVector", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Component Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Component Count'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(24u, 0u), Instruction{"OpTypeMatrix", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Column Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Column Count'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(25u, 0u), Instruction{"OpTypeImage", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::Dim, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Depth'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Arrayed'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'MS'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Sampled'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageFormat, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::AccessQualifier, OperandCategory::ValueEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(26u, 0u), Instruction{"OpTypeSampler", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(27u, 0u), Instruction{"OpTypeSampledImage", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image Type'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(28u, 0u), Instruction{"OpTypeArray", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Element Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Length'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(29u, 0u), Instruction{"OpTypeRuntimeArray", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Element Type'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(30u, 0u), Instruction{"OpTypeStruct", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Member 0 type', +'member 1 type', +...",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(31u, 0u), Instruction{"OpTypeOpaque", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "The name of the opaque type.",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(32u, 0u), Instruction{"OpTypePointer", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::StorageClass, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Type'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(33u, 0u), Instruction{"OpTypeFunction", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Return Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Parameter 0 Type', +'Parameter 1 Type', +...",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(34u, 0u), Instruction{"OpTypeEvent", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(35u, 0u), Instruction{"OpTypeDeviceEvent", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(36u, 0u), Instruction{"OpTypeReserveId", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(37u, 0u), Instruction{"OpTypeQueue", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(38u, 0u), Instruction{"OpTypePipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::AccessQualifier, OperandCategory::ValueEnum, "'Qualifier'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(39u, 0u), Instruction{"OpTypeForwardPointer", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::StorageClass, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-		instr.capabilities.emplace_back(spv::Capability::PhysicalStorageBufferAddresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(41u, 0u), Instruction{"OpConstantTrue", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(42u, 0u), Instruction{"OpConstantFalse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(43u, 0u), Instruction{"OpConstant", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralContextDependentNumber, OperandCategory::Literal, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(44u, 0u), Instruction{"OpConstantComposite", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Constituents'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(45u, 0u), Instruction{"OpConstantSampler", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::SamplerAddressingMode, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::SamplerFilterMode, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::LiteralSampler);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(46u, 0u), Instruction{"OpConstantNull", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(48u, 0u), Instruction{"OpSpecConstantTrue", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(49u, 0u), Instruction{"OpSpecConstantFalse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(50u, 0u), Instruction{"OpSpecConstant", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralContextDependentNumber, OperandCategory::Literal, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(51u, 0u), Instruction{"OpSpecConstantComposite", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Constituents'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(52u, 0u), Instruction{"OpSpecConstantOp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralSpecConstantOpInteger, OperandCategory::Literal, "'Opcode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(54u, 0u), Instruction{"OpFunction", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::FunctionControl, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Function Type'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(55u, 0u), Instruction{"OpFunctionParameter", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	m_instructions.emplaceUnique(Hash64(56u, 0u), Instruction{"OpFunctionEnd", _pAllocator, _pAllocator, _pAllocator, 0});
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(57u, 0u), Instruction{"OpFunctionCall", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Function'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Argument 0', +'Argument 1', +...",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(59u, 0u), Instruction{"OpVariable", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::StorageClass, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Initializer'",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(60u, 0u), Instruction{"OpImageTexelPointer", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sample'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(61u, 0u), Instruction{"OpLoad", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(62u, 0u), Instruction{"OpStore", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Object'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(63u, 0u), Instruction{"OpCopyMemory", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Source'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(64u, 0u), Instruction{"OpCopyMemorySized", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Source'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(65u, 0u), Instruction{"OpAccessChain", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Indexes'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(66u, 0u), Instruction{"OpInBoundsAccessChain", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Indexes'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(67u, 0u), Instruction{"OpPtrAccessChain", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Element'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Indexes'",Quantifier::ZeroOrAny);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-		instr.capabilities.emplace_back(spv::Capability::VariablePointers);
-		instr.capabilities.emplace_back(spv::Capability::VariablePointersStorageBuffer);
-		instr.capabilities.emplace_back(spv::Capability::PhysicalStorageBufferAddresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(68u, 0u), Instruction{"OpArrayLength", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Structure'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Array member'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(69u, 0u), Instruction{"OpGenericPtrMemSemantics", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(70u, 0u), Instruction{"OpInBoundsPtrAccessChain", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Element'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Indexes'",Quantifier::ZeroOrAny);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(71u, 0u), Instruction{"OpDecorate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::Decoration, OperandCategory::ValueEnum, "",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(72u, 0u), Instruction{"OpMemberDecorate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Structure Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Member'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::Decoration, OperandCategory::ValueEnum, "",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(73u, 0u), Instruction{"OpDecorationGroup", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(74u, 0u), Instruction{"OpGroupDecorate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Decoration Group'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Targets'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(75u, 0u), Instruction{"OpGroupMemberDecorate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Decoration Group'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::PairIdRefLiteralInteger, OperandCategory::Composite, "'Targets'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(77u, 0u), Instruction{"OpVectorExtractDynamic", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(78u, 0u), Instruction{"OpVectorInsertDynamic", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Component'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(79u, 0u), Instruction{"OpVectorShuffle", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector 2'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Components'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(80u, 0u), Instruction{"OpCompositeConstruct", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Constituents'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(81u, 0u), Instruction{"OpCompositeExtract", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Composite'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Indexes'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(82u, 0u), Instruction{"OpCompositeInsert", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Object'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Composite'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Indexes'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(83u, 0u), Instruction{"OpCopyObject", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(84u, 0u), Instruction{"OpTranspose", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Matrix'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(86u, 0u), Instruction{"OpSampledImage", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampler'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(87u, 0u), Instruction{"OpImageSampleImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(88u, 0u), Instruction{"OpImageSampleExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(89u, 0u), Instruction{"OpImageSampleDrefImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(90u, 0u), Instruction{"OpImageSampleDrefExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(91u, 0u), Instruction{"OpImageSampleProjImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(92u, 0u), Instruction{"OpImageSampleProjExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(93u, 0u), Instruction{"OpImageSampleProjDrefImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(94u, 0u), Instruction{"OpImageSampleProjDrefExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(95u, 0u), Instruction{"OpImageFetch", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(96u, 0u), Instruction{"OpImageGather", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Component'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(97u, 0u), Instruction{"OpImageDrefGather", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(98u, 0u), Instruction{"OpImageRead", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(99u, 0u), Instruction{"OpImageWrite", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Texel'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(100u, 0u), Instruction{"OpImage", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(101u, 0u), Instruction{"OpImageQueryFormat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(102u, 0u), Instruction{"OpImageQueryOrder", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(103u, 0u), Instruction{"OpImageQuerySizeLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Level of Detail'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-		instr.capabilities.emplace_back(spv::Capability::ImageQuery);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(104u, 0u), Instruction{"OpImageQuerySize", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-		instr.capabilities.emplace_back(spv::Capability::ImageQuery);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(105u, 0u), Instruction{"OpImageQueryLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::ImageQuery);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(106u, 0u), Instruction{"OpImageQueryLevels", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-		instr.capabilities.emplace_back(spv::Capability::ImageQuery);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(107u, 0u), Instruction{"OpImageQuerySamples", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-		instr.capabilities.emplace_back(spv::Capability::ImageQuery);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(109u, 0u), Instruction{"OpConvertFToU", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Float Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(110u, 0u), Instruction{"OpConvertFToS", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Float Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(111u, 0u), Instruction{"OpConvertSToF", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Signed Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(112u, 0u), Instruction{"OpConvertUToF", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Unsigned Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(113u, 0u), Instruction{"OpUConvert", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Unsigned Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(114u, 0u), Instruction{"OpSConvert", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Signed Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(115u, 0u), Instruction{"OpFConvert", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Float Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(116u, 0u), Instruction{"OpQuantizeToF16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(117u, 0u), Instruction{"OpConvertPtrToU", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-		instr.capabilities.emplace_back(spv::Capability::PhysicalStorageBufferAddresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(118u, 0u), Instruction{"OpSatConvertSToU", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Signed Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(119u, 0u), Instruction{"OpSatConvertUToS", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Unsigned Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(120u, 0u), Instruction{"OpConvertUToPtr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Integer Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-		instr.capabilities.emplace_back(spv::Capability::PhysicalStorageBufferAddresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(121u, 0u), Instruction{"OpPtrCastToGeneric", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(122u, 0u), Instruction{"OpGenericCastToPtr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(123u, 0u), Instruction{"OpGenericCastToPtrExplicit", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::StorageClass, OperandCategory::ValueEnum, "'Storage'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(124u, 0u), Instruction{"OpBitcast", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(126u, 0u), Instruction{"OpSNegate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(127u, 0u), Instruction{"OpFNegate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(128u, 0u), Instruction{"OpIAdd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(129u, 0u), Instruction{"OpFAdd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(130u, 0u), Instruction{"OpISub", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(131u, 0u), Instruction{"OpFSub", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(132u, 0u), Instruction{"OpIMul", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(133u, 0u), Instruction{"OpFMul", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(134u, 0u), Instruction{"OpUDiv", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(135u, 0u), Instruction{"OpSDiv", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(136u, 0u), Instruction{"OpFDiv", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(137u, 0u), Instruction{"OpUMod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(138u, 0u), Instruction{"OpSRem", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(139u, 0u), Instruction{"OpSMod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(140u, 0u), Instruction{"OpFRem", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(141u, 0u), Instruction{"OpFMod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(142u, 0u), Instruction{"OpVectorTimesScalar", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Scalar'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(143u, 0u), Instruction{"OpMatrixTimesScalar", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Matrix'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Scalar'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(144u, 0u), Instruction{"OpVectorTimesMatrix", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Matrix'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(145u, 0u), Instruction{"OpMatrixTimesVector", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Matrix'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(146u, 0u), Instruction{"OpMatrixTimesMatrix", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'LeftMatrix'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RightMatrix'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(147u, 0u), Instruction{"OpOuterProduct", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(148u, 0u), Instruction{"OpDot", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(149u, 0u), Instruction{"OpIAddCarry", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(150u, 0u), Instruction{"OpISubBorrow", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(151u, 0u), Instruction{"OpUMulExtended", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(152u, 0u), Instruction{"OpSMulExtended", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(154u, 0u), Instruction{"OpAny", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(155u, 0u), Instruction{"OpAll", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Vector'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(156u, 0u), Instruction{"OpIsNan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(157u, 0u), Instruction{"OpIsInf", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(158u, 0u), Instruction{"OpIsFinite", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(159u, 0u), Instruction{"OpIsNormal", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(160u, 0u), Instruction{"OpSignBitSet", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(161u, 0u), Instruction{"OpLessOrGreater", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(162u, 0u), Instruction{"OpOrdered", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(163u, 0u), Instruction{"OpUnordered", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(164u, 0u), Instruction{"OpLogicalEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(165u, 0u), Instruction{"OpLogicalNotEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(166u, 0u), Instruction{"OpLogicalOr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(167u, 0u), Instruction{"OpLogicalAnd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(168u, 0u), Instruction{"OpLogicalNot", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(169u, 0u), Instruction{"OpSelect", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Condition'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Object 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Object 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(170u, 0u), Instruction{"OpIEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(171u, 0u), Instruction{"OpINotEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(172u, 0u), Instruction{"OpUGreaterThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(173u, 0u), Instruction{"OpSGreaterThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(174u, 0u), Instruction{"OpUGreaterThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(175u, 0u), Instruction{"OpSGreaterThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(176u, 0u), Instruction{"OpULessThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(177u, 0u), Instruction{"OpSLessThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(178u, 0u), Instruction{"OpULessThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(179u, 0u), Instruction{"OpSLessThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(180u, 0u), Instruction{"OpFOrdEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(181u, 0u), Instruction{"OpFUnordEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(182u, 0u), Instruction{"OpFOrdNotEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(183u, 0u), Instruction{"OpFUnordNotEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(184u, 0u), Instruction{"OpFOrdLessThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(185u, 0u), Instruction{"OpFUnordLessThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(186u, 0u), Instruction{"OpFOrdGreaterThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(187u, 0u), Instruction{"OpFUnordGreaterThan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(188u, 0u), Instruction{"OpFOrdLessThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(189u, 0u), Instruction{"OpFUnordLessThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(190u, 0u), Instruction{"OpFOrdGreaterThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(191u, 0u), Instruction{"OpFUnordGreaterThanEqual", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(194u, 0u), Instruction{"OpShiftRightLogical", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Shift'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(195u, 0u), Instruction{"OpShiftRightArithmetic", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Shift'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(196u, 0u), Instruction{"OpShiftLeftLogical", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Shift'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(197u, 0u), Instruction{"OpBitwiseOr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(198u, 0u), Instruction{"OpBitwiseXor", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(199u, 0u), Instruction{"OpBitwiseAnd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(200u, 0u), Instruction{"OpNot", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(201u, 0u), Instruction{"OpBitFieldInsert", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Insert'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Count'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(202u, 0u), Instruction{"OpBitFieldSExtract", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Count'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(203u, 0u), Instruction{"OpBitFieldUExtract", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Count'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(204u, 0u), Instruction{"OpBitReverse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(205u, 0u), Instruction{"OpBitCount", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Base'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(207u, 0u), Instruction{"OpDPdx", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(208u, 0u), Instruction{"OpDPdy", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(209u, 0u), Instruction{"OpFwidth", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(210u, 0u), Instruction{"OpDPdxFine", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DerivativeControl);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(211u, 0u), Instruction{"OpDPdyFine", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DerivativeControl);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(212u, 0u), Instruction{"OpFwidthFine", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DerivativeControl);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(213u, 0u), Instruction{"OpDPdxCoarse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DerivativeControl);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(214u, 0u), Instruction{"OpDPdyCoarse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DerivativeControl);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(215u, 0u), Instruction{"OpFwidthCoarse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'P'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DerivativeControl);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(218u, 0u), Instruction{"OpEmitVertex", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::Geometry);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(219u, 0u), Instruction{"OpEndPrimitive", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::Geometry);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(220u, 0u), Instruction{"OpEmitStreamVertex", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Stream'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GeometryStreams);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(221u, 0u), Instruction{"OpEndStreamPrimitive", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Stream'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GeometryStreams);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(224u, 0u), Instruction{"OpControlBarrier", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(225u, 0u), Instruction{"OpMemoryBarrier", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(227u, 0u), Instruction{"OpAtomicLoad", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(228u, 0u), Instruction{"OpAtomicStore", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(229u, 0u), Instruction{"OpAtomicExchange", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(230u, 0u), Instruction{"OpAtomicCompareExchange", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Equal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Unequal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Comparator'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(231u, 0u), Instruction{"OpAtomicCompareExchangeWeak", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Equal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Unequal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Comparator'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(232u, 0u), Instruction{"OpAtomicIIncrement", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(233u, 0u), Instruction{"OpAtomicIDecrement", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(234u, 0u), Instruction{"OpAtomicIAdd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(235u, 0u), Instruction{"OpAtomicISub", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(236u, 0u), Instruction{"OpAtomicSMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(237u, 0u), Instruction{"OpAtomicUMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(238u, 0u), Instruction{"OpAtomicSMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(239u, 0u), Instruction{"OpAtomicUMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(240u, 0u), Instruction{"OpAtomicAnd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(241u, 0u), Instruction{"OpAtomicOr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(242u, 0u), Instruction{"OpAtomicXor", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(245u, 0u), Instruction{"OpPhi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::PairIdRefIdRef, OperandCategory::Composite, "'Variable, Parent, ...'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(246u, 0u), Instruction{"OpLoopMerge", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Merge Block'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Continue Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LoopControl, OperandCategory::BitEnum, "",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(247u, 0u), Instruction{"OpSelectionMerge", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Merge Block'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::SelectionControl, OperandCategory::BitEnum, "",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(248u, 0u), Instruction{"OpLabel", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(249u, 0u), Instruction{"OpBranch", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target Label'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(250u, 0u), Instruction{"OpBranchConditional", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Condition'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'True Label'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'False Label'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Branch weights'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(251u, 0u), Instruction{"OpSwitch", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Selector'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Default'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::PairLiteralIntegerIdRef, OperandCategory::Composite, "'Target'",Quantifier::ZeroOrAny);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(252u, 0u), Instruction{"OpKill", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::Shader);
-	}
-	m_instructions.emplaceUnique(Hash64(253u, 0u), Instruction{"OpReturn", _pAllocator, _pAllocator, _pAllocator, 0});
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(254u, 0u), Instruction{"OpReturnValue", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	m_instructions.emplaceUnique(Hash64(255u, 0u), Instruction{"OpUnreachable", _pAllocator, _pAllocator, _pAllocator, 0});
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(256u, 0u), Instruction{"OpLifetimeStart", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Size'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(257u, 0u), Instruction{"OpLifetimeStop", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Size'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(259u, 0u), Instruction{"OpGroupAsyncCopy", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Destination'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Source'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Elements'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Stride'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Event'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(260u, 0u), Instruction{"OpGroupWaitEvents", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Events'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Events List'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(261u, 0u), Instruction{"OpGroupAll", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(262u, 0u), Instruction{"OpGroupAny", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(263u, 0u), Instruction{"OpGroupBroadcast", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'LocalId'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(264u, 0u), Instruction{"OpGroupIAdd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(265u, 0u), Instruction{"OpGroupFAdd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(266u, 0u), Instruction{"OpGroupFMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(267u, 0u), Instruction{"OpGroupUMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(268u, 0u), Instruction{"OpGroupSMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(269u, 0u), Instruction{"OpGroupFMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(270u, 0u), Instruction{"OpGroupUMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(271u, 0u), Instruction{"OpGroupSMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(274u, 0u), Instruction{"OpReadPipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(275u, 0u), Instruction{"OpWritePipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(276u, 0u), Instruction{"OpReservedReadPipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(277u, 0u), Instruction{"OpReservedWritePipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(278u, 0u), Instruction{"OpReserveReadPipePackets", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Packets'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(279u, 0u), Instruction{"OpReserveWritePipePackets", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Packets'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(280u, 0u), Instruction{"OpCommitReadPipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(281u, 0u), Instruction{"OpCommitWritePipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(282u, 0u), Instruction{"OpIsValidReserveId", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(283u, 0u), Instruction{"OpGetNumPipePackets", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(284u, 0u), Instruction{"OpGetMaxPipePackets", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(285u, 0u), Instruction{"OpGroupReserveReadPipePackets", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Packets'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(286u, 0u), Instruction{"OpGroupReserveWritePipePackets", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Packets'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(287u, 0u), Instruction{"OpGroupCommitReadPipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(288u, 0u), Instruction{"OpGroupCommitWritePipe", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(291u, 0u), Instruction{"OpEnqueueMarker", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Queue'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Events'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Wait Events'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ret Event'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(292u, 0u), Instruction{"OpEnqueueKernel", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Queue'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Flags'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ND Range'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Num Events'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Wait Events'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ret Event'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Local Size'",Quantifier::ZeroOrAny);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(293u, 0u), Instruction{"OpGetKernelNDrangeSubGroupCount", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ND Range'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(294u, 0u), Instruction{"OpGetKernelNDrangeMaxSubGroupSize", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ND Range'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(295u, 0u), Instruction{"OpGetKernelWorkGroupSize", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(296u, 0u), Instruction{"OpGetKernelPreferredWorkGroupSizeMultiple", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(297u, 0u), Instruction{"OpRetainEvent", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Event'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(298u, 0u), Instruction{"OpReleaseEvent", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Event'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(299u, 0u), Instruction{"OpCreateUserEvent", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(300u, 0u), Instruction{"OpIsValidEvent", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Event'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(301u, 0u), Instruction{"OpSetUserEventStatus", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Event'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Status'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(302u, 0u), Instruction{"OpCaptureEventProfilingInfo", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Event'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Profiling Info'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(303u, 0u), Instruction{"OpGetDefaultQueue", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(304u, 0u), Instruction{"OpBuildNDRange", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'GlobalWorkSize'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'LocalWorkSize'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'GlobalWorkOffset'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DeviceEnqueue);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(305u, 0u), Instruction{"OpImageSparseSampleImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(306u, 0u), Instruction{"OpImageSparseSampleExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(307u, 0u), Instruction{"OpImageSparseSampleDrefImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(308u, 0u), Instruction{"OpImageSparseSampleDrefExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(309u, 0u), Instruction{"OpImageSparseSampleProjImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(310u, 0u), Instruction{"OpImageSparseSampleProjExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(311u, 0u), Instruction{"OpImageSparseSampleProjDrefImplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(312u, 0u), Instruction{"OpImageSparseSampleProjDrefExplicitLod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(313u, 0u), Instruction{"OpImageSparseFetch", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(314u, 0u), Instruction{"OpImageSparseGather", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Component'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(315u, 0u), Instruction{"OpImageSparseDrefGather", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'D~ref~'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(316u, 0u), Instruction{"OpImageSparseTexelsResident", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Resident Code'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	m_instructions.emplaceUnique(Hash64(317u, 0u), Instruction{"OpNoLine", _pAllocator, _pAllocator, _pAllocator, 0});
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(318u, 0u), Instruction{"OpAtomicFlagTestAndSet", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(319u, 0u), Instruction{"OpAtomicFlagClear", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Kernel);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(320u, 0u), Instruction{"OpImageSparseRead", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::SparseResidency);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(321u, 0u), Instruction{"OpSizeOf", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(322u, 0u), Instruction{"OpTypePipeStorage", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::PipeStorage);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(323u, 0u), Instruction{"OpConstantPipeStorage", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Packet Alignment'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Capacity'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::PipeStorage);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(324u, 0u), Instruction{"OpCreatePipeFromPipeStorage", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pipe Storage'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::PipeStorage);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(325u, 0u), Instruction{"OpGetKernelLocalSizeForSubgroupCount", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Subgroup Count'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupDispatch);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(326u, 0u), Instruction{"OpGetKernelMaxNumSubgroups", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Invoke'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Param Align'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupDispatch);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(327u, 0u), Instruction{"OpTypeNamedBarrier", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::NamedBarrier);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(328u, 0u), Instruction{"OpNamedBarrierInitialize", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Subgroup Count'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::NamedBarrier);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(329u, 0u), Instruction{"OpMemoryNamedBarrier", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Named Barrier'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Memory'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::NamedBarrier);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(330u, 0u), Instruction{"OpModuleProcessed", _pAllocator, _pAllocator, _pAllocator, 65792}).kv.value;
-		instr.operands.emplace_back(OperandKind::LiteralString, OperandCategory::Literal, "'Process'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(331u, 0u), Instruction{"OpExecutionModeId", _pAllocator, _pAllocator, _pAllocator, 66048}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Entry Point'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ExecutionMode, OperandCategory::ValueEnum, "'Mode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(332u, 0u), Instruction{"OpDecorateId", _pAllocator, _pAllocator, _pAllocator, 66048}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::Decoration, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.extensions.emplace_back(spv::Extension::SPV_GOOGLE_hlsl_functionality1);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(333u, 0u), Instruction{"OpGroupNonUniformElect", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniform);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(334u, 0u), Instruction{"OpGroupNonUniformAll", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformVote);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(335u, 0u), Instruction{"OpGroupNonUniformAny", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformVote);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(336u, 0u), Instruction{"OpGroupNonUniformAllEqual", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformVote);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(337u, 0u), Instruction{"OpGroupNonUniformBroadcast", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Id'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(338u, 0u), Instruction{"OpGroupNonUniformBroadcastFirst", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(339u, 0u), Instruction{"OpGroupNonUniformBallot", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(340u, 0u), Instruction{"OpGroupNonUniformInverseBallot", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(341u, 0u), Instruction{"OpGroupNonUniformBallotBitExtract", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(342u, 0u), Instruction{"OpGroupNonUniformBallotBitCount", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(343u, 0u), Instruction{"OpGroupNonUniformBallotFindLSB", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(344u, 0u), Instruction{"OpGroupNonUniformBallotFindMSB", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformBallot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(345u, 0u), Instruction{"OpGroupNonUniformShuffle", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Id'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformShuffle);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(346u, 0u), Instruction{"OpGroupNonUniformShuffleXor", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Mask'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformShuffle);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(347u, 0u), Instruction{"OpGroupNonUniformShuffleUp", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Delta'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformShuffleRelative);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(348u, 0u), Instruction{"OpGroupNonUniformShuffleDown", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Delta'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformShuffleRelative);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(349u, 0u), Instruction{"OpGroupNonUniformIAdd", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(350u, 0u), Instruction{"OpGroupNonUniformFAdd", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(351u, 0u), Instruction{"OpGroupNonUniformIMul", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(352u, 0u), Instruction{"OpGroupNonUniformFMul", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(353u, 0u), Instruction{"OpGroupNonUniformSMin", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(354u, 0u), Instruction{"OpGroupNonUniformUMin", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(355u, 0u), Instruction{"OpGroupNonUniformFMin", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(356u, 0u), Instruction{"OpGroupNonUniformSMax", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(357u, 0u), Instruction{"OpGroupNonUniformUMax", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(358u, 0u), Instruction{"OpGroupNonUniformFMax", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(359u, 0u), Instruction{"OpGroupNonUniformBitwiseAnd", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(360u, 0u), Instruction{"OpGroupNonUniformBitwiseOr", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(361u, 0u), Instruction{"OpGroupNonUniformBitwiseXor", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(362u, 0u), Instruction{"OpGroupNonUniformLogicalAnd", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(363u, 0u), Instruction{"OpGroupNonUniformLogicalOr", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(364u, 0u), Instruction{"OpGroupNonUniformLogicalXor", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformArithmetic);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformClustered);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(365u, 0u), Instruction{"OpGroupNonUniformQuadBroadcast", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformQuad);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(366u, 0u), Instruction{"OpGroupNonUniformQuadSwap", _pAllocator, _pAllocator, _pAllocator, 66304}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformQuad);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(400u, 0u), Instruction{"OpCopyLogical", _pAllocator, _pAllocator, _pAllocator, 66560}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(401u, 0u), Instruction{"OpPtrEqual", _pAllocator, _pAllocator, _pAllocator, 66560}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(402u, 0u), Instruction{"OpPtrNotEqual", _pAllocator, _pAllocator, _pAllocator, 66560}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(403u, 0u), Instruction{"OpPtrDiff", _pAllocator, _pAllocator, _pAllocator, 66560}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Addresses);
-		instr.capabilities.emplace_back(spv::Capability::VariablePointers);
-		instr.capabilities.emplace_back(spv::Capability::VariablePointersStorageBuffer);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4421u, 0u), Instruction{"OpSubgroupBallotKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupBallotKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4422u, 0u), Instruction{"OpSubgroupFirstInvocationKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupBallotKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4428u, 0u), Instruction{"OpSubgroupAllKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupVoteKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_subgroup_vote);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4429u, 0u), Instruction{"OpSubgroupAnyKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupVoteKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_subgroup_vote);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4430u, 0u), Instruction{"OpSubgroupAllEqualKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Predicate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupVoteKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_subgroup_vote);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4432u, 0u), Instruction{"OpSubgroupReadInvocationKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupBallotKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4472u, 0u), Instruction{"OpTypeRayQueryProvisionalKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4473u, 0u), Instruction{"OpRayQueryInitializeKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Accel'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayFlags'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'CullMask'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayOrigin'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayTMin'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayDirection'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayTMax'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4474u, 0u), Instruction{"OpRayQueryTerminateKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4475u, 0u), Instruction{"OpRayQueryGenerateIntersectionKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'HitT'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4476u, 0u), Instruction{"OpRayQueryConfirmIntersectionKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4477u, 0u), Instruction{"OpRayQueryProceedKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4479u, 0u), Instruction{"OpRayQueryGetIntersectionTypeKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5000u, 0u), Instruction{"OpGroupIAddNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5001u, 0u), Instruction{"OpGroupFAddNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5002u, 0u), Instruction{"OpGroupFMinNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5003u, 0u), Instruction{"OpGroupUMinNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5004u, 0u), Instruction{"OpGroupSMinNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5005u, 0u), Instruction{"OpGroupFMaxNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5006u, 0u), Instruction{"OpGroupUMaxNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5007u, 0u), Instruction{"OpGroupSMaxNonUniformAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'X'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Groups);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_ballot);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5011u, 0u), Instruction{"OpFragmentMaskFetchAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::FragmentMaskAMD);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_fragment_mask);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5012u, 0u), Instruction{"OpFragmentFetchAMD", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fragment Index'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::FragmentMaskAMD);
-		instr.extensions.emplace_back(spv::Extension::SPV_AMD_shader_fragment_mask);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5056u, 0u), Instruction{"OpReadClockKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::ShaderClockKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_shader_clock);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5283u, 0u), Instruction{"OpImageSampleFootprintNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Granularity'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coarse'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::ImageOperands, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::ImageFootprintNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_shader_image_footprint);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5296u, 0u), Instruction{"OpGroupNonUniformPartitionNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::GroupNonUniformPartitionedNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_shader_subgroup_partitioned);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5299u, 0u), Instruction{"OpWritePackedPrimitiveIndices4x8NV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Index Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Indices'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::MeshShadingNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_mesh_shader);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5334u, 0u), Instruction{"OpReportIntersectionKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Hit'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'HitKind'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingNV);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_tracing);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5335u, 0u), Instruction{"OpIgnoreIntersectionKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::RayTracingNV);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_tracing);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5336u, 0u), Instruction{"OpTerminateRayKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::RayTracingNV);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_tracing);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5337u, 0u), Instruction{"OpTraceRayKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Accel'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ray Flags'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Cull Mask'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'SBT Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'SBT Stride'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Miss Index'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ray Origin'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ray Tmin'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ray Direction'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ray Tmax'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'PayloadId'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingNV);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_tracing);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5341u, 0u), Instruction{"OpTypeAccelerationStructureKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingNV);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingProvisionalKHR);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5344u, 0u), Instruction{"OpExecuteCallableKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'SBT Index'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Callable DataId'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingNV);
-		instr.capabilities.emplace_back(spv::Capability::RayTracingProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_ray_tracing);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_tracing);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5358u, 0u), Instruction{"OpTypeCooperativeMatrixNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Component Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdScope, OperandCategory::Id, "'Execution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Rows'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Columns'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::CooperativeMatrixNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_cooperative_matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5359u, 0u), Instruction{"OpCooperativeMatrixLoadNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Stride'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Column Major'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::CooperativeMatrixNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_cooperative_matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5360u, 0u), Instruction{"OpCooperativeMatrixStoreNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pointer'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Object'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Stride'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Column Major'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::MemoryAccess, OperandCategory::BitEnum, "",Quantifier::ZeroOrOne);
-		instr.capabilities.emplace_back(spv::Capability::CooperativeMatrixNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_cooperative_matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5361u, 0u), Instruction{"OpCooperativeMatrixMulAddNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'A'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'B'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'C'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::CooperativeMatrixNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_cooperative_matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5362u, 0u), Instruction{"OpCooperativeMatrixLengthNV", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Type'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::CooperativeMatrixNV);
-		instr.extensions.emplace_back(spv::Extension::SPV_NV_cooperative_matrix);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5364u, 0u), Instruction{"OpBeginInvocationInterlockEXT", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::FragmentShaderSampleInterlockEXT);
-		instr.capabilities.emplace_back(spv::Capability::FragmentShaderPixelInterlockEXT);
-		instr.capabilities.emplace_back(spv::Capability::FragmentShaderShadingRateInterlockEXT);
-		instr.extensions.emplace_back(spv::Extension::SPV_EXT_fragment_shader_interlock);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5365u, 0u), Instruction{"OpEndInvocationInterlockEXT", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::FragmentShaderSampleInterlockEXT);
-		instr.capabilities.emplace_back(spv::Capability::FragmentShaderPixelInterlockEXT);
-		instr.capabilities.emplace_back(spv::Capability::FragmentShaderShadingRateInterlockEXT);
-		instr.extensions.emplace_back(spv::Extension::SPV_EXT_fragment_shader_interlock);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5380u, 0u), Instruction{"OpDemoteToHelperInvocationEXT", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.capabilities.emplace_back(spv::Capability::DemoteToHelperInvocationEXT);
-		instr.extensions.emplace_back(spv::Extension::SPV_EXT_demote_to_helper_invocation);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5381u, 0u), Instruction{"OpIsHelperInvocationEXT", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::DemoteToHelperInvocationEXT);
-		instr.extensions.emplace_back(spv::Extension::SPV_EXT_demote_to_helper_invocation);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5571u, 0u), Instruction{"OpSubgroupShuffleINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'InvocationId'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupShuffleINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5572u, 0u), Instruction{"OpSubgroupShuffleDownINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Current'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Next'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Delta'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupShuffleINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5573u, 0u), Instruction{"OpSubgroupShuffleUpINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Previous'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Current'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Delta'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupShuffleINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5574u, 0u), Instruction{"OpSubgroupShuffleXorINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupShuffleINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5575u, 0u), Instruction{"OpSubgroupBlockReadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ptr'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupBufferBlockIOINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5576u, 0u), Instruction{"OpSubgroupBlockWriteINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ptr'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Data'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupBufferBlockIOINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5577u, 0u), Instruction{"OpSubgroupImageBlockReadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupImageBlockIOINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5578u, 0u), Instruction{"OpSubgroupImageBlockWriteINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Data'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupImageBlockIOINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5580u, 0u), Instruction{"OpSubgroupImageMediaBlockReadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Width'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Height'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupImageMediaBlockIOINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5581u, 0u), Instruction{"OpSubgroupImageMediaBlockWriteINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Coordinate'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Width'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Height'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Data'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupImageMediaBlockIOINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5585u, 0u), Instruction{"OpUCountLeadingZerosINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5586u, 0u), Instruction{"OpUCountTrailingZerosINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5587u, 0u), Instruction{"OpAbsISubINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5588u, 0u), Instruction{"OpAbsUSubINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5589u, 0u), Instruction{"OpIAddSatINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5590u, 0u), Instruction{"OpUAddSatINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5591u, 0u), Instruction{"OpIAverageINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5592u, 0u), Instruction{"OpUAverageINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5593u, 0u), Instruction{"OpIAverageRoundedINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5594u, 0u), Instruction{"OpUAverageRoundedINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5595u, 0u), Instruction{"OpISubSatINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5596u, 0u), Instruction{"OpUSubSatINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5597u, 0u), Instruction{"OpIMul32x16INTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5598u, 0u), Instruction{"OpUMul32x16INTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 2'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::IntegerFunctions2INTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5600u, 0u), Instruction{"OpFunctionPointerINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Function'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::FunctionPointersINTEL);
-		instr.extensions.emplace_back(spv::Extension::SPV_INTEL_function_pointers);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5601u, 0u), Instruction{"OpFunctionPointerCallINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Operand 1'",Quantifier::ZeroOrAny);
-		instr.capabilities.emplace_back(spv::Capability::FunctionPointersINTEL);
-		instr.extensions.emplace_back(spv::Extension::SPV_INTEL_function_pointers);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5632u, 0u), Instruction{"OpDecorateString", _pAllocator, _pAllocator, _pAllocator, 66560}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Target'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::Decoration, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.extensions.emplace_back(spv::Extension::SPV_GOOGLE_decorate_string);
-		instr.extensions.emplace_back(spv::Extension::SPV_GOOGLE_hlsl_functionality1);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5633u, 0u), Instruction{"OpMemberDecorateString", _pAllocator, _pAllocator, _pAllocator, 66560}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Struct Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Member'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::Decoration, OperandCategory::ValueEnum, "",Quantifier::One);
-		instr.extensions.emplace_back(spv::Extension::SPV_GOOGLE_decorate_string);
-		instr.extensions.emplace_back(spv::Extension::SPV_GOOGLE_hlsl_functionality1);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5699u, 0u), Instruction{"OpVmeImageINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sampler'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5700u, 0u), Instruction{"OpTypeVmeImageINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image Type'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5701u, 0u), Instruction{"OpTypeAvcImePayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5702u, 0u), Instruction{"OpTypeAvcRefPayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5703u, 0u), Instruction{"OpTypeAvcSicPayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5704u, 0u), Instruction{"OpTypeAvcMcePayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5705u, 0u), Instruction{"OpTypeAvcMceResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5706u, 0u), Instruction{"OpTypeAvcImeResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5707u, 0u), Instruction{"OpTypeAvcImeResultSingleReferenceStreamoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5708u, 0u), Instruction{"OpTypeAvcImeResultDualReferenceStreamoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5709u, 0u), Instruction{"OpTypeAvcImeSingleReferenceStreaminINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5710u, 0u), Instruction{"OpTypeAvcImeDualReferenceStreaminINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5711u, 0u), Instruction{"OpTypeAvcRefResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5712u, 0u), Instruction{"OpTypeAvcSicResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5713u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Slice Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Qp'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5714u, 0u), Instruction{"OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reference Base Penalty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5715u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Slice Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Qp'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5716u, 0u), Instruction{"OpSubgroupAvcMceSetInterShapePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Shape Penalty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5717u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Slice Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Qp'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5718u, 0u), Instruction{"OpSubgroupAvcMceSetInterDirectionPenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction Cost'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5719u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Slice Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Qp'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5720u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Slice Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Qp'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5721u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5722u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5723u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5724u, 0u), Instruction{"OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Cost Center Delta'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Cost Table'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Cost Precision'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5725u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Slice Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Qp'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5726u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5727u, 0u), Instruction{"OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationChromaINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5728u, 0u), Instruction{"OpSubgroupAvcMceSetAcOnlyHaarINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5729u, 0u), Instruction{"OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Source Field Polarity'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5730u, 0u), Instruction{"OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Reference Field Polarity'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5731u, 0u), Instruction{"OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Forward Reference Field Polarity'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Backward Reference Field Polarity'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5732u, 0u), Instruction{"OpSubgroupAvcMceConvertToImePayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5733u, 0u), Instruction{"OpSubgroupAvcMceConvertToImeResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5734u, 0u), Instruction{"OpSubgroupAvcMceConvertToRefPayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5735u, 0u), Instruction{"OpSubgroupAvcMceConvertToRefResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5736u, 0u), Instruction{"OpSubgroupAvcMceConvertToSicPayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5737u, 0u), Instruction{"OpSubgroupAvcMceConvertToSicResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5738u, 0u), Instruction{"OpSubgroupAvcMceGetMotionVectorsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5739u, 0u), Instruction{"OpSubgroupAvcMceGetInterDistortionsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5740u, 0u), Instruction{"OpSubgroupAvcMceGetBestInterDistortionsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5741u, 0u), Instruction{"OpSubgroupAvcMceGetInterMajorShapeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5742u, 0u), Instruction{"OpSubgroupAvcMceGetInterMinorShapeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5743u, 0u), Instruction{"OpSubgroupAvcMceGetInterDirectionsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5744u, 0u), Instruction{"OpSubgroupAvcMceGetInterMotionVectorCountINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5745u, 0u), Instruction{"OpSubgroupAvcMceGetInterReferenceIdsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5746u, 0u), Instruction{"OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Parameter Field Polarities'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5747u, 0u), Instruction{"OpSubgroupAvcImeInitializeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Coord'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Partition Mask'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'SAD Adjustment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5748u, 0u), Instruction{"OpSubgroupAvcImeSetSingleReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Search Window Config'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5749u, 0u), Instruction{"OpSubgroupAvcImeSetDualReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'id> Search Window Config'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5750u, 0u), Instruction{"OpSubgroupAvcImeRefWindowSizeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Search Window Config'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Dual Ref'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5751u, 0u), Instruction{"OpSubgroupAvcImeAdjustRefOffsetINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Coord'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Window Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image Size'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5752u, 0u), Instruction{"OpSubgroupAvcImeConvertToMcePayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5753u, 0u), Instruction{"OpSubgroupAvcImeSetMaxMotionVectorCountINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Max Motion Vector Count'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5754u, 0u), Instruction{"OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5755u, 0u), Instruction{"OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Threshold'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5756u, 0u), Instruction{"OpSubgroupAvcImeSetWeightedSadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Sad Weights'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5757u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5758u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithDualReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5759u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5760u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5761u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5762u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5763u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5764u, 0u), Instruction{"OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5765u, 0u), Instruction{"OpSubgroupAvcImeConvertToMceResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5766u, 0u), Instruction{"OpSubgroupAvcImeGetSingleReferenceStreaminINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5767u, 0u), Instruction{"OpSubgroupAvcImeGetDualReferenceStreaminINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5768u, 0u), Instruction{"OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5769u, 0u), Instruction{"OpSubgroupAvcImeStripDualReferenceStreamoutINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5770u, 0u), Instruction{"OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shape'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5771u, 0u), Instruction{"OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shape'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5772u, 0u), Instruction{"OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shape'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5773u, 0u), Instruction{"OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shape'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5774u, 0u), Instruction{"OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shape'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5775u, 0u), Instruction{"OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shape'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5776u, 0u), Instruction{"OpSubgroupAvcImeGetBorderReachedINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Image Select'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5777u, 0u), Instruction{"OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5778u, 0u), Instruction{"OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5779u, 0u), Instruction{"OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5780u, 0u), Instruction{"OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5781u, 0u), Instruction{"OpSubgroupAvcFmeInitializeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Coord'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Motion Vectors'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shapes'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Minor Shapes'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pixel Resolution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5782u, 0u), Instruction{"OpSubgroupAvcBmeInitializeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Coord'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Motion Vectors'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Major Shapes'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Minor Shapes'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Pixel Resolution'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bidirectional Weight'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5783u, 0u), Instruction{"OpSubgroupAvcRefConvertToMcePayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5784u, 0u), Instruction{"OpSubgroupAvcRefSetBidirectionalMixDisableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5785u, 0u), Instruction{"OpSubgroupAvcRefSetBilinearFilterEnableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5786u, 0u), Instruction{"OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5787u, 0u), Instruction{"OpSubgroupAvcRefEvaluateWithDualReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5788u, 0u), Instruction{"OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5789u, 0u), Instruction{"OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Field Polarities'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5790u, 0u), Instruction{"OpSubgroupAvcRefConvertToMceResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5791u, 0u), Instruction{"OpSubgroupAvcSicInitializeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Coord'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5792u, 0u), Instruction{"OpSubgroupAvcSicConfigureSkcINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Skip Block Partition Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Skip Motion Vector Mask'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Motion Vectors'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bidirectional Weight'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5793u, 0u), Instruction{"OpSubgroupAvcSicConfigureIpeLumaINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Luma Intra Partition Mask'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intra Neighbour Availabilty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Left Edge Luma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Left Corner Luma Pixel'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Edge Luma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Right Edge Luma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5794u, 0u), Instruction{"OpSubgroupAvcSicConfigureIpeLumaChromaINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Luma Intra Partition Mask'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intra Neighbour Availabilty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Left Edge Luma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Left Corner Luma Pixel'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Edge Luma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Right Edge Luma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Left Edge Chroma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Left Corner Chroma Pixel'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Upper Edge Chroma Pixels'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationChromaINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5795u, 0u), Instruction{"OpSubgroupAvcSicGetMotionVectorMaskINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Skip Block Partition Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Direction'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5796u, 0u), Instruction{"OpSubgroupAvcSicConvertToMcePayloadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5797u, 0u), Instruction{"OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Shape Penalty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5798u, 0u), Instruction{"OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Luma Mode Penalty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Luma Packed Neighbor Modes'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Luma Packed Non Dc Penalty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5799u, 0u), Instruction{"OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Chroma Mode Base Penalty'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationChromaINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5800u, 0u), Instruction{"OpSubgroupAvcSicSetBilinearFilterEnableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5801u, 0u), Instruction{"OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Sad Coefficients'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5802u, 0u), Instruction{"OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Block Based Skip Type'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5803u, 0u), Instruction{"OpSubgroupAvcSicEvaluateIpeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5804u, 0u), Instruction{"OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5805u, 0u), Instruction{"OpSubgroupAvcSicEvaluateWithDualReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5806u, 0u), Instruction{"OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5807u, 0u), Instruction{"OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Src Image'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Field Polarities'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5808u, 0u), Instruction{"OpSubgroupAvcSicConvertToMceResultINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5809u, 0u), Instruction{"OpSubgroupAvcSicGetIpeLumaShapeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5810u, 0u), Instruction{"OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5811u, 0u), Instruction{"OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5812u, 0u), Instruction{"OpSubgroupAvcSicGetPackedIpeLumaModesINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5813u, 0u), Instruction{"OpSubgroupAvcSicGetIpeChromaModeINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationChromaINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5814u, 0u), Instruction{"OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5815u, 0u), Instruction{"OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationIntraINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5816u, 0u), Instruction{"OpSubgroupAvcSicGetInterRawSadsINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Payload'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::SubgroupAvcMotionEstimationINTEL);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5887u, 0u), Instruction{"OpLoopControlINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'Loop Control Parameters'",Quantifier::ZeroOrAny);
-		instr.capabilities.emplace_back(spv::Capability::UnstructuredLoopControlsINTEL);
-		instr.extensions.emplace_back(spv::Extension::SPV_INTEL_unstructured_loop_controls);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5946u, 0u), Instruction{"OpReadPipeBlockingINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::BlockingPipesINTEL);
-		instr.extensions.emplace_back(spv::Extension::SPV_INTEL_blocking_pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5947u, 0u), Instruction{"OpWritePipeBlockingINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Size'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::BlockingPipesINTEL);
-		instr.extensions.emplace_back(spv::Extension::SPV_INTEL_blocking_pipes);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5949u, 0u), Instruction{"OpFPGARegINTEL", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Result'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Input'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::FPGARegINTEL);
-		instr.extensions.emplace_back(spv::Extension::SPV_INTEL_fpga_reg);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6016u, 0u), Instruction{"OpRayQueryGetRayTMinKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6017u, 0u), Instruction{"OpRayQueryGetRayFlagsKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6018u, 0u), Instruction{"OpRayQueryGetIntersectionTKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6019u, 0u), Instruction{"OpRayQueryGetIntersectionInstanceCustomIndexKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6020u, 0u), Instruction{"OpRayQueryGetIntersectionInstanceIdKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6021u, 0u), Instruction{"OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6022u, 0u), Instruction{"OpRayQueryGetIntersectionGeometryIndexKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6023u, 0u), Instruction{"OpRayQueryGetIntersectionPrimitiveIndexKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6024u, 0u), Instruction{"OpRayQueryGetIntersectionBarycentricsKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6025u, 0u), Instruction{"OpRayQueryGetIntersectionFrontFaceKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6026u, 0u), Instruction{"OpRayQueryGetIntersectionCandidateAABBOpaqueKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6027u, 0u), Instruction{"OpRayQueryGetIntersectionObjectRayDirectionKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6028u, 0u), Instruction{"OpRayQueryGetIntersectionObjectRayOriginKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6029u, 0u), Instruction{"OpRayQueryGetWorldRayDirectionKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6030u, 0u), Instruction{"OpRayQueryGetWorldRayOriginKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6031u, 0u), Instruction{"OpRayQueryGetIntersectionObjectToWorldKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6032u, 0u), Instruction{"OpRayQueryGetIntersectionWorldToObjectKHR", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdResultType, OperandCategory::Id, "ResultType",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdResult, OperandCategory::Id, "Result",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'RayQuery'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Intersection'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::RayQueryProvisionalKHR);
-		instr.extensions.emplace_back(spv::Extension::SPV_KHR_ray_query);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(1u, 1u), Instruction{"Round", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(2u, 1u), Instruction{"RoundEven", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(3u, 1u), Instruction{"Trunc", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4u, 1u), Instruction{"FAbs", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5u, 1u), Instruction{"SAbs", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6u, 1u), Instruction{"FSign", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(7u, 1u), Instruction{"SSign", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(8u, 1u), Instruction{"Floor", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(9u, 1u), Instruction{"Ceil", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(10u, 1u), Instruction{"Fract", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(11u, 1u), Instruction{"Radians", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'degrees'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(12u, 1u), Instruction{"Degrees", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'radians'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(13u, 1u), Instruction{"Sin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(14u, 1u), Instruction{"Cos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(15u, 1u), Instruction{"Tan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(16u, 1u), Instruction{"Asin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(17u, 1u), Instruction{"Acos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(18u, 1u), Instruction{"Atan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y_over_x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(19u, 1u), Instruction{"Sinh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(20u, 1u), Instruction{"Cosh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(21u, 1u), Instruction{"Tanh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(22u, 1u), Instruction{"Asinh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(23u, 1u), Instruction{"Acosh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(24u, 1u), Instruction{"Atanh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(25u, 1u), Instruction{"Atan2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(26u, 1u), Instruction{"Pow", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(27u, 1u), Instruction{"Exp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(28u, 1u), Instruction{"Log", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(29u, 1u), Instruction{"Exp2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(30u, 1u), Instruction{"Log2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(31u, 1u), Instruction{"Sqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(32u, 1u), Instruction{"InverseSqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(33u, 1u), Instruction{"Determinant", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(34u, 1u), Instruction{"MatrixInverse", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(35u, 1u), Instruction{"Modf", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'i'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(36u, 1u), Instruction{"ModfStruct", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(37u, 1u), Instruction{"FMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(38u, 1u), Instruction{"UMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(39u, 1u), Instruction{"SMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(40u, 1u), Instruction{"FMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(41u, 1u), Instruction{"UMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(42u, 1u), Instruction{"SMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(43u, 1u), Instruction{"FClamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minVal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxVal'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(44u, 1u), Instruction{"UClamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minVal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxVal'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(45u, 1u), Instruction{"SClamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minVal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxVal'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(46u, 1u), Instruction{"FMix", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(47u, 1u), Instruction{"IMix", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(48u, 1u), Instruction{"Step", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'edge'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(49u, 1u), Instruction{"SmoothStep", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'edge0'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'edge1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(50u, 1u), Instruction{"Fma", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(51u, 1u), Instruction{"Frexp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'exp'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(52u, 1u), Instruction{"FrexpStruct", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(53u, 1u), Instruction{"Ldexp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'exp'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(54u, 1u), Instruction{"PackSnorm4x8", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(55u, 1u), Instruction{"PackUnorm4x8", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(56u, 1u), Instruction{"PackSnorm2x16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(57u, 1u), Instruction{"PackUnorm2x16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(58u, 1u), Instruction{"PackHalf2x16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(59u, 1u), Instruction{"PackDouble2x32", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Float64);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(60u, 1u), Instruction{"UnpackSnorm2x16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(61u, 1u), Instruction{"UnpackUnorm2x16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(62u, 1u), Instruction{"UnpackHalf2x16", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(63u, 1u), Instruction{"UnpackSnorm4x8", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(64u, 1u), Instruction{"UnpackUnorm4x8", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(65u, 1u), Instruction{"UnpackDouble2x32", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::Float64);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(66u, 1u), Instruction{"Length", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(67u, 1u), Instruction{"Distance", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p0'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p1'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(68u, 1u), Instruction{"Cross", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(69u, 1u), Instruction{"Normalize", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(70u, 1u), Instruction{"FaceForward", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'N'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'I'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Nref'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(71u, 1u), Instruction{"Reflect", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'I'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'N'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(72u, 1u), Instruction{"Refract", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'I'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'N'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'eta'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(73u, 1u), Instruction{"FindILsb", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(74u, 1u), Instruction{"FindSMsb", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(75u, 1u), Instruction{"FindUMsb", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'Value'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(76u, 1u), Instruction{"InterpolateAtCentroid", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'interpolant'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::InterpolationFunction);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(77u, 1u), Instruction{"InterpolateAtSample", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'interpolant'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'sample'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::InterpolationFunction);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(78u, 1u), Instruction{"InterpolateAtOffset", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'interpolant'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.capabilities.emplace_back(spv::Capability::InterpolationFunction);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(79u, 1u), Instruction{"NMin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(80u, 1u), Instruction{"NMax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(81u, 1u), Instruction{"NClamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minVal'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxVal'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(0u, 2u), Instruction{"acos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(1u, 2u), Instruction{"acosh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(2u, 2u), Instruction{"acospi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(3u, 2u), Instruction{"asin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(4u, 2u), Instruction{"asinh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(5u, 2u), Instruction{"asinpi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(6u, 2u), Instruction{"atan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(7u, 2u), Instruction{"atan2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(8u, 2u), Instruction{"atanh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(9u, 2u), Instruction{"atanpi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(10u, 2u), Instruction{"atan2pi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(11u, 2u), Instruction{"cbrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(12u, 2u), Instruction{"ceil", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(13u, 2u), Instruction{"copysign", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(14u, 2u), Instruction{"cos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(15u, 2u), Instruction{"cosh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(16u, 2u), Instruction{"cospi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(17u, 2u), Instruction{"erfc", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(18u, 2u), Instruction{"erf", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(19u, 2u), Instruction{"exp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(20u, 2u), Instruction{"exp2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(21u, 2u), Instruction{"exp10", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(22u, 2u), Instruction{"expm1", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(23u, 2u), Instruction{"fabs", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(24u, 2u), Instruction{"fdim", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(25u, 2u), Instruction{"floor", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(26u, 2u), Instruction{"fma", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(27u, 2u), Instruction{"fmax", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(28u, 2u), Instruction{"fmin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(29u, 2u), Instruction{"fmod", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(30u, 2u), Instruction{"fract", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ptr'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(31u, 2u), Instruction{"frexp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'exp'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(32u, 2u), Instruction{"hypot", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(33u, 2u), Instruction{"ilogb", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(34u, 2u), Instruction{"ldexp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'k'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(35u, 2u), Instruction{"lgamma", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(36u, 2u), Instruction{"lgamma_r", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'signp'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(37u, 2u), Instruction{"log", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(38u, 2u), Instruction{"log2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(39u, 2u), Instruction{"log10", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(40u, 2u), Instruction{"log1p", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(41u, 2u), Instruction{"logb", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(42u, 2u), Instruction{"mad", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(43u, 2u), Instruction{"maxmag", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(44u, 2u), Instruction{"minmag", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(45u, 2u), Instruction{"modf", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'iptr'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(46u, 2u), Instruction{"nan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'nancode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(47u, 2u), Instruction{"nextafter", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(48u, 2u), Instruction{"pow", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(49u, 2u), Instruction{"pown", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(50u, 2u), Instruction{"powr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(51u, 2u), Instruction{"remainder", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(52u, 2u), Instruction{"remquo", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'quo'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(53u, 2u), Instruction{"rint", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(54u, 2u), Instruction{"rootn", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(55u, 2u), Instruction{"round", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(56u, 2u), Instruction{"rsqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(57u, 2u), Instruction{"sin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(58u, 2u), Instruction{"sincos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'cosval'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(59u, 2u), Instruction{"sinh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(60u, 2u), Instruction{"sinpi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(61u, 2u), Instruction{"sqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(62u, 2u), Instruction{"tan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(63u, 2u), Instruction{"tanh", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(64u, 2u), Instruction{"tanpi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(65u, 2u), Instruction{"tgamma", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(66u, 2u), Instruction{"trunc", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(67u, 2u), Instruction{"half_cos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(68u, 2u), Instruction{"half_divide", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(69u, 2u), Instruction{"half_exp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(70u, 2u), Instruction{"half_exp2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(71u, 2u), Instruction{"half_exp10", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(72u, 2u), Instruction{"half_log", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(73u, 2u), Instruction{"half_log2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(74u, 2u), Instruction{"half_log10", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(75u, 2u), Instruction{"half_powr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(76u, 2u), Instruction{"half_recip", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(77u, 2u), Instruction{"half_rsqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(78u, 2u), Instruction{"half_sin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(79u, 2u), Instruction{"half_sqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(80u, 2u), Instruction{"half_tan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(81u, 2u), Instruction{"native_cos", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(82u, 2u), Instruction{"native_divide", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(83u, 2u), Instruction{"native_exp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(84u, 2u), Instruction{"native_exp2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(85u, 2u), Instruction{"native_exp10", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(86u, 2u), Instruction{"native_log", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(87u, 2u), Instruction{"native_log2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(88u, 2u), Instruction{"native_log10", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(89u, 2u), Instruction{"native_powr", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(90u, 2u), Instruction{"native_recip", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(91u, 2u), Instruction{"native_rsqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(92u, 2u), Instruction{"native_sin", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(93u, 2u), Instruction{"native_sqrt", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(94u, 2u), Instruction{"native_tan", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(141u, 2u), Instruction{"s_abs", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(142u, 2u), Instruction{"s_abs_diff", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(143u, 2u), Instruction{"s_add_sat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(144u, 2u), Instruction{"u_add_sat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(145u, 2u), Instruction{"s_hadd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(146u, 2u), Instruction{"u_hadd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(147u, 2u), Instruction{"s_rhadd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(148u, 2u), Instruction{"u_rhadd", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(149u, 2u), Instruction{"s_clamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minval'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxval'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(150u, 2u), Instruction{"u_clamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minval'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxval'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(151u, 2u), Instruction{"clz", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(152u, 2u), Instruction{"ctz", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(153u, 2u), Instruction{"s_mad_hi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(154u, 2u), Instruction{"u_mad_sat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'z'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(155u, 2u), Instruction{"s_mad_sat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'z'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(156u, 2u), Instruction{"s_max", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(157u, 2u), Instruction{"u_max", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(158u, 2u), Instruction{"s_min", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(159u, 2u), Instruction{"u_min", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(160u, 2u), Instruction{"s_mul_hi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(161u, 2u), Instruction{"rotate", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'v'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'i'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(162u, 2u), Instruction{"s_sub_sat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(163u, 2u), Instruction{"u_sub_sat", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(164u, 2u), Instruction{"u_upsample", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'hi'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'lo'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(165u, 2u), Instruction{"s_upsample", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'hi'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'lo'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(166u, 2u), Instruction{"popcount", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(167u, 2u), Instruction{"s_mad24", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'z'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(168u, 2u), Instruction{"u_mad24", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'z'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(169u, 2u), Instruction{"s_mul24", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(170u, 2u), Instruction{"u_mul24", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(201u, 2u), Instruction{"u_abs", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(202u, 2u), Instruction{"u_abs_diff", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(203u, 2u), Instruction{"u_mul_hi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(204u, 2u), Instruction{"u_mad_hi", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(95u, 2u), Instruction{"fclamp", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'minval'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'maxval'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(96u, 2u), Instruction{"degrees", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'radians'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(97u, 2u), Instruction{"fmax_common", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(98u, 2u), Instruction{"fmin_common", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(99u, 2u), Instruction{"mix", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(100u, 2u), Instruction{"radians", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'degrees'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(101u, 2u), Instruction{"step", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'edge'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(102u, 2u), Instruction{"smoothstep", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'edge0'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'edge1'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(103u, 2u), Instruction{"sign", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(104u, 2u), Instruction{"cross", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p0'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p1'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(105u, 2u), Instruction{"distance", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p0'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p1'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(106u, 2u), Instruction{"length", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(107u, 2u), Instruction{"normalize", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(108u, 2u), Instruction{"fast_distance", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p0'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p1'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(109u, 2u), Instruction{"fast_length", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(110u, 2u), Instruction{"fast_normalize", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(186u, 2u), Instruction{"bitselect", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(187u, 2u), Instruction{"select", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'a'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'b'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'c'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(171u, 2u), Instruction{"vloadn", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'n'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(172u, 2u), Instruction{"vstoren", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(173u, 2u), Instruction{"vload_half", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(174u, 2u), Instruction{"vload_halfn", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'n'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(175u, 2u), Instruction{"vstore_half", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(176u, 2u), Instruction{"vstore_half_r", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::FPRoundingMode, OperandCategory::ValueEnum, "'mode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(177u, 2u), Instruction{"vstore_halfn", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(178u, 2u), Instruction{"vstore_halfn_r", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::FPRoundingMode, OperandCategory::ValueEnum, "'mode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(179u, 2u), Instruction{"vloada_halfn", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::LiteralInteger, OperandCategory::Literal, "'n'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(180u, 2u), Instruction{"vstorea_halfn", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(181u, 2u), Instruction{"vstorea_halfn_r", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'data'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'offset'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'p'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::FPRoundingMode, OperandCategory::ValueEnum, "'mode'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(182u, 2u), Instruction{"shuffle", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'shuffle mask'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(183u, 2u), Instruction{"shuffle2", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'x'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'y'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'shuffle mask'",Quantifier::One);
-	}
-	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(184u, 2u), Instruction{"printf", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'format'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'additional arguments'",Quantifier::ZeroOrAny);
-	}
+	using OperandKind = Grammar::OperandKind;
+	using OperandCategory = Grammar::OperandCategory;
+	using Quantifier = Grammar::Quantifier;
+
+	constexpr Grammar::Operand operands_0_1[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_2[] = {
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Continued Source'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_3[] = {
+		{ OperandKind::SourceLanguage, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Version'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'File'", Quantifier::ZeroOrOne },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Source'", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_4[] = {
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Extension'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_5[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target'", Quantifier::One },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Name'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_6[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Type'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Member'", Quantifier::One },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Name'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_7[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'String'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_8[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'File'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Line'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Column'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_10[] = {
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Name'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_11[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Name'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_12[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Set'", Quantifier::One },
+		{ OperandKind::LiteralExtInstInteger, OperandCategory::Literal, "'Instruction'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1', +'Operand 2', +...", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_14[] = {
+		{ OperandKind::AddressingModel, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::MemoryModel, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_15[] = {
+		{ OperandKind::ExecutionModel, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Entry Point'", Quantifier::One },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Name'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Interface'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_16[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Entry Point'", Quantifier::One },
+		{ OperandKind::ExecutionMode, OperandCategory::ValueEnum, "'Mode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_17[] = {
+		{ OperandKind::Capability, OperandCategory::ValueEnum, "'Capability'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_19[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_20[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_21[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Width'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Signedness'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_22[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Width'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_23[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Component Type'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Component Count'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_24[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Column Type'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Column Count'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_24[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_25[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Type'", Quantifier::One },
+		{ OperandKind::Dim, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Depth'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Arrayed'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'MS'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Sampled'", Quantifier::One },
+		{ OperandKind::ImageFormat, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::AccessQualifier, OperandCategory::ValueEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_26[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_27[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image Type'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_28[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Element Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Length'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_29[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Element Type'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_29[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_30[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Member 0 type', +'member 1 type', +...", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_31[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralString, OperandCategory::Literal, "The name of the opaque type.", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_31[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_32[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::StorageClass, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Type'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_33[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Return Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Parameter 0 Type', +'Parameter 1 Type', +...", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_34[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_34[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_35[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_35[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_36[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_36[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_37[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_37[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_38[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::AccessQualifier, OperandCategory::ValueEnum, "'Qualifier'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_38[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_39[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer Type'", Quantifier::One },
+		{ OperandKind::StorageClass, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_39[] = {
+		spv::Capability::Addresses,
+		spv::Capability::PhysicalStorageBufferAddresses,
+	};
+	constexpr Grammar::Operand operands_0_41[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_42[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_43[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralContextDependentNumber, OperandCategory::Literal, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_44[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Constituents'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_45[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::SamplerAddressingMode, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Param'", Quantifier::One },
+		{ OperandKind::SamplerFilterMode, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_45[] = {
+		spv::Capability::LiteralSampler,
+	};
+	constexpr Grammar::Operand operands_0_46[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_48[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_49[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_50[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralContextDependentNumber, OperandCategory::Literal, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_51[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Constituents'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_52[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralSpecConstantOpInteger, OperandCategory::Literal, "'Opcode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_54[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::FunctionControl, OperandCategory::BitEnum, "", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Function Type'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_55[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_57[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Function'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Argument 0', +'Argument 1', +...", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_59[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::StorageClass, OperandCategory::ValueEnum, "", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Initializer'", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_60[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sample'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_61[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_62[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Object'", Quantifier::One },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_63[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Source'", Quantifier::One },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_64[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Source'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Size'", Quantifier::One },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_64[] = {
+		spv::Capability::Addresses,
+	};
+	constexpr Grammar::Operand operands_0_65[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Indexes'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_66[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Indexes'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_67[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Element'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Indexes'", Quantifier::ZeroOrAny },
+	};
+	constexpr spv::Capability capabilities_0_67[] = {
+		spv::Capability::Addresses,
+		spv::Capability::VariablePointers,
+		spv::Capability::VariablePointersStorageBuffer,
+		spv::Capability::PhysicalStorageBufferAddresses,
+	};
+	constexpr Grammar::Operand operands_0_68[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Structure'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Array member'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_68[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_69[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_69[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_70[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Element'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Indexes'", Quantifier::ZeroOrAny },
+	};
+	constexpr spv::Capability capabilities_0_70[] = {
+		spv::Capability::Addresses,
+	};
+	constexpr Grammar::Operand operands_0_71[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target'", Quantifier::One },
+		{ OperandKind::Decoration, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_72[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Structure Type'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Member'", Quantifier::One },
+		{ OperandKind::Decoration, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_73[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_74[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Decoration Group'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Targets'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_75[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Decoration Group'", Quantifier::One },
+		{ OperandKind::PairIdRefLiteralInteger, OperandCategory::Composite, "'Targets'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_77[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_78[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Component'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_79[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector 2'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Components'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_80[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Constituents'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_81[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Composite'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Indexes'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_82[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Object'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Composite'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Indexes'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_83[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_84[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Matrix'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_84[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_86[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampler'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_87[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_87[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_88[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_89[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_89[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_90[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_90[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_91[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_91[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_92[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_92[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_93[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_93[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_94[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_94[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_95[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_96[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Component'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_96[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_97[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_97[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_98[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_99[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Texel'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr Grammar::Operand operands_0_100[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_101[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_101[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_102[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_102[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_103[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Level of Detail'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_103[] = {
+		spv::Capability::Kernel,
+		spv::Capability::ImageQuery,
+	};
+	constexpr Grammar::Operand operands_0_104[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_104[] = {
+		spv::Capability::Kernel,
+		spv::Capability::ImageQuery,
+	};
+	constexpr Grammar::Operand operands_0_105[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_105[] = {
+		spv::Capability::ImageQuery,
+	};
+	constexpr Grammar::Operand operands_0_106[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_106[] = {
+		spv::Capability::Kernel,
+		spv::Capability::ImageQuery,
+	};
+	constexpr Grammar::Operand operands_0_107[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_107[] = {
+		spv::Capability::Kernel,
+		spv::Capability::ImageQuery,
+	};
+	constexpr Grammar::Operand operands_0_109[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Float Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_110[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Float Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_111[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Signed Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_112[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Unsigned Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_113[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Unsigned Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_114[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Signed Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_115[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Float Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_116[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_117[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_117[] = {
+		spv::Capability::Addresses,
+		spv::Capability::PhysicalStorageBufferAddresses,
+	};
+	constexpr Grammar::Operand operands_0_118[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Signed Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_118[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_119[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Unsigned Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_119[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_120[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Integer Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_120[] = {
+		spv::Capability::Addresses,
+		spv::Capability::PhysicalStorageBufferAddresses,
+	};
+	constexpr Grammar::Operand operands_0_121[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_121[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_122[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_122[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_123[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::StorageClass, OperandCategory::ValueEnum, "'Storage'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_123[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_124[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_126[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_127[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_128[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_129[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_130[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_131[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_132[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_133[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_134[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_135[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_136[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_137[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_138[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_139[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_140[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_141[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_142[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Scalar'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_143[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Matrix'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Scalar'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_143[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_144[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Matrix'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_144[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_145[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Matrix'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_145[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_146[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'LeftMatrix'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RightMatrix'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_146[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_147[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_147[] = {
+		spv::Capability::Matrix,
+	};
+	constexpr Grammar::Operand operands_0_148[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_149[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_150[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_151[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_152[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_154[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_155[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Vector'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_156[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_157[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_158[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_158[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_159[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_159[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_160[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_160[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_161[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_161[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_162[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_162[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_163[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_163[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_164[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_165[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_166[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_167[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_168[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_169[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Condition'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Object 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Object 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_170[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_171[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_172[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_173[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_174[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_175[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_176[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_177[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_178[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_179[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_180[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_181[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_182[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_183[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_184[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_185[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_186[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_187[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_188[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_189[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_190[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_191[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_194[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Shift'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_195[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Shift'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_196[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Shift'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_197[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_198[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_199[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_200[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_201[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Insert'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Count'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_201[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_202[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Count'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_202[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_203[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Count'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_203[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_204[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_204[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_205[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Base'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_207[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_207[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_208[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_208[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_209[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_209[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_210[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_210[] = {
+		spv::Capability::DerivativeControl,
+	};
+	constexpr Grammar::Operand operands_0_211[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_211[] = {
+		spv::Capability::DerivativeControl,
+	};
+	constexpr Grammar::Operand operands_0_212[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_212[] = {
+		spv::Capability::DerivativeControl,
+	};
+	constexpr Grammar::Operand operands_0_213[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_213[] = {
+		spv::Capability::DerivativeControl,
+	};
+	constexpr Grammar::Operand operands_0_214[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_214[] = {
+		spv::Capability::DerivativeControl,
+	};
+	constexpr Grammar::Operand operands_0_215[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'P'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_215[] = {
+		spv::Capability::DerivativeControl,
+	};
+	constexpr spv::Capability capabilities_0_218[] = {
+		spv::Capability::Geometry,
+	};
+	constexpr spv::Capability capabilities_0_219[] = {
+		spv::Capability::Geometry,
+	};
+	constexpr Grammar::Operand operands_0_220[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Stream'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_220[] = {
+		spv::Capability::GeometryStreams,
+	};
+	constexpr Grammar::Operand operands_0_221[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Stream'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_221[] = {
+		spv::Capability::GeometryStreams,
+	};
+	constexpr Grammar::Operand operands_0_224[] = {
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_225[] = {
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_227[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_228[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_229[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_230[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Equal'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Unequal'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Comparator'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_231[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Equal'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Unequal'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Comparator'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_231[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_232[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_233[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_234[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_235[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_236[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_237[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_238[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_239[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_240[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_241[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_242[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_245[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::PairIdRefIdRef, OperandCategory::Composite, "'Variable, Parent, ...'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_246[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Merge Block'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Continue Target'", Quantifier::One },
+		{ OperandKind::LoopControl, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_247[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Merge Block'", Quantifier::One },
+		{ OperandKind::SelectionControl, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_248[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_249[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target Label'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_250[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Condition'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'True Label'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'False Label'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Branch weights'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_0_251[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Selector'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Default'", Quantifier::One },
+		{ OperandKind::PairLiteralIntegerIdRef, OperandCategory::Composite, "'Target'", Quantifier::ZeroOrAny },
+	};
+	constexpr spv::Capability capabilities_0_252[] = {
+		spv::Capability::Shader,
+	};
+	constexpr Grammar::Operand operands_0_254[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_256[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Size'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_256[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_257[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Size'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_257[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_259[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Destination'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Source'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Elements'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Stride'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Event'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_259[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_260[] = {
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Events'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Events List'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_260[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_261[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_261[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_262[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_262[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_263[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'LocalId'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_263[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_264[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_264[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_265[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_265[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_266[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_266[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_267[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_267[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_268[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_268[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_269[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_269[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_270[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_270[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_271[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_271[] = {
+		spv::Capability::Groups,
+	};
+	constexpr Grammar::Operand operands_0_274[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_274[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_275[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_275[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_276[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_276[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_277[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_277[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_278[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Packets'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_278[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_279[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Packets'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_279[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_280[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_280[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_281[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_281[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_282[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_282[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_283[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_283[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_284[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_284[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_285[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Packets'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_285[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_286[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Packets'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_286[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_287[] = {
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_287[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_288[] = {
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reserve Id'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_288[] = {
+		spv::Capability::Pipes,
+	};
+	constexpr Grammar::Operand operands_0_291[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Queue'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Events'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Wait Events'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ret Event'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_291[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_292[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Queue'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Flags'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ND Range'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Num Events'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Wait Events'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ret Event'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Local Size'", Quantifier::ZeroOrAny },
+	};
+	constexpr spv::Capability capabilities_0_292[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_293[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ND Range'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_293[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_294[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ND Range'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_294[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_295[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_295[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_296[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_296[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_297[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Event'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_297[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_298[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Event'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_298[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_299[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_299[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_300[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Event'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_300[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_301[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Event'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Status'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_301[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_302[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Event'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Profiling Info'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_302[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_303[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_303[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_304[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'GlobalWorkSize'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'LocalWorkSize'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'GlobalWorkOffset'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_304[] = {
+		spv::Capability::DeviceEnqueue,
+	};
+	constexpr Grammar::Operand operands_0_305[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_305[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_306[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_306[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_307[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_307[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_308[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_308[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_309[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_309[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_310[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_310[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_311[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_311[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_312[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_312[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_313[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_313[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_314[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Component'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_314[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_315[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'D~ref~'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_315[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_316[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Resident Code'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_316[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_318[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_318[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_319[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_319[] = {
+		spv::Capability::Kernel,
+	};
+	constexpr Grammar::Operand operands_0_320[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_320[] = {
+		spv::Capability::SparseResidency,
+	};
+	constexpr Grammar::Operand operands_0_321[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_321[] = {
+		spv::Capability::Addresses,
+	};
+	constexpr Grammar::Operand operands_0_322[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_322[] = {
+		spv::Capability::PipeStorage,
+	};
+	constexpr Grammar::Operand operands_0_323[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Packet Size'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Packet Alignment'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Capacity'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_323[] = {
+		spv::Capability::PipeStorage,
+	};
+	constexpr Grammar::Operand operands_0_324[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pipe Storage'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_324[] = {
+		spv::Capability::PipeStorage,
+	};
+	constexpr Grammar::Operand operands_0_325[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Subgroup Count'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_325[] = {
+		spv::Capability::SubgroupDispatch,
+	};
+	constexpr Grammar::Operand operands_0_326[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Invoke'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Param Align'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_326[] = {
+		spv::Capability::SubgroupDispatch,
+	};
+	constexpr Grammar::Operand operands_0_327[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_327[] = {
+		spv::Capability::NamedBarrier,
+	};
+	constexpr Grammar::Operand operands_0_328[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Subgroup Count'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_328[] = {
+		spv::Capability::NamedBarrier,
+	};
+	constexpr Grammar::Operand operands_0_329[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Named Barrier'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Memory'", Quantifier::One },
+		{ OperandKind::IdMemorySemantics, OperandCategory::Id, "'Semantics'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_329[] = {
+		spv::Capability::NamedBarrier,
+	};
+	constexpr Grammar::Operand operands_0_330[] = {
+		{ OperandKind::LiteralString, OperandCategory::Literal, "'Process'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_331[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Entry Point'", Quantifier::One },
+		{ OperandKind::ExecutionMode, OperandCategory::ValueEnum, "'Mode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_332[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target'", Quantifier::One },
+		{ OperandKind::Decoration, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr spv::Extension extensions_0_332[] = {
+		spv::Extension::SPV_GOOGLE_hlsl_functionality1,
+	};
+	constexpr Grammar::Operand operands_0_333[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_333[] = {
+		spv::Capability::GroupNonUniform,
+	};
+	constexpr Grammar::Operand operands_0_334[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_334[] = {
+		spv::Capability::GroupNonUniformVote,
+	};
+	constexpr Grammar::Operand operands_0_335[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_335[] = {
+		spv::Capability::GroupNonUniformVote,
+	};
+	constexpr Grammar::Operand operands_0_336[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_336[] = {
+		spv::Capability::GroupNonUniformVote,
+	};
+	constexpr Grammar::Operand operands_0_337[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Id'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_337[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_338[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_338[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_339[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_339[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_340[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_340[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_341[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_341[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_342[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_342[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_343[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_343[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_344[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_344[] = {
+		spv::Capability::GroupNonUniformBallot,
+	};
+	constexpr Grammar::Operand operands_0_345[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Id'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_345[] = {
+		spv::Capability::GroupNonUniformShuffle,
+	};
+	constexpr Grammar::Operand operands_0_346[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Mask'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_346[] = {
+		spv::Capability::GroupNonUniformShuffle,
+	};
+	constexpr Grammar::Operand operands_0_347[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Delta'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_347[] = {
+		spv::Capability::GroupNonUniformShuffleRelative,
+	};
+	constexpr Grammar::Operand operands_0_348[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Delta'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_348[] = {
+		spv::Capability::GroupNonUniformShuffleRelative,
+	};
+	constexpr Grammar::Operand operands_0_349[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_349[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_350[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_350[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_351[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_351[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_352[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_352[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_353[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_353[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_354[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_354[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_355[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_355[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_356[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_356[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_357[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_357[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_358[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_358[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_359[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_359[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_360[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_360[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_361[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_361[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_362[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_362[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_363[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_363[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_364[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ClusterSize'", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_364[] = {
+		spv::Capability::GroupNonUniformArithmetic,
+		spv::Capability::GroupNonUniformClustered,
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr Grammar::Operand operands_0_365[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_365[] = {
+		spv::Capability::GroupNonUniformQuad,
+	};
+	constexpr Grammar::Operand operands_0_366[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_366[] = {
+		spv::Capability::GroupNonUniformQuad,
+	};
+	constexpr Grammar::Operand operands_0_400[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_401[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_402[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_0_403[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_403[] = {
+		spv::Capability::Addresses,
+		spv::Capability::VariablePointers,
+		spv::Capability::VariablePointersStorageBuffer,
+	};
+	constexpr Grammar::Operand operands_0_4421[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4421[] = {
+		spv::Capability::SubgroupBallotKHR,
+	};
+	constexpr spv::Extension extensions_0_4421[] = {
+		spv::Extension::SPV_KHR_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_4422[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4422[] = {
+		spv::Capability::SubgroupBallotKHR,
+	};
+	constexpr spv::Extension extensions_0_4422[] = {
+		spv::Extension::SPV_KHR_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_4428[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4428[] = {
+		spv::Capability::SubgroupVoteKHR,
+	};
+	constexpr spv::Extension extensions_0_4428[] = {
+		spv::Extension::SPV_KHR_subgroup_vote,
+	};
+	constexpr Grammar::Operand operands_0_4429[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4429[] = {
+		spv::Capability::SubgroupVoteKHR,
+	};
+	constexpr spv::Extension extensions_0_4429[] = {
+		spv::Extension::SPV_KHR_subgroup_vote,
+	};
+	constexpr Grammar::Operand operands_0_4430[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Predicate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4430[] = {
+		spv::Capability::SubgroupVoteKHR,
+	};
+	constexpr spv::Extension extensions_0_4430[] = {
+		spv::Extension::SPV_KHR_subgroup_vote,
+	};
+	constexpr Grammar::Operand operands_0_4432[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4432[] = {
+		spv::Capability::SubgroupBallotKHR,
+	};
+	constexpr spv::Extension extensions_0_4432[] = {
+		spv::Extension::SPV_KHR_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_4472[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4472[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4472[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_4473[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Accel'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayFlags'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'CullMask'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayOrigin'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayTMin'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayDirection'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayTMax'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4473[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4473[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_4474[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4474[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4474[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_4475[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'HitT'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4475[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4475[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_4476[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4476[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4476[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_4477[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4477[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4477[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_4479[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_4479[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_4479[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_5000[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5000[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5000[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5001[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5001[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5001[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5002[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5002[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5002[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5003[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5003[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5003[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5004[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5004[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5004[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5005[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5005[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5005[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5006[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5006[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5006[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5007[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::GroupOperation, OperandCategory::ValueEnum, "'Operation'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'X'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5007[] = {
+		spv::Capability::Groups,
+	};
+	constexpr spv::Extension extensions_0_5007[] = {
+		spv::Extension::SPV_AMD_shader_ballot,
+	};
+	constexpr Grammar::Operand operands_0_5011[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5011[] = {
+		spv::Capability::FragmentMaskAMD,
+	};
+	constexpr spv::Extension extensions_0_5011[] = {
+		spv::Extension::SPV_AMD_shader_fragment_mask,
+	};
+	constexpr Grammar::Operand operands_0_5012[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fragment Index'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5012[] = {
+		spv::Capability::FragmentMaskAMD,
+	};
+	constexpr spv::Extension extensions_0_5012[] = {
+		spv::Extension::SPV_AMD_shader_fragment_mask,
+	};
+	constexpr Grammar::Operand operands_0_5056[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5056[] = {
+		spv::Capability::ShaderClockKHR,
+	};
+	constexpr spv::Extension extensions_0_5056[] = {
+		spv::Extension::SPV_KHR_shader_clock,
+	};
+	constexpr Grammar::Operand operands_0_5283[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampled Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Granularity'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coarse'", Quantifier::One },
+		{ OperandKind::ImageOperands, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_5283[] = {
+		spv::Capability::ImageFootprintNV,
+	};
+	constexpr spv::Extension extensions_0_5283[] = {
+		spv::Extension::SPV_NV_shader_image_footprint,
+	};
+	constexpr Grammar::Operand operands_0_5296[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5296[] = {
+		spv::Capability::GroupNonUniformPartitionedNV,
+	};
+	constexpr spv::Extension extensions_0_5296[] = {
+		spv::Extension::SPV_NV_shader_subgroup_partitioned,
+	};
+	constexpr Grammar::Operand operands_0_5299[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Index Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Indices'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5299[] = {
+		spv::Capability::MeshShadingNV,
+	};
+	constexpr spv::Extension extensions_0_5299[] = {
+		spv::Extension::SPV_NV_mesh_shader,
+	};
+	constexpr Grammar::Operand operands_0_5334[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Hit'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'HitKind'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5334[] = {
+		spv::Capability::RayTracingNV,
+		spv::Capability::RayTracingProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_5334[] = {
+		spv::Extension::SPV_NV_ray_tracing,
+		spv::Extension::SPV_KHR_ray_tracing,
+	};
+	constexpr spv::Capability capabilities_0_5335[] = {
+		spv::Capability::RayTracingNV,
+		spv::Capability::RayTracingProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_5335[] = {
+		spv::Extension::SPV_NV_ray_tracing,
+		spv::Extension::SPV_KHR_ray_tracing,
+	};
+	constexpr spv::Capability capabilities_0_5336[] = {
+		spv::Capability::RayTracingNV,
+		spv::Capability::RayTracingProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_5336[] = {
+		spv::Extension::SPV_NV_ray_tracing,
+		spv::Extension::SPV_KHR_ray_tracing,
+	};
+	constexpr Grammar::Operand operands_0_5337[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Accel'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ray Flags'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Cull Mask'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'SBT Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'SBT Stride'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Miss Index'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ray Origin'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ray Tmin'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ray Direction'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ray Tmax'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'PayloadId'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5337[] = {
+		spv::Capability::RayTracingNV,
+		spv::Capability::RayTracingProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_5337[] = {
+		spv::Extension::SPV_NV_ray_tracing,
+		spv::Extension::SPV_KHR_ray_tracing,
+	};
+	constexpr Grammar::Operand operands_0_5341[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5341[] = {
+		spv::Capability::RayTracingNV,
+		spv::Capability::RayTracingProvisionalKHR,
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_5341[] = {
+		spv::Extension::SPV_NV_ray_tracing,
+		spv::Extension::SPV_KHR_ray_tracing,
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_5344[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'SBT Index'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Callable DataId'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5344[] = {
+		spv::Capability::RayTracingNV,
+		spv::Capability::RayTracingProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_5344[] = {
+		spv::Extension::SPV_NV_ray_tracing,
+		spv::Extension::SPV_KHR_ray_tracing,
+	};
+	constexpr Grammar::Operand operands_0_5358[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Component Type'", Quantifier::One },
+		{ OperandKind::IdScope, OperandCategory::Id, "'Execution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Rows'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Columns'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5358[] = {
+		spv::Capability::CooperativeMatrixNV,
+	};
+	constexpr spv::Extension extensions_0_5358[] = {
+		spv::Extension::SPV_NV_cooperative_matrix,
+	};
+	constexpr Grammar::Operand operands_0_5359[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Stride'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Column Major'", Quantifier::One },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_5359[] = {
+		spv::Capability::CooperativeMatrixNV,
+	};
+	constexpr spv::Extension extensions_0_5359[] = {
+		spv::Extension::SPV_NV_cooperative_matrix,
+	};
+	constexpr Grammar::Operand operands_0_5360[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pointer'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Object'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Stride'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Column Major'", Quantifier::One },
+		{ OperandKind::MemoryAccess, OperandCategory::BitEnum, "", Quantifier::ZeroOrOne },
+	};
+	constexpr spv::Capability capabilities_0_5360[] = {
+		spv::Capability::CooperativeMatrixNV,
+	};
+	constexpr spv::Extension extensions_0_5360[] = {
+		spv::Extension::SPV_NV_cooperative_matrix,
+	};
+	constexpr Grammar::Operand operands_0_5361[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'A'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'B'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'C'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5361[] = {
+		spv::Capability::CooperativeMatrixNV,
+	};
+	constexpr spv::Extension extensions_0_5361[] = {
+		spv::Extension::SPV_NV_cooperative_matrix,
+	};
+	constexpr Grammar::Operand operands_0_5362[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Type'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5362[] = {
+		spv::Capability::CooperativeMatrixNV,
+	};
+	constexpr spv::Extension extensions_0_5362[] = {
+		spv::Extension::SPV_NV_cooperative_matrix,
+	};
+	constexpr spv::Capability capabilities_0_5364[] = {
+		spv::Capability::FragmentShaderSampleInterlockEXT,
+		spv::Capability::FragmentShaderPixelInterlockEXT,
+		spv::Capability::FragmentShaderShadingRateInterlockEXT,
+	};
+	constexpr spv::Extension extensions_0_5364[] = {
+		spv::Extension::SPV_EXT_fragment_shader_interlock,
+	};
+	constexpr spv::Capability capabilities_0_5365[] = {
+		spv::Capability::FragmentShaderSampleInterlockEXT,
+		spv::Capability::FragmentShaderPixelInterlockEXT,
+		spv::Capability::FragmentShaderShadingRateInterlockEXT,
+	};
+	constexpr spv::Extension extensions_0_5365[] = {
+		spv::Extension::SPV_EXT_fragment_shader_interlock,
+	};
+	constexpr spv::Capability capabilities_0_5380[] = {
+		spv::Capability::DemoteToHelperInvocationEXT,
+	};
+	constexpr spv::Extension extensions_0_5380[] = {
+		spv::Extension::SPV_EXT_demote_to_helper_invocation,
+	};
+	constexpr Grammar::Operand operands_0_5381[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5381[] = {
+		spv::Capability::DemoteToHelperInvocationEXT,
+	};
+	constexpr spv::Extension extensions_0_5381[] = {
+		spv::Extension::SPV_EXT_demote_to_helper_invocation,
+	};
+	constexpr Grammar::Operand operands_0_5571[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'InvocationId'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5571[] = {
+		spv::Capability::SubgroupShuffleINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5572[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Current'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Next'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Delta'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5572[] = {
+		spv::Capability::SubgroupShuffleINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5573[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Previous'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Current'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Delta'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5573[] = {
+		spv::Capability::SubgroupShuffleINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5574[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5574[] = {
+		spv::Capability::SubgroupShuffleINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5575[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ptr'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5575[] = {
+		spv::Capability::SubgroupBufferBlockIOINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5576[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ptr'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Data'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5576[] = {
+		spv::Capability::SubgroupBufferBlockIOINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5577[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5577[] = {
+		spv::Capability::SubgroupImageBlockIOINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5578[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Data'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5578[] = {
+		spv::Capability::SubgroupImageBlockIOINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5580[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Width'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Height'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5580[] = {
+		spv::Capability::SubgroupImageMediaBlockIOINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5581[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Coordinate'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Width'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Height'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Data'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5581[] = {
+		spv::Capability::SubgroupImageMediaBlockIOINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5585[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5585[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5586[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5586[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5587[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5587[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5588[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5588[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5589[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5589[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5590[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5590[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5591[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5591[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5592[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5592[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5593[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5593[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5594[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5594[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5595[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5595[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5596[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5596[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5597[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5597[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5598[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 2'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5598[] = {
+		spv::Capability::IntegerFunctions2INTEL,
+	};
+	constexpr Grammar::Operand operands_0_5600[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Function'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5600[] = {
+		spv::Capability::FunctionPointersINTEL,
+	};
+	constexpr spv::Extension extensions_0_5600[] = {
+		spv::Extension::SPV_INTEL_function_pointers,
+	};
+	constexpr Grammar::Operand operands_0_5601[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Operand 1'", Quantifier::ZeroOrAny },
+	};
+	constexpr spv::Capability capabilities_0_5601[] = {
+		spv::Capability::FunctionPointersINTEL,
+	};
+	constexpr spv::Extension extensions_0_5601[] = {
+		spv::Extension::SPV_INTEL_function_pointers,
+	};
+	constexpr Grammar::Operand operands_0_5632[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Target'", Quantifier::One },
+		{ OperandKind::Decoration, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr spv::Extension extensions_0_5632[] = {
+		spv::Extension::SPV_GOOGLE_decorate_string,
+		spv::Extension::SPV_GOOGLE_hlsl_functionality1,
+	};
+	constexpr Grammar::Operand operands_0_5633[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Struct Type'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Member'", Quantifier::One },
+		{ OperandKind::Decoration, OperandCategory::ValueEnum, "", Quantifier::One },
+	};
+	constexpr spv::Extension extensions_0_5633[] = {
+		spv::Extension::SPV_GOOGLE_decorate_string,
+		spv::Extension::SPV_GOOGLE_hlsl_functionality1,
+	};
+	constexpr Grammar::Operand operands_0_5699[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sampler'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5699[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5700[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image Type'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5700[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5701[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5701[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5702[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5702[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5703[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5703[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5704[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5704[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5705[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5705[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5706[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5706[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5707[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5707[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5708[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5708[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5709[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5709[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5710[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5710[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5711[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5711[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5712[] = {
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5712[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5713[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Slice Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Qp'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5713[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5714[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reference Base Penalty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5714[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5715[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Slice Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Qp'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5715[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5716[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Shape Penalty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5716[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5717[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Slice Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Qp'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5717[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5718[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction Cost'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5718[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5719[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Slice Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Qp'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5719[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5720[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Slice Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Qp'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5720[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5721[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5721[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5722[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5722[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5723[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5723[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5724[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Cost Center Delta'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Cost Table'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Cost Precision'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5724[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5725[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Slice Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Qp'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5725[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5726[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5726[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5727[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5727[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationChromaINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5728[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5728[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5729[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Source Field Polarity'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5729[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5730[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Reference Field Polarity'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5730[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5731[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Forward Reference Field Polarity'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Backward Reference Field Polarity'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5731[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5732[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5732[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5733[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5733[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5734[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5734[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5735[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5735[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5736[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5736[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5737[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5737[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5738[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5738[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5739[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5739[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5740[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5740[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5741[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5741[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5742[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5742[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5743[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5743[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5744[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5744[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5745[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5745[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5746[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Parameter Field Polarities'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5746[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5747[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Coord'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Partition Mask'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'SAD Adjustment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5747[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5748[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Search Window Config'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5748[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5749[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'id> Search Window Config'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5749[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5750[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Search Window Config'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Dual Ref'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5750[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5751[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Coord'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Window Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image Size'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5751[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5752[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5752[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5753[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Max Motion Vector Count'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5753[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5754[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5754[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5755[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Threshold'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5755[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5756[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Sad Weights'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5756[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5757[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5757[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5758[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5758[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5759[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5759[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5760[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5760[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5761[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5761[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5762[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5762[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5763[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5763[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5764[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Streamin Components'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5764[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5765[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5765[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5766[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5766[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5767[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5767[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5768[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5768[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5769[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5769[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5770[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shape'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5770[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5771[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shape'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5771[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5772[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shape'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5772[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5773[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shape'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5773[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5774[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shape'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5774[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5775[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shape'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5775[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5776[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Image Select'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5776[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5777[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5777[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5778[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5778[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5779[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5779[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5780[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5780[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5781[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Coord'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Motion Vectors'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shapes'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Minor Shapes'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pixel Resolution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5781[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5782[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Coord'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Motion Vectors'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Major Shapes'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Minor Shapes'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Pixel Resolution'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bidirectional Weight'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5782[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5783[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5783[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5784[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5784[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5785[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5785[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5786[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5786[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5787[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5787[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5788[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5788[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5789[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Field Polarities'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5789[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5790[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5790[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5791[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Coord'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5791[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5792[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Skip Block Partition Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Skip Motion Vector Mask'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Motion Vectors'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bidirectional Weight'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5792[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5793[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Luma Intra Partition Mask'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intra Neighbour Availabilty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Left Edge Luma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Left Corner Luma Pixel'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Edge Luma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Right Edge Luma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5793[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5794[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Luma Intra Partition Mask'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intra Neighbour Availabilty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Left Edge Luma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Left Corner Luma Pixel'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Edge Luma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Right Edge Luma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Left Edge Chroma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Left Corner Chroma Pixel'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Upper Edge Chroma Pixels'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Sad Adjustment'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5794[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationChromaINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5795[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Skip Block Partition Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Direction'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5795[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5796[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5796[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5797[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Shape Penalty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5797[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5798[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Luma Mode Penalty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Luma Packed Neighbor Modes'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Luma Packed Non Dc Penalty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5798[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5799[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Chroma Mode Base Penalty'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5799[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationChromaINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5800[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5800[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5801[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Sad Coefficients'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5801[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5802[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Block Based Skip Type'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5802[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5803[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5803[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5804[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5804[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5805[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Fwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Bwd Ref Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5805[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5806[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5806[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5807[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Src Image'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Ids'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packed Reference Field Polarities'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5807[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5808[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5808[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5809[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5809[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5810[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5810[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5811[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5811[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5812[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5812[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5813[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5813[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationChromaINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5814[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5814[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5815[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5815[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+		spv::Capability::SubgroupAvcMotionEstimationIntraINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5816[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Payload'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5816[] = {
+		spv::Capability::SubgroupAvcMotionEstimationINTEL,
+	};
+	constexpr Grammar::Operand operands_0_5887[] = {
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'Loop Control Parameters'", Quantifier::ZeroOrAny },
+	};
+	constexpr spv::Capability capabilities_0_5887[] = {
+		spv::Capability::UnstructuredLoopControlsINTEL,
+	};
+	constexpr spv::Extension extensions_0_5887[] = {
+		spv::Extension::SPV_INTEL_unstructured_loop_controls,
+	};
+	constexpr Grammar::Operand operands_0_5946[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5946[] = {
+		spv::Capability::BlockingPipesINTEL,
+	};
+	constexpr spv::Extension extensions_0_5946[] = {
+		spv::Extension::SPV_INTEL_blocking_pipes,
+	};
+	constexpr Grammar::Operand operands_0_5947[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Size'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Packet Alignment'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5947[] = {
+		spv::Capability::BlockingPipesINTEL,
+	};
+	constexpr spv::Extension extensions_0_5947[] = {
+		spv::Extension::SPV_INTEL_blocking_pipes,
+	};
+	constexpr Grammar::Operand operands_0_5949[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Result'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Input'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_5949[] = {
+		spv::Capability::FPGARegINTEL,
+	};
+	constexpr spv::Extension extensions_0_5949[] = {
+		spv::Extension::SPV_INTEL_fpga_reg,
+	};
+	constexpr Grammar::Operand operands_0_6016[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6016[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6016[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6017[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6017[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6017[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6018[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6018[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6018[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6019[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6019[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6019[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6020[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6020[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6020[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6021[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6021[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6021[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6022[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6022[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6022[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6023[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6023[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6023[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6024[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6024[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6024[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6025[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6025[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6025[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6026[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6026[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6026[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6027[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6027[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6027[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6028[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6028[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6028[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6029[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6029[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6029[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6030[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6030[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6030[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6031[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6031[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6031[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_0_6032[] = {
+		{ OperandKind::IdResultType, OperandCategory::Id, "ResultType", Quantifier::One },
+		{ OperandKind::IdResult, OperandCategory::Id, "Result", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'RayQuery'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Intersection'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_0_6032[] = {
+		spv::Capability::RayQueryProvisionalKHR,
+	};
+	constexpr spv::Extension extensions_0_6032[] = {
+		spv::Extension::SPV_KHR_ray_query,
+	};
+	constexpr Grammar::Operand operands_1_1[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_2[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_3[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_4[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_5[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_6[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_7[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_8[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_9[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_10[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_11[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'degrees'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_12[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'radians'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_13[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_14[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_15[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_16[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_17[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_18[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'y_over_x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_19[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_20[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_21[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_22[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_23[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_24[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_25[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_26[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_27[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_28[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_29[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_30[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_31[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_32[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_33[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_34[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_35[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'i'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_36[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_37[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_38[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_39[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_40[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_41[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_42[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_43[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minVal'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxVal'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_44[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minVal'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxVal'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_45[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minVal'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxVal'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_46[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_47[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_48[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'edge'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_49[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'edge0'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'edge1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_50[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_51[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'exp'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_52[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_53[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'exp'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_54[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_55[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_56[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_57[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_58[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_59[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_1_59[] = {
+		spv::Capability::Float64,
+	};
+	constexpr Grammar::Operand operands_1_60[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_61[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_62[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_63[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_64[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_65[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_1_65[] = {
+		spv::Capability::Float64,
+	};
+	constexpr Grammar::Operand operands_1_66[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_67[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p0'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p1'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_68[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_69[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_70[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'N'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'I'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'Nref'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_71[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'I'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'N'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_72[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'I'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'N'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'eta'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_73[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_74[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_75[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'Value'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_76[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'interpolant'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_1_76[] = {
+		spv::Capability::InterpolationFunction,
+	};
+	constexpr Grammar::Operand operands_1_77[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'interpolant'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'sample'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_1_77[] = {
+		spv::Capability::InterpolationFunction,
+	};
+	constexpr Grammar::Operand operands_1_78[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'interpolant'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+	};
+	constexpr spv::Capability capabilities_1_78[] = {
+		spv::Capability::InterpolationFunction,
+	};
+	constexpr Grammar::Operand operands_1_79[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_80[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_1_81[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minVal'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxVal'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_0[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_1[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_2[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_3[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_4[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_5[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_6[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_7[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_8[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_9[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_10[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_11[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_12[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_13[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_14[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_15[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_16[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_17[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_18[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_19[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_20[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_21[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_22[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_23[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_24[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_25[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_26[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_27[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_28[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_29[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_30[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'ptr'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_31[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'exp'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_32[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_33[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_34[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'k'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_35[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_36[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'signp'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_37[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_38[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_39[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_40[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_41[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_42[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_43[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_44[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_45[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'iptr'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_46[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'nancode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_47[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_48[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_49[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_50[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_51[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_52[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'quo'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_53[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_54[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_55[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_56[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_57[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_58[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'cosval'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_59[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_60[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_61[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_62[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_63[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_64[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_65[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_66[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_67[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_68[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_69[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_70[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_71[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_72[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_73[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_74[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_75[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_76[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_77[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_78[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_79[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_80[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_81[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_82[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_83[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_84[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_85[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_86[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_87[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_88[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_89[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_90[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_91[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_92[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_93[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_94[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_141[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_142[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_143[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_144[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_145[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_146[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_147[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_148[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_149[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minval'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxval'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_150[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minval'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxval'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_151[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_152[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_153[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_154[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'z'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_155[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'z'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_156[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_157[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_158[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_159[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_160[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_161[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'v'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'i'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_162[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_163[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_164[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'hi'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'lo'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_165[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'hi'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'lo'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_166[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_167[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'z'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_168[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'z'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_169[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_170[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_201[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_202[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_203[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_204[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_95[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'minval'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'maxval'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_96[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'radians'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_97[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_98[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_99[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_100[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'degrees'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_101[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'edge'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_102[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'edge0'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'edge1'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_103[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_104[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p0'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p1'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_105[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p0'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p1'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_106[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_107[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_108[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p0'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p1'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_109[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_110[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_186[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_187[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'a'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'b'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'c'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_171[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'n'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_172[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_173[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_174[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'n'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_175[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_176[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+		{ OperandKind::FPRoundingMode, OperandCategory::ValueEnum, "'mode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_177[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_178[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+		{ OperandKind::FPRoundingMode, OperandCategory::ValueEnum, "'mode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_179[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+		{ OperandKind::LiteralInteger, OperandCategory::Literal, "'n'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_180[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_181[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'data'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'offset'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'p'", Quantifier::One },
+		{ OperandKind::FPRoundingMode, OperandCategory::ValueEnum, "'mode'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_182[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'shuffle mask'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_183[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'x'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'y'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'shuffle mask'", Quantifier::One },
+	};
+	constexpr Grammar::Operand operands_2_184[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'format'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'additional arguments'", Quantifier::ZeroOrAny },
+	};
+	constexpr Grammar::Operand operands_2_185[] = {
+		{ OperandKind::IdRef, OperandCategory::Id, "'ptr'", Quantifier::One },
+		{ OperandKind::IdRef, OperandCategory::Id, "'num elements'", Quantifier::One },
+	};
+
+	constexpr Grammar::Instruction instructions[] = {
+		{ "OpNop", { nullptr, 0u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUndef", { operands_0_1, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSourceContinued", { operands_0_2, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSource", { operands_0_3, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSourceExtension", { operands_0_4, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpName", { operands_0_5, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpMemberName", { operands_0_6, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpString", { operands_0_7, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLine", { operands_0_8, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpExtension", { operands_0_10, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpExtInstImport", { operands_0_11, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpExtInst", { operands_0_12, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpMemoryModel", { operands_0_14, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpEntryPoint", { operands_0_15, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpExecutionMode", { operands_0_16, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCapability", { operands_0_17, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeVoid", { operands_0_19, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeBool", { operands_0_20, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeInt", { operands_0_21, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeFloat", { operands_0_22, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeVector", { operands_0_23, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeMatrix", { operands_0_24, 3u }, { capabilities_0_24, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeImage", { operands_0_25, 9u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeSampler", { operands_0_26, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeSampledImage", { operands_0_27, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeArray", { operands_0_28, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeRuntimeArray", { operands_0_29, 2u }, { capabilities_0_29, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeStruct", { operands_0_30, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeOpaque", { operands_0_31, 2u }, { capabilities_0_31, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypePointer", { operands_0_32, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeFunction", { operands_0_33, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTypeEvent", { operands_0_34, 1u }, { capabilities_0_34, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeDeviceEvent", { operands_0_35, 1u }, { capabilities_0_35, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeReserveId", { operands_0_36, 1u }, { capabilities_0_36, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeQueue", { operands_0_37, 1u }, { capabilities_0_37, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypePipe", { operands_0_38, 2u }, { capabilities_0_38, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeForwardPointer", { operands_0_39, 2u }, { capabilities_0_39, 2u }, { nullptr, 0u }, 0 },
+		{ "OpConstantTrue", { operands_0_41, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConstantFalse", { operands_0_42, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConstant", { operands_0_43, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConstantComposite", { operands_0_44, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConstantSampler", { operands_0_45, 5u }, { capabilities_0_45, 1u }, { nullptr, 0u }, 0 },
+		{ "OpConstantNull", { operands_0_46, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSpecConstantTrue", { operands_0_48, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSpecConstantFalse", { operands_0_49, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSpecConstant", { operands_0_50, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSpecConstantComposite", { operands_0_51, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSpecConstantOp", { operands_0_52, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFunction", { operands_0_54, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFunctionParameter", { operands_0_55, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFunctionEnd", { nullptr, 0u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFunctionCall", { operands_0_57, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpVariable", { operands_0_59, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImageTexelPointer", { operands_0_60, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLoad", { operands_0_61, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpStore", { operands_0_62, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCopyMemory", { operands_0_63, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCopyMemorySized", { operands_0_64, 5u }, { capabilities_0_64, 1u }, { nullptr, 0u }, 0 },
+		{ "OpAccessChain", { operands_0_65, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpInBoundsAccessChain", { operands_0_66, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpPtrAccessChain", { operands_0_67, 5u }, { capabilities_0_67, 4u }, { nullptr, 0u }, 0 },
+		{ "OpArrayLength", { operands_0_68, 4u }, { capabilities_0_68, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGenericPtrMemSemantics", { operands_0_69, 3u }, { capabilities_0_69, 1u }, { nullptr, 0u }, 0 },
+		{ "OpInBoundsPtrAccessChain", { operands_0_70, 5u }, { capabilities_0_70, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDecorate", { operands_0_71, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpMemberDecorate", { operands_0_72, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpDecorationGroup", { operands_0_73, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpGroupDecorate", { operands_0_74, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpGroupMemberDecorate", { operands_0_75, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpVectorExtractDynamic", { operands_0_77, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpVectorInsertDynamic", { operands_0_78, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpVectorShuffle", { operands_0_79, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCompositeConstruct", { operands_0_80, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCompositeExtract", { operands_0_81, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCompositeInsert", { operands_0_82, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpCopyObject", { operands_0_83, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpTranspose", { operands_0_84, 3u }, { capabilities_0_84, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSampledImage", { operands_0_86, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleImplicitLod", { operands_0_87, 5u }, { capabilities_0_87, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleExplicitLod", { operands_0_88, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleDrefImplicitLod", { operands_0_89, 6u }, { capabilities_0_89, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleDrefExplicitLod", { operands_0_90, 6u }, { capabilities_0_90, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleProjImplicitLod", { operands_0_91, 5u }, { capabilities_0_91, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleProjExplicitLod", { operands_0_92, 5u }, { capabilities_0_92, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleProjDrefImplicitLod", { operands_0_93, 6u }, { capabilities_0_93, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSampleProjDrefExplicitLod", { operands_0_94, 6u }, { capabilities_0_94, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageFetch", { operands_0_95, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImageGather", { operands_0_96, 6u }, { capabilities_0_96, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageDrefGather", { operands_0_97, 6u }, { capabilities_0_97, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageRead", { operands_0_98, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImageWrite", { operands_0_99, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImage", { operands_0_100, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpImageQueryFormat", { operands_0_101, 3u }, { capabilities_0_101, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageQueryOrder", { operands_0_102, 3u }, { capabilities_0_102, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageQuerySizeLod", { operands_0_103, 4u }, { capabilities_0_103, 2u }, { nullptr, 0u }, 0 },
+		{ "OpImageQuerySize", { operands_0_104, 3u }, { capabilities_0_104, 2u }, { nullptr, 0u }, 0 },
+		{ "OpImageQueryLod", { operands_0_105, 4u }, { capabilities_0_105, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageQueryLevels", { operands_0_106, 3u }, { capabilities_0_106, 2u }, { nullptr, 0u }, 0 },
+		{ "OpImageQuerySamples", { operands_0_107, 3u }, { capabilities_0_107, 2u }, { nullptr, 0u }, 0 },
+		{ "OpConvertFToU", { operands_0_109, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConvertFToS", { operands_0_110, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConvertSToF", { operands_0_111, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConvertUToF", { operands_0_112, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUConvert", { operands_0_113, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSConvert", { operands_0_114, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFConvert", { operands_0_115, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpQuantizeToF16", { operands_0_116, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpConvertPtrToU", { operands_0_117, 3u }, { capabilities_0_117, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSatConvertSToU", { operands_0_118, 3u }, { capabilities_0_118, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSatConvertUToS", { operands_0_119, 3u }, { capabilities_0_119, 1u }, { nullptr, 0u }, 0 },
+		{ "OpConvertUToPtr", { operands_0_120, 3u }, { capabilities_0_120, 2u }, { nullptr, 0u }, 0 },
+		{ "OpPtrCastToGeneric", { operands_0_121, 3u }, { capabilities_0_121, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGenericCastToPtr", { operands_0_122, 3u }, { capabilities_0_122, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGenericCastToPtrExplicit", { operands_0_123, 4u }, { capabilities_0_123, 1u }, { nullptr, 0u }, 0 },
+		{ "OpBitcast", { operands_0_124, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSNegate", { operands_0_126, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFNegate", { operands_0_127, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIAdd", { operands_0_128, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFAdd", { operands_0_129, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpISub", { operands_0_130, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFSub", { operands_0_131, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIMul", { operands_0_132, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFMul", { operands_0_133, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUDiv", { operands_0_134, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSDiv", { operands_0_135, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFDiv", { operands_0_136, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUMod", { operands_0_137, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSRem", { operands_0_138, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSMod", { operands_0_139, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFRem", { operands_0_140, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFMod", { operands_0_141, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpVectorTimesScalar", { operands_0_142, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpMatrixTimesScalar", { operands_0_143, 4u }, { capabilities_0_143, 1u }, { nullptr, 0u }, 0 },
+		{ "OpVectorTimesMatrix", { operands_0_144, 4u }, { capabilities_0_144, 1u }, { nullptr, 0u }, 0 },
+		{ "OpMatrixTimesVector", { operands_0_145, 4u }, { capabilities_0_145, 1u }, { nullptr, 0u }, 0 },
+		{ "OpMatrixTimesMatrix", { operands_0_146, 4u }, { capabilities_0_146, 1u }, { nullptr, 0u }, 0 },
+		{ "OpOuterProduct", { operands_0_147, 4u }, { capabilities_0_147, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDot", { operands_0_148, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIAddCarry", { operands_0_149, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpISubBorrow", { operands_0_150, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUMulExtended", { operands_0_151, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSMulExtended", { operands_0_152, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAny", { operands_0_154, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAll", { operands_0_155, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIsNan", { operands_0_156, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIsInf", { operands_0_157, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIsFinite", { operands_0_158, 3u }, { capabilities_0_158, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIsNormal", { operands_0_159, 3u }, { capabilities_0_159, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSignBitSet", { operands_0_160, 3u }, { capabilities_0_160, 1u }, { nullptr, 0u }, 0 },
+		{ "OpLessOrGreater", { operands_0_161, 4u }, { capabilities_0_161, 1u }, { nullptr, 0u }, 0 },
+		{ "OpOrdered", { operands_0_162, 4u }, { capabilities_0_162, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUnordered", { operands_0_163, 4u }, { capabilities_0_163, 1u }, { nullptr, 0u }, 0 },
+		{ "OpLogicalEqual", { operands_0_164, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLogicalNotEqual", { operands_0_165, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLogicalOr", { operands_0_166, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLogicalAnd", { operands_0_167, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLogicalNot", { operands_0_168, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSelect", { operands_0_169, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpIEqual", { operands_0_170, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpINotEqual", { operands_0_171, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUGreaterThan", { operands_0_172, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSGreaterThan", { operands_0_173, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUGreaterThanEqual", { operands_0_174, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSGreaterThanEqual", { operands_0_175, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpULessThan", { operands_0_176, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSLessThan", { operands_0_177, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpULessThanEqual", { operands_0_178, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSLessThanEqual", { operands_0_179, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFOrdEqual", { operands_0_180, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFUnordEqual", { operands_0_181, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFOrdNotEqual", { operands_0_182, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFUnordNotEqual", { operands_0_183, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFOrdLessThan", { operands_0_184, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFUnordLessThan", { operands_0_185, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFOrdGreaterThan", { operands_0_186, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFUnordGreaterThan", { operands_0_187, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFOrdLessThanEqual", { operands_0_188, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFUnordLessThanEqual", { operands_0_189, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFOrdGreaterThanEqual", { operands_0_190, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpFUnordGreaterThanEqual", { operands_0_191, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpShiftRightLogical", { operands_0_194, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpShiftRightArithmetic", { operands_0_195, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpShiftLeftLogical", { operands_0_196, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpBitwiseOr", { operands_0_197, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpBitwiseXor", { operands_0_198, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpBitwiseAnd", { operands_0_199, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpNot", { operands_0_200, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpBitFieldInsert", { operands_0_201, 6u }, { capabilities_0_201, 1u }, { nullptr, 0u }, 0 },
+		{ "OpBitFieldSExtract", { operands_0_202, 5u }, { capabilities_0_202, 1u }, { nullptr, 0u }, 0 },
+		{ "OpBitFieldUExtract", { operands_0_203, 5u }, { capabilities_0_203, 1u }, { nullptr, 0u }, 0 },
+		{ "OpBitReverse", { operands_0_204, 3u }, { capabilities_0_204, 1u }, { nullptr, 0u }, 0 },
+		{ "OpBitCount", { operands_0_205, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpDPdx", { operands_0_207, 3u }, { capabilities_0_207, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDPdy", { operands_0_208, 3u }, { capabilities_0_208, 1u }, { nullptr, 0u }, 0 },
+		{ "OpFwidth", { operands_0_209, 3u }, { capabilities_0_209, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDPdxFine", { operands_0_210, 3u }, { capabilities_0_210, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDPdyFine", { operands_0_211, 3u }, { capabilities_0_211, 1u }, { nullptr, 0u }, 0 },
+		{ "OpFwidthFine", { operands_0_212, 3u }, { capabilities_0_212, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDPdxCoarse", { operands_0_213, 3u }, { capabilities_0_213, 1u }, { nullptr, 0u }, 0 },
+		{ "OpDPdyCoarse", { operands_0_214, 3u }, { capabilities_0_214, 1u }, { nullptr, 0u }, 0 },
+		{ "OpFwidthCoarse", { operands_0_215, 3u }, { capabilities_0_215, 1u }, { nullptr, 0u }, 0 },
+		{ "OpEmitVertex", { nullptr, 0u }, { capabilities_0_218, 1u }, { nullptr, 0u }, 0 },
+		{ "OpEndPrimitive", { nullptr, 0u }, { capabilities_0_219, 1u }, { nullptr, 0u }, 0 },
+		{ "OpEmitStreamVertex", { operands_0_220, 1u }, { capabilities_0_220, 1u }, { nullptr, 0u }, 0 },
+		{ "OpEndStreamPrimitive", { operands_0_221, 1u }, { capabilities_0_221, 1u }, { nullptr, 0u }, 0 },
+		{ "OpControlBarrier", { operands_0_224, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpMemoryBarrier", { operands_0_225, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicLoad", { operands_0_227, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicStore", { operands_0_228, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicExchange", { operands_0_229, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicCompareExchange", { operands_0_230, 8u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicCompareExchangeWeak", { operands_0_231, 8u }, { capabilities_0_231, 1u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicIIncrement", { operands_0_232, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicIDecrement", { operands_0_233, 5u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicIAdd", { operands_0_234, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicISub", { operands_0_235, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicSMin", { operands_0_236, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicUMin", { operands_0_237, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicSMax", { operands_0_238, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicUMax", { operands_0_239, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicAnd", { operands_0_240, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicOr", { operands_0_241, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicXor", { operands_0_242, 6u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpPhi", { operands_0_245, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLoopMerge", { operands_0_246, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSelectionMerge", { operands_0_247, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLabel", { operands_0_248, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpBranch", { operands_0_249, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpBranchConditional", { operands_0_250, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpSwitch", { operands_0_251, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpKill", { nullptr, 0u }, { capabilities_0_252, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReturn", { nullptr, 0u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpReturnValue", { operands_0_254, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpUnreachable", { nullptr, 0u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpLifetimeStart", { operands_0_256, 2u }, { capabilities_0_256, 1u }, { nullptr, 0u }, 0 },
+		{ "OpLifetimeStop", { operands_0_257, 2u }, { capabilities_0_257, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupAsyncCopy", { operands_0_259, 8u }, { capabilities_0_259, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupWaitEvents", { operands_0_260, 3u }, { capabilities_0_260, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupAll", { operands_0_261, 4u }, { capabilities_0_261, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupAny", { operands_0_262, 4u }, { capabilities_0_262, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupBroadcast", { operands_0_263, 5u }, { capabilities_0_263, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupIAdd", { operands_0_264, 5u }, { capabilities_0_264, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupFAdd", { operands_0_265, 5u }, { capabilities_0_265, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupFMin", { operands_0_266, 5u }, { capabilities_0_266, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupUMin", { operands_0_267, 5u }, { capabilities_0_267, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupSMin", { operands_0_268, 5u }, { capabilities_0_268, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupFMax", { operands_0_269, 5u }, { capabilities_0_269, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupUMax", { operands_0_270, 5u }, { capabilities_0_270, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupSMax", { operands_0_271, 5u }, { capabilities_0_271, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReadPipe", { operands_0_274, 6u }, { capabilities_0_274, 1u }, { nullptr, 0u }, 0 },
+		{ "OpWritePipe", { operands_0_275, 6u }, { capabilities_0_275, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReservedReadPipe", { operands_0_276, 8u }, { capabilities_0_276, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReservedWritePipe", { operands_0_277, 8u }, { capabilities_0_277, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReserveReadPipePackets", { operands_0_278, 6u }, { capabilities_0_278, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReserveWritePipePackets", { operands_0_279, 6u }, { capabilities_0_279, 1u }, { nullptr, 0u }, 0 },
+		{ "OpCommitReadPipe", { operands_0_280, 4u }, { capabilities_0_280, 1u }, { nullptr, 0u }, 0 },
+		{ "OpCommitWritePipe", { operands_0_281, 4u }, { capabilities_0_281, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIsValidReserveId", { operands_0_282, 3u }, { capabilities_0_282, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetNumPipePackets", { operands_0_283, 5u }, { capabilities_0_283, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetMaxPipePackets", { operands_0_284, 5u }, { capabilities_0_284, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupReserveReadPipePackets", { operands_0_285, 7u }, { capabilities_0_285, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupReserveWritePipePackets", { operands_0_286, 7u }, { capabilities_0_286, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupCommitReadPipe", { operands_0_287, 5u }, { capabilities_0_287, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGroupCommitWritePipe", { operands_0_288, 5u }, { capabilities_0_288, 1u }, { nullptr, 0u }, 0 },
+		{ "OpEnqueueMarker", { operands_0_291, 6u }, { capabilities_0_291, 1u }, { nullptr, 0u }, 0 },
+		{ "OpEnqueueKernel", { operands_0_292, 13u }, { capabilities_0_292, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetKernelNDrangeSubGroupCount", { operands_0_293, 7u }, { capabilities_0_293, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetKernelNDrangeMaxSubGroupSize", { operands_0_294, 7u }, { capabilities_0_294, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetKernelWorkGroupSize", { operands_0_295, 6u }, { capabilities_0_295, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetKernelPreferredWorkGroupSizeMultiple", { operands_0_296, 6u }, { capabilities_0_296, 1u }, { nullptr, 0u }, 0 },
+		{ "OpRetainEvent", { operands_0_297, 1u }, { capabilities_0_297, 1u }, { nullptr, 0u }, 0 },
+		{ "OpReleaseEvent", { operands_0_298, 1u }, { capabilities_0_298, 1u }, { nullptr, 0u }, 0 },
+		{ "OpCreateUserEvent", { operands_0_299, 2u }, { capabilities_0_299, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIsValidEvent", { operands_0_300, 3u }, { capabilities_0_300, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSetUserEventStatus", { operands_0_301, 2u }, { capabilities_0_301, 1u }, { nullptr, 0u }, 0 },
+		{ "OpCaptureEventProfilingInfo", { operands_0_302, 3u }, { capabilities_0_302, 1u }, { nullptr, 0u }, 0 },
+		{ "OpGetDefaultQueue", { operands_0_303, 2u }, { capabilities_0_303, 1u }, { nullptr, 0u }, 0 },
+		{ "OpBuildNDRange", { operands_0_304, 5u }, { capabilities_0_304, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleImplicitLod", { operands_0_305, 5u }, { capabilities_0_305, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleExplicitLod", { operands_0_306, 5u }, { capabilities_0_306, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleDrefImplicitLod", { operands_0_307, 6u }, { capabilities_0_307, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleDrefExplicitLod", { operands_0_308, 6u }, { capabilities_0_308, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleProjImplicitLod", { operands_0_309, 5u }, { capabilities_0_309, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleProjExplicitLod", { operands_0_310, 5u }, { capabilities_0_310, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleProjDrefImplicitLod", { operands_0_311, 6u }, { capabilities_0_311, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseSampleProjDrefExplicitLod", { operands_0_312, 6u }, { capabilities_0_312, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseFetch", { operands_0_313, 5u }, { capabilities_0_313, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseGather", { operands_0_314, 6u }, { capabilities_0_314, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseDrefGather", { operands_0_315, 6u }, { capabilities_0_315, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseTexelsResident", { operands_0_316, 3u }, { capabilities_0_316, 1u }, { nullptr, 0u }, 0 },
+		{ "OpNoLine", { nullptr, 0u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicFlagTestAndSet", { operands_0_318, 5u }, { capabilities_0_318, 1u }, { nullptr, 0u }, 0 },
+		{ "OpAtomicFlagClear", { operands_0_319, 3u }, { capabilities_0_319, 1u }, { nullptr, 0u }, 0 },
+		{ "OpImageSparseRead", { operands_0_320, 5u }, { capabilities_0_320, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSizeOf", { operands_0_321, 3u }, { capabilities_0_321, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpTypePipeStorage", { operands_0_322, 1u }, { capabilities_0_322, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpConstantPipeStorage", { operands_0_323, 5u }, { capabilities_0_323, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpCreatePipeFromPipeStorage", { operands_0_324, 3u }, { capabilities_0_324, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpGetKernelLocalSizeForSubgroupCount", { operands_0_325, 7u }, { capabilities_0_325, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpGetKernelMaxNumSubgroups", { operands_0_326, 6u }, { capabilities_0_326, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpTypeNamedBarrier", { operands_0_327, 1u }, { capabilities_0_327, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpNamedBarrierInitialize", { operands_0_328, 3u }, { capabilities_0_328, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpMemoryNamedBarrier", { operands_0_329, 3u }, { capabilities_0_329, 1u }, { nullptr, 0u }, 65792 },
+		{ "OpModuleProcessed", { operands_0_330, 1u }, { nullptr, 0u }, { nullptr, 0u }, 65792 },
+		{ "OpExecutionModeId", { operands_0_331, 2u }, { nullptr, 0u }, { nullptr, 0u }, 66048 },
+		{ "OpDecorateId", { operands_0_332, 2u }, { nullptr, 0u }, { extensions_0_332, 1u }, 66048 },
+		{ "OpGroupNonUniformElect", { operands_0_333, 3u }, { capabilities_0_333, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformAll", { operands_0_334, 4u }, { capabilities_0_334, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformAny", { operands_0_335, 4u }, { capabilities_0_335, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformAllEqual", { operands_0_336, 4u }, { capabilities_0_336, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBroadcast", { operands_0_337, 5u }, { capabilities_0_337, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBroadcastFirst", { operands_0_338, 4u }, { capabilities_0_338, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBallot", { operands_0_339, 4u }, { capabilities_0_339, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformInverseBallot", { operands_0_340, 4u }, { capabilities_0_340, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBallotBitExtract", { operands_0_341, 5u }, { capabilities_0_341, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBallotBitCount", { operands_0_342, 5u }, { capabilities_0_342, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBallotFindLSB", { operands_0_343, 4u }, { capabilities_0_343, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBallotFindMSB", { operands_0_344, 4u }, { capabilities_0_344, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformShuffle", { operands_0_345, 5u }, { capabilities_0_345, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformShuffleXor", { operands_0_346, 5u }, { capabilities_0_346, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformShuffleUp", { operands_0_347, 5u }, { capabilities_0_347, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformShuffleDown", { operands_0_348, 5u }, { capabilities_0_348, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformIAdd", { operands_0_349, 6u }, { capabilities_0_349, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformFAdd", { operands_0_350, 6u }, { capabilities_0_350, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformIMul", { operands_0_351, 6u }, { capabilities_0_351, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformFMul", { operands_0_352, 6u }, { capabilities_0_352, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformSMin", { operands_0_353, 6u }, { capabilities_0_353, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformUMin", { operands_0_354, 6u }, { capabilities_0_354, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformFMin", { operands_0_355, 6u }, { capabilities_0_355, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformSMax", { operands_0_356, 6u }, { capabilities_0_356, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformUMax", { operands_0_357, 6u }, { capabilities_0_357, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformFMax", { operands_0_358, 6u }, { capabilities_0_358, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBitwiseAnd", { operands_0_359, 6u }, { capabilities_0_359, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBitwiseOr", { operands_0_360, 6u }, { capabilities_0_360, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformBitwiseXor", { operands_0_361, 6u }, { capabilities_0_361, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformLogicalAnd", { operands_0_362, 6u }, { capabilities_0_362, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformLogicalOr", { operands_0_363, 6u }, { capabilities_0_363, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformLogicalXor", { operands_0_364, 6u }, { capabilities_0_364, 3u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformQuadBroadcast", { operands_0_365, 5u }, { capabilities_0_365, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpGroupNonUniformQuadSwap", { operands_0_366, 5u }, { capabilities_0_366, 1u }, { nullptr, 0u }, 66304 },
+		{ "OpCopyLogical", { operands_0_400, 3u }, { nullptr, 0u }, { nullptr, 0u }, 66560 },
+		{ "OpPtrEqual", { operands_0_401, 4u }, { nullptr, 0u }, { nullptr, 0u }, 66560 },
+		{ "OpPtrNotEqual", { operands_0_402, 4u }, { nullptr, 0u }, { nullptr, 0u }, 66560 },
+		{ "OpPtrDiff", { operands_0_403, 4u }, { capabilities_0_403, 3u }, { nullptr, 0u }, 66560 },
+		{ "OpSubgroupBallotKHR", { operands_0_4421, 3u }, { capabilities_0_4421, 1u }, { extensions_0_4421, 1u }, 0 },
+		{ "OpSubgroupFirstInvocationKHR", { operands_0_4422, 3u }, { capabilities_0_4422, 1u }, { extensions_0_4422, 1u }, 0 },
+		{ "OpSubgroupAllKHR", { operands_0_4428, 3u }, { capabilities_0_4428, 1u }, { extensions_0_4428, 1u }, 0 },
+		{ "OpSubgroupAnyKHR", { operands_0_4429, 3u }, { capabilities_0_4429, 1u }, { extensions_0_4429, 1u }, 0 },
+		{ "OpSubgroupAllEqualKHR", { operands_0_4430, 3u }, { capabilities_0_4430, 1u }, { extensions_0_4430, 1u }, 0 },
+		{ "OpSubgroupReadInvocationKHR", { operands_0_4432, 4u }, { capabilities_0_4432, 1u }, { extensions_0_4432, 1u }, 0 },
+		{ "OpTypeRayQueryProvisionalKHR", { operands_0_4472, 1u }, { capabilities_0_4472, 1u }, { extensions_0_4472, 1u }, 0 },
+		{ "OpRayQueryInitializeKHR", { operands_0_4473, 8u }, { capabilities_0_4473, 1u }, { extensions_0_4473, 1u }, 0 },
+		{ "OpRayQueryTerminateKHR", { operands_0_4474, 1u }, { capabilities_0_4474, 1u }, { extensions_0_4474, 1u }, 0 },
+		{ "OpRayQueryGenerateIntersectionKHR", { operands_0_4475, 2u }, { capabilities_0_4475, 1u }, { extensions_0_4475, 1u }, 0 },
+		{ "OpRayQueryConfirmIntersectionKHR", { operands_0_4476, 1u }, { capabilities_0_4476, 1u }, { extensions_0_4476, 1u }, 0 },
+		{ "OpRayQueryProceedKHR", { operands_0_4477, 3u }, { capabilities_0_4477, 1u }, { extensions_0_4477, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionTypeKHR", { operands_0_4479, 4u }, { capabilities_0_4479, 1u }, { extensions_0_4479, 1u }, 0 },
+		{ "OpGroupIAddNonUniformAMD", { operands_0_5000, 5u }, { capabilities_0_5000, 1u }, { extensions_0_5000, 1u }, 0 },
+		{ "OpGroupFAddNonUniformAMD", { operands_0_5001, 5u }, { capabilities_0_5001, 1u }, { extensions_0_5001, 1u }, 0 },
+		{ "OpGroupFMinNonUniformAMD", { operands_0_5002, 5u }, { capabilities_0_5002, 1u }, { extensions_0_5002, 1u }, 0 },
+		{ "OpGroupUMinNonUniformAMD", { operands_0_5003, 5u }, { capabilities_0_5003, 1u }, { extensions_0_5003, 1u }, 0 },
+		{ "OpGroupSMinNonUniformAMD", { operands_0_5004, 5u }, { capabilities_0_5004, 1u }, { extensions_0_5004, 1u }, 0 },
+		{ "OpGroupFMaxNonUniformAMD", { operands_0_5005, 5u }, { capabilities_0_5005, 1u }, { extensions_0_5005, 1u }, 0 },
+		{ "OpGroupUMaxNonUniformAMD", { operands_0_5006, 5u }, { capabilities_0_5006, 1u }, { extensions_0_5006, 1u }, 0 },
+		{ "OpGroupSMaxNonUniformAMD", { operands_0_5007, 5u }, { capabilities_0_5007, 1u }, { extensions_0_5007, 1u }, 0 },
+		{ "OpFragmentMaskFetchAMD", { operands_0_5011, 4u }, { capabilities_0_5011, 1u }, { extensions_0_5011, 1u }, 0 },
+		{ "OpFragmentFetchAMD", { operands_0_5012, 5u }, { capabilities_0_5012, 1u }, { extensions_0_5012, 1u }, 0 },
+		{ "OpReadClockKHR", { operands_0_5056, 3u }, { capabilities_0_5056, 1u }, { extensions_0_5056, 1u }, 0 },
+		{ "OpImageSampleFootprintNV", { operands_0_5283, 7u }, { capabilities_0_5283, 1u }, { extensions_0_5283, 1u }, 0 },
+		{ "OpGroupNonUniformPartitionNV", { operands_0_5296, 3u }, { capabilities_0_5296, 1u }, { extensions_0_5296, 1u }, 0 },
+		{ "OpWritePackedPrimitiveIndices4x8NV", { operands_0_5299, 2u }, { capabilities_0_5299, 1u }, { extensions_0_5299, 1u }, 0 },
+		{ "OpReportIntersectionKHR", { operands_0_5334, 4u }, { capabilities_0_5334, 2u }, { extensions_0_5334, 2u }, 0 },
+		{ "OpIgnoreIntersectionKHR", { nullptr, 0u }, { capabilities_0_5335, 2u }, { extensions_0_5335, 2u }, 0 },
+		{ "OpTerminateRayKHR", { nullptr, 0u }, { capabilities_0_5336, 2u }, { extensions_0_5336, 2u }, 0 },
+		{ "OpTraceRayKHR", { operands_0_5337, 11u }, { capabilities_0_5337, 2u }, { extensions_0_5337, 2u }, 0 },
+		{ "OpTypeAccelerationStructureKHR", { operands_0_5341, 1u }, { capabilities_0_5341, 3u }, { extensions_0_5341, 3u }, 0 },
+		{ "OpExecuteCallableKHR", { operands_0_5344, 2u }, { capabilities_0_5344, 2u }, { extensions_0_5344, 2u }, 0 },
+		{ "OpTypeCooperativeMatrixNV", { operands_0_5358, 5u }, { capabilities_0_5358, 1u }, { extensions_0_5358, 1u }, 0 },
+		{ "OpCooperativeMatrixLoadNV", { operands_0_5359, 6u }, { capabilities_0_5359, 1u }, { extensions_0_5359, 1u }, 0 },
+		{ "OpCooperativeMatrixStoreNV", { operands_0_5360, 5u }, { capabilities_0_5360, 1u }, { extensions_0_5360, 1u }, 0 },
+		{ "OpCooperativeMatrixMulAddNV", { operands_0_5361, 5u }, { capabilities_0_5361, 1u }, { extensions_0_5361, 1u }, 0 },
+		{ "OpCooperativeMatrixLengthNV", { operands_0_5362, 3u }, { capabilities_0_5362, 1u }, { extensions_0_5362, 1u }, 0 },
+		{ "OpBeginInvocationInterlockEXT", { nullptr, 0u }, { capabilities_0_5364, 3u }, { extensions_0_5364, 1u }, 0 },
+		{ "OpEndInvocationInterlockEXT", { nullptr, 0u }, { capabilities_0_5365, 3u }, { extensions_0_5365, 1u }, 0 },
+		{ "OpDemoteToHelperInvocationEXT", { nullptr, 0u }, { capabilities_0_5380, 1u }, { extensions_0_5380, 1u }, 0 },
+		{ "OpIsHelperInvocationEXT", { operands_0_5381, 2u }, { capabilities_0_5381, 1u }, { extensions_0_5381, 1u }, 0 },
+		{ "OpSubgroupShuffleINTEL", { operands_0_5571, 4u }, { capabilities_0_5571, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupShuffleDownINTEL", { operands_0_5572, 5u }, { capabilities_0_5572, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupShuffleUpINTEL", { operands_0_5573, 5u }, { capabilities_0_5573, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupShuffleXorINTEL", { operands_0_5574, 4u }, { capabilities_0_5574, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupBlockReadINTEL", { operands_0_5575, 3u }, { capabilities_0_5575, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupBlockWriteINTEL", { operands_0_5576, 2u }, { capabilities_0_5576, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupImageBlockReadINTEL", { operands_0_5577, 4u }, { capabilities_0_5577, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupImageBlockWriteINTEL", { operands_0_5578, 3u }, { capabilities_0_5578, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupImageMediaBlockReadINTEL", { operands_0_5580, 6u }, { capabilities_0_5580, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupImageMediaBlockWriteINTEL", { operands_0_5581, 5u }, { capabilities_0_5581, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUCountLeadingZerosINTEL", { operands_0_5585, 3u }, { capabilities_0_5585, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUCountTrailingZerosINTEL", { operands_0_5586, 3u }, { capabilities_0_5586, 1u }, { nullptr, 0u }, 0 },
+		{ "OpAbsISubINTEL", { operands_0_5587, 4u }, { capabilities_0_5587, 1u }, { nullptr, 0u }, 0 },
+		{ "OpAbsUSubINTEL", { operands_0_5588, 4u }, { capabilities_0_5588, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIAddSatINTEL", { operands_0_5589, 4u }, { capabilities_0_5589, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUAddSatINTEL", { operands_0_5590, 4u }, { capabilities_0_5590, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIAverageINTEL", { operands_0_5591, 4u }, { capabilities_0_5591, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUAverageINTEL", { operands_0_5592, 4u }, { capabilities_0_5592, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIAverageRoundedINTEL", { operands_0_5593, 4u }, { capabilities_0_5593, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUAverageRoundedINTEL", { operands_0_5594, 4u }, { capabilities_0_5594, 1u }, { nullptr, 0u }, 0 },
+		{ "OpISubSatINTEL", { operands_0_5595, 4u }, { capabilities_0_5595, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUSubSatINTEL", { operands_0_5596, 4u }, { capabilities_0_5596, 1u }, { nullptr, 0u }, 0 },
+		{ "OpIMul32x16INTEL", { operands_0_5597, 4u }, { capabilities_0_5597, 1u }, { nullptr, 0u }, 0 },
+		{ "OpUMul32x16INTEL", { operands_0_5598, 4u }, { capabilities_0_5598, 1u }, { nullptr, 0u }, 0 },
+		{ "OpFunctionPointerINTEL", { operands_0_5600, 3u }, { capabilities_0_5600, 1u }, { extensions_0_5600, 1u }, 0 },
+		{ "OpFunctionPointerCallINTEL", { operands_0_5601, 3u }, { capabilities_0_5601, 1u }, { extensions_0_5601, 1u }, 0 },
+		{ "OpDecorateString", { operands_0_5632, 2u }, { nullptr, 0u }, { extensions_0_5632, 2u }, 66560 },
+		{ "OpMemberDecorateString", { operands_0_5633, 3u }, { nullptr, 0u }, { extensions_0_5633, 2u }, 66560 },
+		{ "OpVmeImageINTEL", { operands_0_5699, 4u }, { capabilities_0_5699, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeVmeImageINTEL", { operands_0_5700, 2u }, { capabilities_0_5700, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcImePayloadINTEL", { operands_0_5701, 1u }, { capabilities_0_5701, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcRefPayloadINTEL", { operands_0_5702, 1u }, { capabilities_0_5702, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcSicPayloadINTEL", { operands_0_5703, 1u }, { capabilities_0_5703, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcMcePayloadINTEL", { operands_0_5704, 1u }, { capabilities_0_5704, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcMceResultINTEL", { operands_0_5705, 1u }, { capabilities_0_5705, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcImeResultINTEL", { operands_0_5706, 1u }, { capabilities_0_5706, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcImeResultSingleReferenceStreamoutINTEL", { operands_0_5707, 1u }, { capabilities_0_5707, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcImeResultDualReferenceStreamoutINTEL", { operands_0_5708, 1u }, { capabilities_0_5708, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcImeSingleReferenceStreaminINTEL", { operands_0_5709, 1u }, { capabilities_0_5709, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcImeDualReferenceStreaminINTEL", { operands_0_5710, 1u }, { capabilities_0_5710, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcRefResultINTEL", { operands_0_5711, 1u }, { capabilities_0_5711, 1u }, { nullptr, 0u }, 0 },
+		{ "OpTypeAvcSicResultINTEL", { operands_0_5712, 1u }, { capabilities_0_5712, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL", { operands_0_5713, 4u }, { capabilities_0_5713, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL", { operands_0_5714, 4u }, { capabilities_0_5714, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL", { operands_0_5715, 4u }, { capabilities_0_5715, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetInterShapePenaltyINTEL", { operands_0_5716, 4u }, { capabilities_0_5716, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL", { operands_0_5717, 4u }, { capabilities_0_5717, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetInterDirectionPenaltyINTEL", { operands_0_5718, 4u }, { capabilities_0_5718, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL", { operands_0_5719, 4u }, { capabilities_0_5719, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL", { operands_0_5720, 4u }, { capabilities_0_5720, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL", { operands_0_5721, 2u }, { capabilities_0_5721, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL", { operands_0_5722, 2u }, { capabilities_0_5722, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL", { operands_0_5723, 2u }, { capabilities_0_5723, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL", { operands_0_5724, 6u }, { capabilities_0_5724, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL", { operands_0_5725, 4u }, { capabilities_0_5725, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL", { operands_0_5726, 2u }, { capabilities_0_5726, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL", { operands_0_5727, 2u }, { capabilities_0_5727, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetAcOnlyHaarINTEL", { operands_0_5728, 3u }, { capabilities_0_5728, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL", { operands_0_5729, 4u }, { capabilities_0_5729, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL", { operands_0_5730, 4u }, { capabilities_0_5730, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL", { operands_0_5731, 5u }, { capabilities_0_5731, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceConvertToImePayloadINTEL", { operands_0_5732, 3u }, { capabilities_0_5732, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceConvertToImeResultINTEL", { operands_0_5733, 3u }, { capabilities_0_5733, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceConvertToRefPayloadINTEL", { operands_0_5734, 3u }, { capabilities_0_5734, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceConvertToRefResultINTEL", { operands_0_5735, 3u }, { capabilities_0_5735, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceConvertToSicPayloadINTEL", { operands_0_5736, 3u }, { capabilities_0_5736, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceConvertToSicResultINTEL", { operands_0_5737, 3u }, { capabilities_0_5737, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetMotionVectorsINTEL", { operands_0_5738, 3u }, { capabilities_0_5738, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterDistortionsINTEL", { operands_0_5739, 3u }, { capabilities_0_5739, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetBestInterDistortionsINTEL", { operands_0_5740, 3u }, { capabilities_0_5740, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterMajorShapeINTEL", { operands_0_5741, 3u }, { capabilities_0_5741, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterMinorShapeINTEL", { operands_0_5742, 3u }, { capabilities_0_5742, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterDirectionsINTEL", { operands_0_5743, 3u }, { capabilities_0_5743, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterMotionVectorCountINTEL", { operands_0_5744, 3u }, { capabilities_0_5744, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterReferenceIdsINTEL", { operands_0_5745, 3u }, { capabilities_0_5745, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL", { operands_0_5746, 5u }, { capabilities_0_5746, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeInitializeINTEL", { operands_0_5747, 5u }, { capabilities_0_5747, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeSetSingleReferenceINTEL", { operands_0_5748, 5u }, { capabilities_0_5748, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeSetDualReferenceINTEL", { operands_0_5749, 6u }, { capabilities_0_5749, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeRefWindowSizeINTEL", { operands_0_5750, 4u }, { capabilities_0_5750, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeAdjustRefOffsetINTEL", { operands_0_5751, 6u }, { capabilities_0_5751, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeConvertToMcePayloadINTEL", { operands_0_5752, 3u }, { capabilities_0_5752, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeSetMaxMotionVectorCountINTEL", { operands_0_5753, 4u }, { capabilities_0_5753, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL", { operands_0_5754, 3u }, { capabilities_0_5754, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL", { operands_0_5755, 4u }, { capabilities_0_5755, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeSetWeightedSadINTEL", { operands_0_5756, 4u }, { capabilities_0_5756, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL", { operands_0_5757, 5u }, { capabilities_0_5757, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithDualReferenceINTEL", { operands_0_5758, 6u }, { capabilities_0_5758, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL", { operands_0_5759, 6u }, { capabilities_0_5759, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL", { operands_0_5760, 7u }, { capabilities_0_5760, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL", { operands_0_5761, 5u }, { capabilities_0_5761, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL", { operands_0_5762, 6u }, { capabilities_0_5762, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL", { operands_0_5763, 6u }, { capabilities_0_5763, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL", { operands_0_5764, 7u }, { capabilities_0_5764, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeConvertToMceResultINTEL", { operands_0_5765, 3u }, { capabilities_0_5765, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetSingleReferenceStreaminINTEL", { operands_0_5766, 3u }, { capabilities_0_5766, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetDualReferenceStreaminINTEL", { operands_0_5767, 3u }, { capabilities_0_5767, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL", { operands_0_5768, 3u }, { capabilities_0_5768, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeStripDualReferenceStreamoutINTEL", { operands_0_5769, 3u }, { capabilities_0_5769, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL", { operands_0_5770, 4u }, { capabilities_0_5770, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL", { operands_0_5771, 4u }, { capabilities_0_5771, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL", { operands_0_5772, 4u }, { capabilities_0_5772, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL", { operands_0_5773, 5u }, { capabilities_0_5773, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL", { operands_0_5774, 5u }, { capabilities_0_5774, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL", { operands_0_5775, 5u }, { capabilities_0_5775, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetBorderReachedINTEL", { operands_0_5776, 4u }, { capabilities_0_5776, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL", { operands_0_5777, 3u }, { capabilities_0_5777, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL", { operands_0_5778, 3u }, { capabilities_0_5778, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL", { operands_0_5779, 3u }, { capabilities_0_5779, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL", { operands_0_5780, 3u }, { capabilities_0_5780, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcFmeInitializeINTEL", { operands_0_5781, 9u }, { capabilities_0_5781, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcBmeInitializeINTEL", { operands_0_5782, 10u }, { capabilities_0_5782, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefConvertToMcePayloadINTEL", { operands_0_5783, 3u }, { capabilities_0_5783, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefSetBidirectionalMixDisableINTEL", { operands_0_5784, 3u }, { capabilities_0_5784, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefSetBilinearFilterEnableINTEL", { operands_0_5785, 3u }, { capabilities_0_5785, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL", { operands_0_5786, 5u }, { capabilities_0_5786, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefEvaluateWithDualReferenceINTEL", { operands_0_5787, 6u }, { capabilities_0_5787, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL", { operands_0_5788, 5u }, { capabilities_0_5788, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL", { operands_0_5789, 6u }, { capabilities_0_5789, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcRefConvertToMceResultINTEL", { operands_0_5790, 3u }, { capabilities_0_5790, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicInitializeINTEL", { operands_0_5791, 3u }, { capabilities_0_5791, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicConfigureSkcINTEL", { operands_0_5792, 8u }, { capabilities_0_5792, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicConfigureIpeLumaINTEL", { operands_0_5793, 10u }, { capabilities_0_5793, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicConfigureIpeLumaChromaINTEL", { operands_0_5794, 13u }, { capabilities_0_5794, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetMotionVectorMaskINTEL", { operands_0_5795, 4u }, { capabilities_0_5795, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicConvertToMcePayloadINTEL", { operands_0_5796, 3u }, { capabilities_0_5796, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL", { operands_0_5797, 4u }, { capabilities_0_5797, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL", { operands_0_5798, 6u }, { capabilities_0_5798, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL", { operands_0_5799, 4u }, { capabilities_0_5799, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicSetBilinearFilterEnableINTEL", { operands_0_5800, 3u }, { capabilities_0_5800, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL", { operands_0_5801, 4u }, { capabilities_0_5801, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL", { operands_0_5802, 4u }, { capabilities_0_5802, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicEvaluateIpeINTEL", { operands_0_5803, 4u }, { capabilities_0_5803, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL", { operands_0_5804, 5u }, { capabilities_0_5804, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicEvaluateWithDualReferenceINTEL", { operands_0_5805, 6u }, { capabilities_0_5805, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL", { operands_0_5806, 5u }, { capabilities_0_5806, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL", { operands_0_5807, 6u }, { capabilities_0_5807, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicConvertToMceResultINTEL", { operands_0_5808, 3u }, { capabilities_0_5808, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetIpeLumaShapeINTEL", { operands_0_5809, 3u }, { capabilities_0_5809, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL", { operands_0_5810, 3u }, { capabilities_0_5810, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL", { operands_0_5811, 3u }, { capabilities_0_5811, 1u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetPackedIpeLumaModesINTEL", { operands_0_5812, 3u }, { capabilities_0_5812, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetIpeChromaModeINTEL", { operands_0_5813, 3u }, { capabilities_0_5813, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL", { operands_0_5814, 3u }, { capabilities_0_5814, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL", { operands_0_5815, 3u }, { capabilities_0_5815, 2u }, { nullptr, 0u }, 0 },
+		{ "OpSubgroupAvcSicGetInterRawSadsINTEL", { operands_0_5816, 3u }, { capabilities_0_5816, 1u }, { nullptr, 0u }, 0 },
+		{ "OpLoopControlINTEL", { operands_0_5887, 1u }, { capabilities_0_5887, 1u }, { extensions_0_5887, 1u }, 0 },
+		{ "OpReadPipeBlockingINTEL", { operands_0_5946, 4u }, { capabilities_0_5946, 1u }, { extensions_0_5946, 1u }, 0 },
+		{ "OpWritePipeBlockingINTEL", { operands_0_5947, 4u }, { capabilities_0_5947, 1u }, { extensions_0_5947, 1u }, 0 },
+		{ "OpFPGARegINTEL", { operands_0_5949, 4u }, { capabilities_0_5949, 1u }, { extensions_0_5949, 1u }, 0 },
+		{ "OpRayQueryGetRayTMinKHR", { operands_0_6016, 3u }, { capabilities_0_6016, 1u }, { extensions_0_6016, 1u }, 0 },
+		{ "OpRayQueryGetRayFlagsKHR", { operands_0_6017, 3u }, { capabilities_0_6017, 1u }, { extensions_0_6017, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionTKHR", { operands_0_6018, 4u }, { capabilities_0_6018, 1u }, { extensions_0_6018, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionInstanceCustomIndexKHR", { operands_0_6019, 4u }, { capabilities_0_6019, 1u }, { extensions_0_6019, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionInstanceIdKHR", { operands_0_6020, 4u }, { capabilities_0_6020, 1u }, { extensions_0_6020, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR", { operands_0_6021, 4u }, { capabilities_0_6021, 1u }, { extensions_0_6021, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionGeometryIndexKHR", { operands_0_6022, 4u }, { capabilities_0_6022, 1u }, { extensions_0_6022, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionPrimitiveIndexKHR", { operands_0_6023, 4u }, { capabilities_0_6023, 1u }, { extensions_0_6023, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionBarycentricsKHR", { operands_0_6024, 4u }, { capabilities_0_6024, 1u }, { extensions_0_6024, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionFrontFaceKHR", { operands_0_6025, 4u }, { capabilities_0_6025, 1u }, { extensions_0_6025, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionCandidateAABBOpaqueKHR", { operands_0_6026, 3u }, { capabilities_0_6026, 1u }, { extensions_0_6026, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionObjectRayDirectionKHR", { operands_0_6027, 4u }, { capabilities_0_6027, 1u }, { extensions_0_6027, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionObjectRayOriginKHR", { operands_0_6028, 4u }, { capabilities_0_6028, 1u }, { extensions_0_6028, 1u }, 0 },
+		{ "OpRayQueryGetWorldRayDirectionKHR", { operands_0_6029, 3u }, { capabilities_0_6029, 1u }, { extensions_0_6029, 1u }, 0 },
+		{ "OpRayQueryGetWorldRayOriginKHR", { operands_0_6030, 3u }, { capabilities_0_6030, 1u }, { extensions_0_6030, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionObjectToWorldKHR", { operands_0_6031, 4u }, { capabilities_0_6031, 1u }, { extensions_0_6031, 1u }, 0 },
+		{ "OpRayQueryGetIntersectionWorldToObjectKHR", { operands_0_6032, 4u }, { capabilities_0_6032, 1u }, { extensions_0_6032, 1u }, 0 },
+		{ "Round", { operands_1_1, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "RoundEven", { operands_1_2, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Trunc", { operands_1_3, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FAbs", { operands_1_4, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "SAbs", { operands_1_5, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FSign", { operands_1_6, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "SSign", { operands_1_7, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Floor", { operands_1_8, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Ceil", { operands_1_9, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Fract", { operands_1_10, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Radians", { operands_1_11, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Degrees", { operands_1_12, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Sin", { operands_1_13, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Cos", { operands_1_14, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Tan", { operands_1_15, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Asin", { operands_1_16, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Acos", { operands_1_17, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Atan", { operands_1_18, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Sinh", { operands_1_19, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Cosh", { operands_1_20, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Tanh", { operands_1_21, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Asinh", { operands_1_22, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Acosh", { operands_1_23, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Atanh", { operands_1_24, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Atan2", { operands_1_25, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Pow", { operands_1_26, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Exp", { operands_1_27, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Log", { operands_1_28, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Exp2", { operands_1_29, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Log2", { operands_1_30, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Sqrt", { operands_1_31, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "InverseSqrt", { operands_1_32, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Determinant", { operands_1_33, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "MatrixInverse", { operands_1_34, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Modf", { operands_1_35, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "ModfStruct", { operands_1_36, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FMin", { operands_1_37, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UMin", { operands_1_38, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "SMin", { operands_1_39, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FMax", { operands_1_40, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UMax", { operands_1_41, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "SMax", { operands_1_42, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FClamp", { operands_1_43, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UClamp", { operands_1_44, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "SClamp", { operands_1_45, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FMix", { operands_1_46, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "IMix", { operands_1_47, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Step", { operands_1_48, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "SmoothStep", { operands_1_49, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Fma", { operands_1_50, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Frexp", { operands_1_51, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FrexpStruct", { operands_1_52, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Ldexp", { operands_1_53, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "PackSnorm4x8", { operands_1_54, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "PackUnorm4x8", { operands_1_55, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "PackSnorm2x16", { operands_1_56, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "PackUnorm2x16", { operands_1_57, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "PackHalf2x16", { operands_1_58, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "PackDouble2x32", { operands_1_59, 1u }, { capabilities_1_59, 1u }, { nullptr, 0u }, 0 },
+		{ "UnpackSnorm2x16", { operands_1_60, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UnpackUnorm2x16", { operands_1_61, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UnpackHalf2x16", { operands_1_62, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UnpackSnorm4x8", { operands_1_63, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UnpackUnorm4x8", { operands_1_64, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "UnpackDouble2x32", { operands_1_65, 1u }, { capabilities_1_65, 1u }, { nullptr, 0u }, 0 },
+		{ "Length", { operands_1_66, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Distance", { operands_1_67, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Cross", { operands_1_68, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Normalize", { operands_1_69, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FaceForward", { operands_1_70, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Reflect", { operands_1_71, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "Refract", { operands_1_72, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FindILsb", { operands_1_73, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FindSMsb", { operands_1_74, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "FindUMsb", { operands_1_75, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "InterpolateAtCentroid", { operands_1_76, 1u }, { capabilities_1_76, 1u }, { nullptr, 0u }, 0 },
+		{ "InterpolateAtSample", { operands_1_77, 2u }, { capabilities_1_77, 1u }, { nullptr, 0u }, 0 },
+		{ "InterpolateAtOffset", { operands_1_78, 2u }, { capabilities_1_78, 1u }, { nullptr, 0u }, 0 },
+		{ "NMin", { operands_1_79, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "NMax", { operands_1_80, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "NClamp", { operands_1_81, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "acos", { operands_2_0, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "acosh", { operands_2_1, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "acospi", { operands_2_2, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "asin", { operands_2_3, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "asinh", { operands_2_4, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "asinpi", { operands_2_5, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "atan", { operands_2_6, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "atan2", { operands_2_7, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "atanh", { operands_2_8, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "atanpi", { operands_2_9, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "atan2pi", { operands_2_10, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "cbrt", { operands_2_11, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "ceil", { operands_2_12, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "copysign", { operands_2_13, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "cos", { operands_2_14, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "cosh", { operands_2_15, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "cospi", { operands_2_16, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "erfc", { operands_2_17, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "erf", { operands_2_18, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "exp", { operands_2_19, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "exp2", { operands_2_20, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "exp10", { operands_2_21, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "expm1", { operands_2_22, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fabs", { operands_2_23, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fdim", { operands_2_24, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "floor", { operands_2_25, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fma", { operands_2_26, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fmax", { operands_2_27, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fmin", { operands_2_28, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fmod", { operands_2_29, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fract", { operands_2_30, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "frexp", { operands_2_31, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "hypot", { operands_2_32, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "ilogb", { operands_2_33, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "ldexp", { operands_2_34, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "lgamma", { operands_2_35, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "lgamma_r", { operands_2_36, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "log", { operands_2_37, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "log2", { operands_2_38, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "log10", { operands_2_39, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "log1p", { operands_2_40, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "logb", { operands_2_41, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "mad", { operands_2_42, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "maxmag", { operands_2_43, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "minmag", { operands_2_44, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "modf", { operands_2_45, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "nan", { operands_2_46, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "nextafter", { operands_2_47, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "pow", { operands_2_48, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "pown", { operands_2_49, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "powr", { operands_2_50, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "remainder", { operands_2_51, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "remquo", { operands_2_52, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "rint", { operands_2_53, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "rootn", { operands_2_54, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "round", { operands_2_55, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "rsqrt", { operands_2_56, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "sin", { operands_2_57, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "sincos", { operands_2_58, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "sinh", { operands_2_59, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "sinpi", { operands_2_60, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "sqrt", { operands_2_61, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "tan", { operands_2_62, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "tanh", { operands_2_63, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "tanpi", { operands_2_64, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "tgamma", { operands_2_65, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "trunc", { operands_2_66, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_cos", { operands_2_67, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_divide", { operands_2_68, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_exp", { operands_2_69, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_exp2", { operands_2_70, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_exp10", { operands_2_71, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_log", { operands_2_72, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_log2", { operands_2_73, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_log10", { operands_2_74, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_powr", { operands_2_75, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_recip", { operands_2_76, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_rsqrt", { operands_2_77, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_sin", { operands_2_78, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_sqrt", { operands_2_79, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "half_tan", { operands_2_80, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_cos", { operands_2_81, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_divide", { operands_2_82, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_exp", { operands_2_83, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_exp2", { operands_2_84, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_exp10", { operands_2_85, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_log", { operands_2_86, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_log2", { operands_2_87, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_log10", { operands_2_88, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_powr", { operands_2_89, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_recip", { operands_2_90, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_rsqrt", { operands_2_91, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_sin", { operands_2_92, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_sqrt", { operands_2_93, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "native_tan", { operands_2_94, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_abs", { operands_2_141, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_abs_diff", { operands_2_142, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_add_sat", { operands_2_143, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_add_sat", { operands_2_144, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_hadd", { operands_2_145, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_hadd", { operands_2_146, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_rhadd", { operands_2_147, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_rhadd", { operands_2_148, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_clamp", { operands_2_149, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_clamp", { operands_2_150, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "clz", { operands_2_151, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "ctz", { operands_2_152, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_mad_hi", { operands_2_153, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_mad_sat", { operands_2_154, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_mad_sat", { operands_2_155, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_max", { operands_2_156, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_max", { operands_2_157, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_min", { operands_2_158, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_min", { operands_2_159, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_mul_hi", { operands_2_160, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "rotate", { operands_2_161, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_sub_sat", { operands_2_162, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_sub_sat", { operands_2_163, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_upsample", { operands_2_164, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_upsample", { operands_2_165, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "popcount", { operands_2_166, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_mad24", { operands_2_167, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_mad24", { operands_2_168, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "s_mul24", { operands_2_169, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_mul24", { operands_2_170, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_abs", { operands_2_201, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_abs_diff", { operands_2_202, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_mul_hi", { operands_2_203, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "u_mad_hi", { operands_2_204, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fclamp", { operands_2_95, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "degrees", { operands_2_96, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fmax_common", { operands_2_97, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fmin_common", { operands_2_98, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "mix", { operands_2_99, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "radians", { operands_2_100, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "step", { operands_2_101, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "smoothstep", { operands_2_102, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "sign", { operands_2_103, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "cross", { operands_2_104, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "distance", { operands_2_105, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "length", { operands_2_106, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "normalize", { operands_2_107, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fast_distance", { operands_2_108, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fast_length", { operands_2_109, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "fast_normalize", { operands_2_110, 1u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "bitselect", { operands_2_186, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "select", { operands_2_187, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vloadn", { operands_2_171, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstoren", { operands_2_172, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vload_half", { operands_2_173, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vload_halfn", { operands_2_174, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstore_half", { operands_2_175, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstore_half_r", { operands_2_176, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstore_halfn", { operands_2_177, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstore_halfn_r", { operands_2_178, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vloada_halfn", { operands_2_179, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstorea_halfn", { operands_2_180, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "vstorea_halfn_r", { operands_2_181, 4u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "shuffle", { operands_2_182, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "shuffle2", { operands_2_183, 3u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "printf", { operands_2_184, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+		{ "prefetch", { operands_2_185, 2u }, { nullptr, 0u }, { nullptr, 0u }, 0 },
+	};
+
+	// opcode -> index into instructions + 1, 0 if there is no instruction with this opcode
+	constexpr unsigned short coreLookup[6033] = {
+		1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 0, 13, 14, 15, 16, 0, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+		30, 31, 32, 33, 34, 35, 36, 37, 0, 38, 39, 40, 41, 42, 43, 0, 44, 45, 46, 47, 48, 0, 49, 50, 51, 52, 0, 53, 54, 55, 56, 57,
+		58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 0, 70, 71, 72, 73, 74, 75, 76, 77, 0, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+		88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 0, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 0, 116, 117,
+		118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 0, 143, 144, 145, 146, 147, 148,
+		149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+		0, 0, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 0, 193, 194, 195, 196, 197, 198, 199, 200, 201, 0, 0, 202, 203, 204, 205, 0, 0,
+		206, 207, 0, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 0, 0, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+		235, 236, 0, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 0, 0, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+		264, 0, 0, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293,
+		294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325,
+		326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 342, 343, 344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 345, 346, 0, 0, 0, 0, 0, 347, 348, 349, 0, 350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 351, 352, 353, 354, 355, 356, 0, 357,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 358, 359, 360, 361, 362, 363, 364, 365, 0, 0, 0, 366, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		368, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 370, 0, 0, 371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 373, 374, 375, 0, 0, 0, 376, 0, 0,
+		377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 378, 379, 380, 381, 382, 0, 383, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 385, 386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 387, 388, 389, 390, 391, 392, 393, 394, 0, 395, 396, 0, 0, 0, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 0,
+		411, 412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		413, 414, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+		444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+		476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+		508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 533,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 534, 535, 0, 536, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553,
+	};
+
+	// opcode -> index into instructions + 1, 0 if there is no instruction with this opcode
+	constexpr unsigned short glslLookup[82] = {
+		0, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
+		585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+		617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634,
+	};
+
+	// opcode -> index into instructions + 1, 0 if there is no instruction with this opcode
+	constexpr unsigned short openClLookup[205] = {
+		635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666,
+		667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698,
+		699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 764,
+		765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748,
+		749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 780, 781, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 760, 761, 762, 763,
+	};
+
+	struct OperandName
 	{
-		auto& instr = m_instructions.emplaceUnique(Hash64(185u, 2u), Instruction{"prefetch", _pAllocator, _pAllocator, _pAllocator, 0}).kv.value;
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'ptr'",Quantifier::One);
-		instr.operands.emplace_back(OperandKind::IdRef, OperandCategory::Id, "'num elements'",Quantifier::One);
-	}
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::ImageOperands)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::ImageOperands)),"Bias");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::ImageOperands)),"Lod");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::ImageOperands)),"Grad");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::ImageOperands)),"ConstOffset");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::ImageOperands)),"Offset");
-	m_operandNames.emplaceUnique(Hash64(0x0020u, static_cast<unsigned int>(OperandKind::ImageOperands)),"ConstOffsets");
-	m_operandNames.emplaceUnique(Hash64(0x0040u, static_cast<unsigned int>(OperandKind::ImageOperands)),"Sample");
-	m_operandNames.emplaceUnique(Hash64(0x0080u, static_cast<unsigned int>(OperandKind::ImageOperands)),"MinLod");
-	m_operandNames.emplaceUnique(Hash64(0x0100u, static_cast<unsigned int>(OperandKind::ImageOperands)),"MakeTexelAvailable");
-	m_operandNames.emplaceUnique(Hash64(0x0100u, static_cast<unsigned int>(OperandKind::ImageOperands)),"MakeTexelAvailableKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0200u, static_cast<unsigned int>(OperandKind::ImageOperands)),"MakeTexelVisible");
-	m_operandNames.emplaceUnique(Hash64(0x0200u, static_cast<unsigned int>(OperandKind::ImageOperands)),"MakeTexelVisibleKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0400u, static_cast<unsigned int>(OperandKind::ImageOperands)),"NonPrivateTexel");
-	m_operandNames.emplaceUnique(Hash64(0x0400u, static_cast<unsigned int>(OperandKind::ImageOperands)),"NonPrivateTexelKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0800u, static_cast<unsigned int>(OperandKind::ImageOperands)),"VolatileTexel");
-	m_operandNames.emplaceUnique(Hash64(0x0800u, static_cast<unsigned int>(OperandKind::ImageOperands)),"VolatileTexelKHR");
-	m_operandNames.emplaceUnique(Hash64(0x1000u, static_cast<unsigned int>(OperandKind::ImageOperands)),"SignExtend");
-	m_operandNames.emplaceUnique(Hash64(0x2000u, static_cast<unsigned int>(OperandKind::ImageOperands)),"ZeroExtend");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::FPFastMathMode)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::FPFastMathMode)),"NotNaN");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::FPFastMathMode)),"NotInf");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::FPFastMathMode)),"NSZ");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::FPFastMathMode)),"AllowRecip");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::FPFastMathMode)),"Fast");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::SelectionControl)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::SelectionControl)),"Flatten");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::SelectionControl)),"DontFlatten");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::LoopControl)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::LoopControl)),"Unroll");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::LoopControl)),"DontUnroll");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::LoopControl)),"DependencyInfinite");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::LoopControl)),"DependencyLength");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::LoopControl)),"MinIterations");
-	m_operandNames.emplaceUnique(Hash64(0x0020u, static_cast<unsigned int>(OperandKind::LoopControl)),"MaxIterations");
-	m_operandNames.emplaceUnique(Hash64(0x0040u, static_cast<unsigned int>(OperandKind::LoopControl)),"IterationMultiple");
-	m_operandNames.emplaceUnique(Hash64(0x0080u, static_cast<unsigned int>(OperandKind::LoopControl)),"PeelCount");
-	m_operandNames.emplaceUnique(Hash64(0x0100u, static_cast<unsigned int>(OperandKind::LoopControl)),"PartialCount");
-	m_operandNames.emplaceUnique(Hash64(0x10000u, static_cast<unsigned int>(OperandKind::LoopControl)),"InitiationIntervalINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x20000u, static_cast<unsigned int>(OperandKind::LoopControl)),"MaxConcurrencyINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x40000u, static_cast<unsigned int>(OperandKind::LoopControl)),"DependencyArrayINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x80000u, static_cast<unsigned int>(OperandKind::LoopControl)),"PipelineEnableINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x100000u, static_cast<unsigned int>(OperandKind::LoopControl)),"LoopCoalesceINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x200000u, static_cast<unsigned int>(OperandKind::LoopControl)),"MaxInterleavingINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x400000u, static_cast<unsigned int>(OperandKind::LoopControl)),"SpeculatedIterationsINTEL");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::FunctionControl)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::FunctionControl)),"Inline");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::FunctionControl)),"DontInline");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::FunctionControl)),"Pure");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::FunctionControl)),"Const");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"Relaxed");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"Acquire");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"Release");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"AcquireRelease");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"SequentiallyConsistent");
-	m_operandNames.emplaceUnique(Hash64(0x0040u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"UniformMemory");
-	m_operandNames.emplaceUnique(Hash64(0x0080u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"SubgroupMemory");
-	m_operandNames.emplaceUnique(Hash64(0x0100u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"WorkgroupMemory");
-	m_operandNames.emplaceUnique(Hash64(0x0200u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"CrossWorkgroupMemory");
-	m_operandNames.emplaceUnique(Hash64(0x0400u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"AtomicCounterMemory");
-	m_operandNames.emplaceUnique(Hash64(0x0800u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"ImageMemory");
-	m_operandNames.emplaceUnique(Hash64(0x1000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"OutputMemory");
-	m_operandNames.emplaceUnique(Hash64(0x1000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"OutputMemoryKHR");
-	m_operandNames.emplaceUnique(Hash64(0x2000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"MakeAvailable");
-	m_operandNames.emplaceUnique(Hash64(0x2000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"MakeAvailableKHR");
-	m_operandNames.emplaceUnique(Hash64(0x4000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"MakeVisible");
-	m_operandNames.emplaceUnique(Hash64(0x4000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"MakeVisibleKHR");
-	m_operandNames.emplaceUnique(Hash64(0x8000u, static_cast<unsigned int>(OperandKind::MemorySemantics)),"Volatile");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"Volatile");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"Aligned");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"Nontemporal");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"MakePointerAvailable");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"MakePointerAvailableKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"MakePointerVisible");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"MakePointerVisibleKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0020u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"NonPrivatePointer");
-	m_operandNames.emplaceUnique(Hash64(0x0020u, static_cast<unsigned int>(OperandKind::MemoryAccess)),"NonPrivatePointerKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::KernelProfilingInfo)),"None");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::KernelProfilingInfo)),"CmdExecTime");
-	m_operandNames.emplaceUnique(Hash64(0x0000u, static_cast<unsigned int>(OperandKind::RayFlags)),"NoneKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0001u, static_cast<unsigned int>(OperandKind::RayFlags)),"OpaqueKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0002u, static_cast<unsigned int>(OperandKind::RayFlags)),"NoOpaqueKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0004u, static_cast<unsigned int>(OperandKind::RayFlags)),"TerminateOnFirstHitKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0008u, static_cast<unsigned int>(OperandKind::RayFlags)),"SkipClosestHitShaderKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0010u, static_cast<unsigned int>(OperandKind::RayFlags)),"CullBackFacingTrianglesKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0020u, static_cast<unsigned int>(OperandKind::RayFlags)),"CullFrontFacingTrianglesKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0040u, static_cast<unsigned int>(OperandKind::RayFlags)),"CullOpaqueKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0080u, static_cast<unsigned int>(OperandKind::RayFlags)),"CullNoOpaqueKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0100u, static_cast<unsigned int>(OperandKind::RayFlags)),"SkipTrianglesKHR");
-	m_operandNames.emplaceUnique(Hash64(0x0200u, static_cast<unsigned int>(OperandKind::RayFlags)),"SkipAABBsKHR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::SourceLanguage)),"Unknown");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::SourceLanguage)),"ESSL");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::SourceLanguage)),"GLSL");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::SourceLanguage)),"OpenCL_C");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::SourceLanguage)),"OpenCL_CPP");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::SourceLanguage)),"HLSL");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"Vertex");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"TessellationControl");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"TessellationEvaluation");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"Geometry");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"Fragment");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"GLCompute");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"Kernel");
-	m_operandNames.emplaceUnique(Hash64(5267u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"TaskNV");
-	m_operandNames.emplaceUnique(Hash64(5268u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"MeshNV");
-	m_operandNames.emplaceUnique(Hash64(5313u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"RayGenerationNV");
-	m_operandNames.emplaceUnique(Hash64(5313u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"RayGenerationKHR");
-	m_operandNames.emplaceUnique(Hash64(5314u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"IntersectionNV");
-	m_operandNames.emplaceUnique(Hash64(5314u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"IntersectionKHR");
-	m_operandNames.emplaceUnique(Hash64(5315u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"AnyHitNV");
-	m_operandNames.emplaceUnique(Hash64(5315u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"AnyHitKHR");
-	m_operandNames.emplaceUnique(Hash64(5316u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"ClosestHitNV");
-	m_operandNames.emplaceUnique(Hash64(5316u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"ClosestHitKHR");
-	m_operandNames.emplaceUnique(Hash64(5317u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"MissNV");
-	m_operandNames.emplaceUnique(Hash64(5317u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"MissKHR");
-	m_operandNames.emplaceUnique(Hash64(5318u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"CallableNV");
-	m_operandNames.emplaceUnique(Hash64(5318u, static_cast<unsigned int>(OperandKind::ExecutionModel)),"CallableKHR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::AddressingModel)),"Logical");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::AddressingModel)),"Physical32");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::AddressingModel)),"Physical64");
-	m_operandNames.emplaceUnique(Hash64(5348u, static_cast<unsigned int>(OperandKind::AddressingModel)),"PhysicalStorageBuffer64");
-	m_operandNames.emplaceUnique(Hash64(5348u, static_cast<unsigned int>(OperandKind::AddressingModel)),"PhysicalStorageBuffer64EXT");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::MemoryModel)),"Simple");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::MemoryModel)),"GLSL450");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::MemoryModel)),"OpenCL");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::MemoryModel)),"Vulkan");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::MemoryModel)),"VulkanKHR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Invocations");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SpacingEqual");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SpacingFractionalEven");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SpacingFractionalOdd");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"VertexOrderCw");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"VertexOrderCcw");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"PixelCenterInteger");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OriginUpperLeft");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OriginLowerLeft");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"EarlyFragmentTests");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"PointMode");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Xfb");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DepthReplacing");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DepthGreater");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DepthLess");
-	m_operandNames.emplaceUnique(Hash64(16u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DepthUnchanged");
-	m_operandNames.emplaceUnique(Hash64(17u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"LocalSize");
-	m_operandNames.emplaceUnique(Hash64(18u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"LocalSizeHint");
-	m_operandNames.emplaceUnique(Hash64(19u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"InputPoints");
-	m_operandNames.emplaceUnique(Hash64(20u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"InputLines");
-	m_operandNames.emplaceUnique(Hash64(21u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"InputLinesAdjacency");
-	m_operandNames.emplaceUnique(Hash64(22u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Triangles");
-	m_operandNames.emplaceUnique(Hash64(23u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"InputTrianglesAdjacency");
-	m_operandNames.emplaceUnique(Hash64(24u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Quads");
-	m_operandNames.emplaceUnique(Hash64(25u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Isolines");
-	m_operandNames.emplaceUnique(Hash64(26u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputVertices");
-	m_operandNames.emplaceUnique(Hash64(27u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputPoints");
-	m_operandNames.emplaceUnique(Hash64(28u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputLineStrip");
-	m_operandNames.emplaceUnique(Hash64(29u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputTriangleStrip");
-	m_operandNames.emplaceUnique(Hash64(30u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"VecTypeHint");
-	m_operandNames.emplaceUnique(Hash64(31u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"ContractionOff");
-	m_operandNames.emplaceUnique(Hash64(33u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Initializer");
-	m_operandNames.emplaceUnique(Hash64(34u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"Finalizer");
-	m_operandNames.emplaceUnique(Hash64(35u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SubgroupSize");
-	m_operandNames.emplaceUnique(Hash64(36u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SubgroupsPerWorkgroup");
-	m_operandNames.emplaceUnique(Hash64(37u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SubgroupsPerWorkgroupId");
-	m_operandNames.emplaceUnique(Hash64(38u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"LocalSizeId");
-	m_operandNames.emplaceUnique(Hash64(39u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"LocalSizeHintId");
-	m_operandNames.emplaceUnique(Hash64(4446u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"PostDepthCoverage");
-	m_operandNames.emplaceUnique(Hash64(4459u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DenormPreserve");
-	m_operandNames.emplaceUnique(Hash64(4460u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DenormFlushToZero");
-	m_operandNames.emplaceUnique(Hash64(4461u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SignedZeroInfNanPreserve");
-	m_operandNames.emplaceUnique(Hash64(4462u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"RoundingModeRTE");
-	m_operandNames.emplaceUnique(Hash64(4463u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"RoundingModeRTZ");
-	m_operandNames.emplaceUnique(Hash64(5027u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"StencilRefReplacingEXT");
-	m_operandNames.emplaceUnique(Hash64(5269u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputLinesNV");
-	m_operandNames.emplaceUnique(Hash64(5270u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputPrimitivesNV");
-	m_operandNames.emplaceUnique(Hash64(5289u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DerivativeGroupQuadsNV");
-	m_operandNames.emplaceUnique(Hash64(5290u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"DerivativeGroupLinearNV");
-	m_operandNames.emplaceUnique(Hash64(5298u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"OutputTrianglesNV");
-	m_operandNames.emplaceUnique(Hash64(5366u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"PixelInterlockOrderedEXT");
-	m_operandNames.emplaceUnique(Hash64(5367u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"PixelInterlockUnorderedEXT");
-	m_operandNames.emplaceUnique(Hash64(5368u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SampleInterlockOrderedEXT");
-	m_operandNames.emplaceUnique(Hash64(5369u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"SampleInterlockUnorderedEXT");
-	m_operandNames.emplaceUnique(Hash64(5370u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"ShadingRateInterlockOrderedEXT");
-	m_operandNames.emplaceUnique(Hash64(5371u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"ShadingRateInterlockUnorderedEXT");
-	m_operandNames.emplaceUnique(Hash64(5893u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"MaxWorkgroupSizeINTEL");
-	m_operandNames.emplaceUnique(Hash64(5894u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"MaxWorkDimINTEL");
-	m_operandNames.emplaceUnique(Hash64(5895u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"NoGlobalOffsetINTEL");
-	m_operandNames.emplaceUnique(Hash64(5896u, static_cast<unsigned int>(OperandKind::ExecutionMode)),"NumSIMDWorkitemsINTEL");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::StorageClass)),"UniformConstant");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::StorageClass)),"Input");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::StorageClass)),"Uniform");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::StorageClass)),"Output");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::StorageClass)),"Workgroup");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::StorageClass)),"CrossWorkgroup");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::StorageClass)),"Private");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::StorageClass)),"Function");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::StorageClass)),"Generic");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::StorageClass)),"PushConstant");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::StorageClass)),"AtomicCounter");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::StorageClass)),"Image");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::StorageClass)),"StorageBuffer");
-	m_operandNames.emplaceUnique(Hash64(5328u, static_cast<unsigned int>(OperandKind::StorageClass)),"CallableDataNV");
-	m_operandNames.emplaceUnique(Hash64(5328u, static_cast<unsigned int>(OperandKind::StorageClass)),"CallableDataKHR");
-	m_operandNames.emplaceUnique(Hash64(5329u, static_cast<unsigned int>(OperandKind::StorageClass)),"IncomingCallableDataNV");
-	m_operandNames.emplaceUnique(Hash64(5329u, static_cast<unsigned int>(OperandKind::StorageClass)),"IncomingCallableDataKHR");
-	m_operandNames.emplaceUnique(Hash64(5338u, static_cast<unsigned int>(OperandKind::StorageClass)),"RayPayloadNV");
-	m_operandNames.emplaceUnique(Hash64(5338u, static_cast<unsigned int>(OperandKind::StorageClass)),"RayPayloadKHR");
-	m_operandNames.emplaceUnique(Hash64(5339u, static_cast<unsigned int>(OperandKind::StorageClass)),"HitAttributeNV");
-	m_operandNames.emplaceUnique(Hash64(5339u, static_cast<unsigned int>(OperandKind::StorageClass)),"HitAttributeKHR");
-	m_operandNames.emplaceUnique(Hash64(5342u, static_cast<unsigned int>(OperandKind::StorageClass)),"IncomingRayPayloadNV");
-	m_operandNames.emplaceUnique(Hash64(5342u, static_cast<unsigned int>(OperandKind::StorageClass)),"IncomingRayPayloadKHR");
-	m_operandNames.emplaceUnique(Hash64(5343u, static_cast<unsigned int>(OperandKind::StorageClass)),"ShaderRecordBufferNV");
-	m_operandNames.emplaceUnique(Hash64(5343u, static_cast<unsigned int>(OperandKind::StorageClass)),"ShaderRecordBufferKHR");
-	m_operandNames.emplaceUnique(Hash64(5349u, static_cast<unsigned int>(OperandKind::StorageClass)),"PhysicalStorageBuffer");
-	m_operandNames.emplaceUnique(Hash64(5349u, static_cast<unsigned int>(OperandKind::StorageClass)),"PhysicalStorageBufferEXT");
-	m_operandNames.emplaceUnique(Hash64(5605u, static_cast<unsigned int>(OperandKind::StorageClass)),"CodeSectionINTEL");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::Dim)),"Dim1D");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::Dim)),"Dim2D");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::Dim)),"Dim3D");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::Dim)),"Cube");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::Dim)),"Rect");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::Dim)),"Buffer");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::Dim)),"SubpassData");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::SamplerAddressingMode)),"None");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::SamplerAddressingMode)),"ClampToEdge");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::SamplerAddressingMode)),"Clamp");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::SamplerAddressingMode)),"Repeat");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::SamplerAddressingMode)),"RepeatMirrored");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::SamplerFilterMode)),"Nearest");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::SamplerFilterMode)),"Linear");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Unknown");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba32f");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba16f");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R32f");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba8");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba8Snorm");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg32f");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg16f");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R11fG11fB10f");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R16f");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba16");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgb10A2");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg16");
-	m_operandNames.emplaceUnique(Hash64(13u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg8");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R16");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R8");
-	m_operandNames.emplaceUnique(Hash64(16u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba16Snorm");
-	m_operandNames.emplaceUnique(Hash64(17u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg16Snorm");
-	m_operandNames.emplaceUnique(Hash64(18u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg8Snorm");
-	m_operandNames.emplaceUnique(Hash64(19u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R16Snorm");
-	m_operandNames.emplaceUnique(Hash64(20u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R8Snorm");
-	m_operandNames.emplaceUnique(Hash64(21u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba32i");
-	m_operandNames.emplaceUnique(Hash64(22u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba16i");
-	m_operandNames.emplaceUnique(Hash64(23u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba8i");
-	m_operandNames.emplaceUnique(Hash64(24u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R32i");
-	m_operandNames.emplaceUnique(Hash64(25u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg32i");
-	m_operandNames.emplaceUnique(Hash64(26u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg16i");
-	m_operandNames.emplaceUnique(Hash64(27u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg8i");
-	m_operandNames.emplaceUnique(Hash64(28u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R16i");
-	m_operandNames.emplaceUnique(Hash64(29u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R8i");
-	m_operandNames.emplaceUnique(Hash64(30u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba32ui");
-	m_operandNames.emplaceUnique(Hash64(31u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba16ui");
-	m_operandNames.emplaceUnique(Hash64(32u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgba8ui");
-	m_operandNames.emplaceUnique(Hash64(33u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R32ui");
-	m_operandNames.emplaceUnique(Hash64(34u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rgb10a2ui");
-	m_operandNames.emplaceUnique(Hash64(35u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg32ui");
-	m_operandNames.emplaceUnique(Hash64(36u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg16ui");
-	m_operandNames.emplaceUnique(Hash64(37u, static_cast<unsigned int>(OperandKind::ImageFormat)),"Rg8ui");
-	m_operandNames.emplaceUnique(Hash64(38u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R16ui");
-	m_operandNames.emplaceUnique(Hash64(39u, static_cast<unsigned int>(OperandKind::ImageFormat)),"R8ui");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"R");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"A");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"RG");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"RA");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"RGB");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"RGBA");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"BGRA");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"ARGB");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"Intensity");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"Luminance");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"Rx");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"RGx");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"RGBx");
-	m_operandNames.emplaceUnique(Hash64(13u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"Depth");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"DepthStencil");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"sRGB");
-	m_operandNames.emplaceUnique(Hash64(16u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"sRGBx");
-	m_operandNames.emplaceUnique(Hash64(17u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"sRGBA");
-	m_operandNames.emplaceUnique(Hash64(18u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"sBGRA");
-	m_operandNames.emplaceUnique(Hash64(19u, static_cast<unsigned int>(OperandKind::ImageChannelOrder)),"ABGR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"SnormInt8");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"SnormInt16");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormInt8");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormInt16");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormShort565");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormShort555");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormInt101010");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"SignedInt8");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"SignedInt16");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"SignedInt32");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnsignedInt8");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnsignedInt16");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnsignedInt32");
-	m_operandNames.emplaceUnique(Hash64(13u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"HalfFloat");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"Float");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormInt24");
-	m_operandNames.emplaceUnique(Hash64(16u, static_cast<unsigned int>(OperandKind::ImageChannelDataType)),"UnormInt101010_2");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::FPRoundingMode)),"RTE");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::FPRoundingMode)),"RTZ");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::FPRoundingMode)),"RTP");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::FPRoundingMode)),"RTN");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::LinkageType)),"Export");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::LinkageType)),"Import");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::AccessQualifier)),"ReadOnly");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::AccessQualifier)),"WriteOnly");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::AccessQualifier)),"ReadWrite");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"Zext");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"Sext");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"ByVal");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"Sret");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"NoAlias");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"NoCapture");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"NoWrite");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::FunctionParameterAttribute)),"NoReadWrite");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::Decoration)),"RelaxedPrecision");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::Decoration)),"SpecId");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::Decoration)),"Block");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::Decoration)),"BufferBlock");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::Decoration)),"RowMajor");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::Decoration)),"ColMajor");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::Decoration)),"ArrayStride");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::Decoration)),"MatrixStride");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::Decoration)),"GLSLShared");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::Decoration)),"GLSLPacked");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::Decoration)),"CPacked");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::Decoration)),"BuiltIn");
-	m_operandNames.emplaceUnique(Hash64(13u, static_cast<unsigned int>(OperandKind::Decoration)),"NoPerspective");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::Decoration)),"Flat");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::Decoration)),"Patch");
-	m_operandNames.emplaceUnique(Hash64(16u, static_cast<unsigned int>(OperandKind::Decoration)),"Centroid");
-	m_operandNames.emplaceUnique(Hash64(17u, static_cast<unsigned int>(OperandKind::Decoration)),"Sample");
-	m_operandNames.emplaceUnique(Hash64(18u, static_cast<unsigned int>(OperandKind::Decoration)),"Invariant");
-	m_operandNames.emplaceUnique(Hash64(19u, static_cast<unsigned int>(OperandKind::Decoration)),"Restrict");
-	m_operandNames.emplaceUnique(Hash64(20u, static_cast<unsigned int>(OperandKind::Decoration)),"Aliased");
-	m_operandNames.emplaceUnique(Hash64(21u, static_cast<unsigned int>(OperandKind::Decoration)),"Volatile");
-	m_operandNames.emplaceUnique(Hash64(22u, static_cast<unsigned int>(OperandKind::Decoration)),"Constant");
-	m_operandNames.emplaceUnique(Hash64(23u, static_cast<unsigned int>(OperandKind::Decoration)),"Coherent");
-	m_operandNames.emplaceUnique(Hash64(24u, static_cast<unsigned int>(OperandKind::Decoration)),"NonWritable");
-	m_operandNames.emplaceUnique(Hash64(25u, static_cast<unsigned int>(OperandKind::Decoration)),"NonReadable");
-	m_operandNames.emplaceUnique(Hash64(26u, static_cast<unsigned int>(OperandKind::Decoration)),"Uniform");
-	m_operandNames.emplaceUnique(Hash64(27u, static_cast<unsigned int>(OperandKind::Decoration)),"UniformId");
-	m_operandNames.emplaceUnique(Hash64(28u, static_cast<unsigned int>(OperandKind::Decoration)),"SaturatedConversion");
-	m_operandNames.emplaceUnique(Hash64(29u, static_cast<unsigned int>(OperandKind::Decoration)),"Stream");
-	m_operandNames.emplaceUnique(Hash64(30u, static_cast<unsigned int>(OperandKind::Decoration)),"Location");
-	m_operandNames.emplaceUnique(Hash64(31u, static_cast<unsigned int>(OperandKind::Decoration)),"Component");
-	m_operandNames.emplaceUnique(Hash64(32u, static_cast<unsigned int>(OperandKind::Decoration)),"Index");
-	m_operandNames.emplaceUnique(Hash64(33u, static_cast<unsigned int>(OperandKind::Decoration)),"Binding");
-	m_operandNames.emplaceUnique(Hash64(34u, static_cast<unsigned int>(OperandKind::Decoration)),"DescriptorSet");
-	m_operandNames.emplaceUnique(Hash64(35u, static_cast<unsigned int>(OperandKind::Decoration)),"Offset");
-	m_operandNames.emplaceUnique(Hash64(36u, static_cast<unsigned int>(OperandKind::Decoration)),"XfbBuffer");
-	m_operandNames.emplaceUnique(Hash64(37u, static_cast<unsigned int>(OperandKind::Decoration)),"XfbStride");
-	m_operandNames.emplaceUnique(Hash64(38u, static_cast<unsigned int>(OperandKind::Decoration)),"FuncParamAttr");
-	m_operandNames.emplaceUnique(Hash64(39u, static_cast<unsigned int>(OperandKind::Decoration)),"FPRoundingMode");
-	m_operandNames.emplaceUnique(Hash64(40u, static_cast<unsigned int>(OperandKind::Decoration)),"FPFastMathMode");
-	m_operandNames.emplaceUnique(Hash64(41u, static_cast<unsigned int>(OperandKind::Decoration)),"LinkageAttributes");
-	m_operandNames.emplaceUnique(Hash64(42u, static_cast<unsigned int>(OperandKind::Decoration)),"NoContraction");
-	m_operandNames.emplaceUnique(Hash64(43u, static_cast<unsigned int>(OperandKind::Decoration)),"InputAttachmentIndex");
-	m_operandNames.emplaceUnique(Hash64(44u, static_cast<unsigned int>(OperandKind::Decoration)),"Alignment");
-	m_operandNames.emplaceUnique(Hash64(45u, static_cast<unsigned int>(OperandKind::Decoration)),"MaxByteOffset");
-	m_operandNames.emplaceUnique(Hash64(46u, static_cast<unsigned int>(OperandKind::Decoration)),"AlignmentId");
-	m_operandNames.emplaceUnique(Hash64(47u, static_cast<unsigned int>(OperandKind::Decoration)),"MaxByteOffsetId");
-	m_operandNames.emplaceUnique(Hash64(4469u, static_cast<unsigned int>(OperandKind::Decoration)),"NoSignedWrap");
-	m_operandNames.emplaceUnique(Hash64(4470u, static_cast<unsigned int>(OperandKind::Decoration)),"NoUnsignedWrap");
-	m_operandNames.emplaceUnique(Hash64(4999u, static_cast<unsigned int>(OperandKind::Decoration)),"ExplicitInterpAMD");
-	m_operandNames.emplaceUnique(Hash64(5248u, static_cast<unsigned int>(OperandKind::Decoration)),"OverrideCoverageNV");
-	m_operandNames.emplaceUnique(Hash64(5250u, static_cast<unsigned int>(OperandKind::Decoration)),"PassthroughNV");
-	m_operandNames.emplaceUnique(Hash64(5252u, static_cast<unsigned int>(OperandKind::Decoration)),"ViewportRelativeNV");
-	m_operandNames.emplaceUnique(Hash64(5256u, static_cast<unsigned int>(OperandKind::Decoration)),"SecondaryViewportRelativeNV");
-	m_operandNames.emplaceUnique(Hash64(5271u, static_cast<unsigned int>(OperandKind::Decoration)),"PerPrimitiveNV");
-	m_operandNames.emplaceUnique(Hash64(5272u, static_cast<unsigned int>(OperandKind::Decoration)),"PerViewNV");
-	m_operandNames.emplaceUnique(Hash64(5273u, static_cast<unsigned int>(OperandKind::Decoration)),"PerTaskNV");
-	m_operandNames.emplaceUnique(Hash64(5285u, static_cast<unsigned int>(OperandKind::Decoration)),"PerVertexNV");
-	m_operandNames.emplaceUnique(Hash64(5300u, static_cast<unsigned int>(OperandKind::Decoration)),"NonUniform");
-	m_operandNames.emplaceUnique(Hash64(5300u, static_cast<unsigned int>(OperandKind::Decoration)),"NonUniformEXT");
-	m_operandNames.emplaceUnique(Hash64(5355u, static_cast<unsigned int>(OperandKind::Decoration)),"RestrictPointer");
-	m_operandNames.emplaceUnique(Hash64(5355u, static_cast<unsigned int>(OperandKind::Decoration)),"RestrictPointerEXT");
-	m_operandNames.emplaceUnique(Hash64(5356u, static_cast<unsigned int>(OperandKind::Decoration)),"AliasedPointer");
-	m_operandNames.emplaceUnique(Hash64(5356u, static_cast<unsigned int>(OperandKind::Decoration)),"AliasedPointerEXT");
-	m_operandNames.emplaceUnique(Hash64(5602u, static_cast<unsigned int>(OperandKind::Decoration)),"ReferencedIndirectlyINTEL");
-	m_operandNames.emplaceUnique(Hash64(5634u, static_cast<unsigned int>(OperandKind::Decoration)),"CounterBuffer");
-	m_operandNames.emplaceUnique(Hash64(5634u, static_cast<unsigned int>(OperandKind::Decoration)),"HlslCounterBufferGOOGLE");
-	m_operandNames.emplaceUnique(Hash64(5635u, static_cast<unsigned int>(OperandKind::Decoration)),"UserSemantic");
-	m_operandNames.emplaceUnique(Hash64(5635u, static_cast<unsigned int>(OperandKind::Decoration)),"HlslSemanticGOOGLE");
-	m_operandNames.emplaceUnique(Hash64(5636u, static_cast<unsigned int>(OperandKind::Decoration)),"UserTypeGOOGLE");
-	m_operandNames.emplaceUnique(Hash64(5825u, static_cast<unsigned int>(OperandKind::Decoration)),"RegisterINTEL");
-	m_operandNames.emplaceUnique(Hash64(5826u, static_cast<unsigned int>(OperandKind::Decoration)),"MemoryINTEL");
-	m_operandNames.emplaceUnique(Hash64(5827u, static_cast<unsigned int>(OperandKind::Decoration)),"NumbanksINTEL");
-	m_operandNames.emplaceUnique(Hash64(5828u, static_cast<unsigned int>(OperandKind::Decoration)),"BankwidthINTEL");
-	m_operandNames.emplaceUnique(Hash64(5829u, static_cast<unsigned int>(OperandKind::Decoration)),"MaxPrivateCopiesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5830u, static_cast<unsigned int>(OperandKind::Decoration)),"SinglepumpINTEL");
-	m_operandNames.emplaceUnique(Hash64(5831u, static_cast<unsigned int>(OperandKind::Decoration)),"DoublepumpINTEL");
-	m_operandNames.emplaceUnique(Hash64(5832u, static_cast<unsigned int>(OperandKind::Decoration)),"MaxReplicatesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5833u, static_cast<unsigned int>(OperandKind::Decoration)),"SimpleDualPortINTEL");
-	m_operandNames.emplaceUnique(Hash64(5834u, static_cast<unsigned int>(OperandKind::Decoration)),"MergeINTEL");
-	m_operandNames.emplaceUnique(Hash64(5835u, static_cast<unsigned int>(OperandKind::Decoration)),"BankBitsINTEL");
-	m_operandNames.emplaceUnique(Hash64(5836u, static_cast<unsigned int>(OperandKind::Decoration)),"ForcePow2DepthINTEL");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::BuiltIn)),"Position");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PointSize");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ClipDistance");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::BuiltIn)),"CullDistance");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::BuiltIn)),"VertexId");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::BuiltIn)),"InstanceId");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PrimitiveId");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::BuiltIn)),"InvocationId");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::BuiltIn)),"Layer");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ViewportIndex");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::BuiltIn)),"TessLevelOuter");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::BuiltIn)),"TessLevelInner");
-	m_operandNames.emplaceUnique(Hash64(13u, static_cast<unsigned int>(OperandKind::BuiltIn)),"TessCoord");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PatchVertices");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FragCoord");
-	m_operandNames.emplaceUnique(Hash64(16u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PointCoord");
-	m_operandNames.emplaceUnique(Hash64(17u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FrontFacing");
-	m_operandNames.emplaceUnique(Hash64(18u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SampleId");
-	m_operandNames.emplaceUnique(Hash64(19u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SamplePosition");
-	m_operandNames.emplaceUnique(Hash64(20u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SampleMask");
-	m_operandNames.emplaceUnique(Hash64(22u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FragDepth");
-	m_operandNames.emplaceUnique(Hash64(23u, static_cast<unsigned int>(OperandKind::BuiltIn)),"HelperInvocation");
-	m_operandNames.emplaceUnique(Hash64(24u, static_cast<unsigned int>(OperandKind::BuiltIn)),"NumWorkgroups");
-	m_operandNames.emplaceUnique(Hash64(25u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorkgroupSize");
-	m_operandNames.emplaceUnique(Hash64(26u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorkgroupId");
-	m_operandNames.emplaceUnique(Hash64(27u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LocalInvocationId");
-	m_operandNames.emplaceUnique(Hash64(28u, static_cast<unsigned int>(OperandKind::BuiltIn)),"GlobalInvocationId");
-	m_operandNames.emplaceUnique(Hash64(29u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LocalInvocationIndex");
-	m_operandNames.emplaceUnique(Hash64(30u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorkDim");
-	m_operandNames.emplaceUnique(Hash64(31u, static_cast<unsigned int>(OperandKind::BuiltIn)),"GlobalSize");
-	m_operandNames.emplaceUnique(Hash64(32u, static_cast<unsigned int>(OperandKind::BuiltIn)),"EnqueuedWorkgroupSize");
-	m_operandNames.emplaceUnique(Hash64(33u, static_cast<unsigned int>(OperandKind::BuiltIn)),"GlobalOffset");
-	m_operandNames.emplaceUnique(Hash64(34u, static_cast<unsigned int>(OperandKind::BuiltIn)),"GlobalLinearId");
-	m_operandNames.emplaceUnique(Hash64(36u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupSize");
-	m_operandNames.emplaceUnique(Hash64(37u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupMaxSize");
-	m_operandNames.emplaceUnique(Hash64(38u, static_cast<unsigned int>(OperandKind::BuiltIn)),"NumSubgroups");
-	m_operandNames.emplaceUnique(Hash64(39u, static_cast<unsigned int>(OperandKind::BuiltIn)),"NumEnqueuedSubgroups");
-	m_operandNames.emplaceUnique(Hash64(40u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupId");
-	m_operandNames.emplaceUnique(Hash64(41u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupLocalInvocationId");
-	m_operandNames.emplaceUnique(Hash64(42u, static_cast<unsigned int>(OperandKind::BuiltIn)),"VertexIndex");
-	m_operandNames.emplaceUnique(Hash64(43u, static_cast<unsigned int>(OperandKind::BuiltIn)),"InstanceIndex");
-	m_operandNames.emplaceUnique(Hash64(4416u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupEqMask");
-	m_operandNames.emplaceUnique(Hash64(4417u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupGeMask");
-	m_operandNames.emplaceUnique(Hash64(4418u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupGtMask");
-	m_operandNames.emplaceUnique(Hash64(4419u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupLeMask");
-	m_operandNames.emplaceUnique(Hash64(4420u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupLtMask");
-	m_operandNames.emplaceUnique(Hash64(4416u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupEqMaskKHR");
-	m_operandNames.emplaceUnique(Hash64(4417u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupGeMaskKHR");
-	m_operandNames.emplaceUnique(Hash64(4418u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupGtMaskKHR");
-	m_operandNames.emplaceUnique(Hash64(4419u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupLeMaskKHR");
-	m_operandNames.emplaceUnique(Hash64(4420u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SubgroupLtMaskKHR");
-	m_operandNames.emplaceUnique(Hash64(4424u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaseVertex");
-	m_operandNames.emplaceUnique(Hash64(4425u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaseInstance");
-	m_operandNames.emplaceUnique(Hash64(4426u, static_cast<unsigned int>(OperandKind::BuiltIn)),"DrawIndex");
-	m_operandNames.emplaceUnique(Hash64(4438u, static_cast<unsigned int>(OperandKind::BuiltIn)),"DeviceIndex");
-	m_operandNames.emplaceUnique(Hash64(4440u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ViewIndex");
-	m_operandNames.emplaceUnique(Hash64(4992u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordNoPerspAMD");
-	m_operandNames.emplaceUnique(Hash64(4993u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordNoPerspCentroidAMD");
-	m_operandNames.emplaceUnique(Hash64(4994u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordNoPerspSampleAMD");
-	m_operandNames.emplaceUnique(Hash64(4995u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordSmoothAMD");
-	m_operandNames.emplaceUnique(Hash64(4996u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordSmoothCentroidAMD");
-	m_operandNames.emplaceUnique(Hash64(4997u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordSmoothSampleAMD");
-	m_operandNames.emplaceUnique(Hash64(4998u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordPullModelAMD");
-	m_operandNames.emplaceUnique(Hash64(5014u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FragStencilRefEXT");
-	m_operandNames.emplaceUnique(Hash64(5253u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ViewportMaskNV");
-	m_operandNames.emplaceUnique(Hash64(5257u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SecondaryPositionNV");
-	m_operandNames.emplaceUnique(Hash64(5258u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SecondaryViewportMaskNV");
-	m_operandNames.emplaceUnique(Hash64(5261u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PositionPerViewNV");
-	m_operandNames.emplaceUnique(Hash64(5262u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ViewportMaskPerViewNV");
-	m_operandNames.emplaceUnique(Hash64(5264u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FullyCoveredEXT");
-	m_operandNames.emplaceUnique(Hash64(5274u, static_cast<unsigned int>(OperandKind::BuiltIn)),"TaskCountNV");
-	m_operandNames.emplaceUnique(Hash64(5275u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PrimitiveCountNV");
-	m_operandNames.emplaceUnique(Hash64(5276u, static_cast<unsigned int>(OperandKind::BuiltIn)),"PrimitiveIndicesNV");
-	m_operandNames.emplaceUnique(Hash64(5277u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ClipDistancePerViewNV");
-	m_operandNames.emplaceUnique(Hash64(5278u, static_cast<unsigned int>(OperandKind::BuiltIn)),"CullDistancePerViewNV");
-	m_operandNames.emplaceUnique(Hash64(5279u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LayerPerViewNV");
-	m_operandNames.emplaceUnique(Hash64(5280u, static_cast<unsigned int>(OperandKind::BuiltIn)),"MeshViewCountNV");
-	m_operandNames.emplaceUnique(Hash64(5281u, static_cast<unsigned int>(OperandKind::BuiltIn)),"MeshViewIndicesNV");
-	m_operandNames.emplaceUnique(Hash64(5286u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordNV");
-	m_operandNames.emplaceUnique(Hash64(5287u, static_cast<unsigned int>(OperandKind::BuiltIn)),"BaryCoordNoPerspNV");
-	m_operandNames.emplaceUnique(Hash64(5292u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FragSizeEXT");
-	m_operandNames.emplaceUnique(Hash64(5292u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FragmentSizeNV");
-	m_operandNames.emplaceUnique(Hash64(5293u, static_cast<unsigned int>(OperandKind::BuiltIn)),"FragInvocationCountEXT");
-	m_operandNames.emplaceUnique(Hash64(5293u, static_cast<unsigned int>(OperandKind::BuiltIn)),"InvocationsPerPixelNV");
-	m_operandNames.emplaceUnique(Hash64(5319u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LaunchIdNV");
-	m_operandNames.emplaceUnique(Hash64(5319u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LaunchIdKHR");
-	m_operandNames.emplaceUnique(Hash64(5320u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LaunchSizeNV");
-	m_operandNames.emplaceUnique(Hash64(5320u, static_cast<unsigned int>(OperandKind::BuiltIn)),"LaunchSizeKHR");
-	m_operandNames.emplaceUnique(Hash64(5321u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorldRayOriginNV");
-	m_operandNames.emplaceUnique(Hash64(5321u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorldRayOriginKHR");
-	m_operandNames.emplaceUnique(Hash64(5322u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorldRayDirectionNV");
-	m_operandNames.emplaceUnique(Hash64(5322u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorldRayDirectionKHR");
-	m_operandNames.emplaceUnique(Hash64(5323u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ObjectRayOriginNV");
-	m_operandNames.emplaceUnique(Hash64(5323u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ObjectRayOriginKHR");
-	m_operandNames.emplaceUnique(Hash64(5324u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ObjectRayDirectionNV");
-	m_operandNames.emplaceUnique(Hash64(5324u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ObjectRayDirectionKHR");
-	m_operandNames.emplaceUnique(Hash64(5325u, static_cast<unsigned int>(OperandKind::BuiltIn)),"RayTminNV");
-	m_operandNames.emplaceUnique(Hash64(5325u, static_cast<unsigned int>(OperandKind::BuiltIn)),"RayTminKHR");
-	m_operandNames.emplaceUnique(Hash64(5326u, static_cast<unsigned int>(OperandKind::BuiltIn)),"RayTmaxNV");
-	m_operandNames.emplaceUnique(Hash64(5326u, static_cast<unsigned int>(OperandKind::BuiltIn)),"RayTmaxKHR");
-	m_operandNames.emplaceUnique(Hash64(5327u, static_cast<unsigned int>(OperandKind::BuiltIn)),"InstanceCustomIndexNV");
-	m_operandNames.emplaceUnique(Hash64(5327u, static_cast<unsigned int>(OperandKind::BuiltIn)),"InstanceCustomIndexKHR");
-	m_operandNames.emplaceUnique(Hash64(5330u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ObjectToWorldNV");
-	m_operandNames.emplaceUnique(Hash64(5330u, static_cast<unsigned int>(OperandKind::BuiltIn)),"ObjectToWorldKHR");
-	m_operandNames.emplaceUnique(Hash64(5331u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorldToObjectNV");
-	m_operandNames.emplaceUnique(Hash64(5331u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WorldToObjectKHR");
-	m_operandNames.emplaceUnique(Hash64(5332u, static_cast<unsigned int>(OperandKind::BuiltIn)),"HitTNV");
-	m_operandNames.emplaceUnique(Hash64(5332u, static_cast<unsigned int>(OperandKind::BuiltIn)),"HitTKHR");
-	m_operandNames.emplaceUnique(Hash64(5333u, static_cast<unsigned int>(OperandKind::BuiltIn)),"HitKindNV");
-	m_operandNames.emplaceUnique(Hash64(5333u, static_cast<unsigned int>(OperandKind::BuiltIn)),"HitKindKHR");
-	m_operandNames.emplaceUnique(Hash64(5351u, static_cast<unsigned int>(OperandKind::BuiltIn)),"IncomingRayFlagsNV");
-	m_operandNames.emplaceUnique(Hash64(5351u, static_cast<unsigned int>(OperandKind::BuiltIn)),"IncomingRayFlagsKHR");
-	m_operandNames.emplaceUnique(Hash64(5352u, static_cast<unsigned int>(OperandKind::BuiltIn)),"RayGeometryIndexKHR");
-	m_operandNames.emplaceUnique(Hash64(5374u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WarpsPerSMNV");
-	m_operandNames.emplaceUnique(Hash64(5375u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SMCountNV");
-	m_operandNames.emplaceUnique(Hash64(5376u, static_cast<unsigned int>(OperandKind::BuiltIn)),"WarpIDNV");
-	m_operandNames.emplaceUnique(Hash64(5377u, static_cast<unsigned int>(OperandKind::BuiltIn)),"SMIDNV");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::Scope)),"CrossDevice");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::Scope)),"Device");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::Scope)),"Workgroup");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::Scope)),"Subgroup");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::Scope)),"Invocation");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::Scope)),"QueueFamily");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::Scope)),"QueueFamilyKHR");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::Scope)),"ShaderCallKHR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::GroupOperation)),"Reduce");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::GroupOperation)),"InclusiveScan");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::GroupOperation)),"ExclusiveScan");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::GroupOperation)),"ClusteredReduce");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::GroupOperation)),"PartitionedReduceNV");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::GroupOperation)),"PartitionedInclusiveScanNV");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::GroupOperation)),"PartitionedExclusiveScanNV");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::KernelEnqueueFlags)),"NoWait");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::KernelEnqueueFlags)),"WaitKernel");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::KernelEnqueueFlags)),"WaitWorkGroup");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::Capability)),"Matrix");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::Capability)),"Shader");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::Capability)),"Geometry");
-	m_operandNames.emplaceUnique(Hash64(3u, static_cast<unsigned int>(OperandKind::Capability)),"Tessellation");
-	m_operandNames.emplaceUnique(Hash64(4u, static_cast<unsigned int>(OperandKind::Capability)),"Addresses");
-	m_operandNames.emplaceUnique(Hash64(5u, static_cast<unsigned int>(OperandKind::Capability)),"Linkage");
-	m_operandNames.emplaceUnique(Hash64(6u, static_cast<unsigned int>(OperandKind::Capability)),"Kernel");
-	m_operandNames.emplaceUnique(Hash64(7u, static_cast<unsigned int>(OperandKind::Capability)),"Vector16");
-	m_operandNames.emplaceUnique(Hash64(8u, static_cast<unsigned int>(OperandKind::Capability)),"Float16Buffer");
-	m_operandNames.emplaceUnique(Hash64(9u, static_cast<unsigned int>(OperandKind::Capability)),"Float16");
-	m_operandNames.emplaceUnique(Hash64(10u, static_cast<unsigned int>(OperandKind::Capability)),"Float64");
-	m_operandNames.emplaceUnique(Hash64(11u, static_cast<unsigned int>(OperandKind::Capability)),"Int64");
-	m_operandNames.emplaceUnique(Hash64(12u, static_cast<unsigned int>(OperandKind::Capability)),"Int64Atomics");
-	m_operandNames.emplaceUnique(Hash64(13u, static_cast<unsigned int>(OperandKind::Capability)),"ImageBasic");
-	m_operandNames.emplaceUnique(Hash64(14u, static_cast<unsigned int>(OperandKind::Capability)),"ImageReadWrite");
-	m_operandNames.emplaceUnique(Hash64(15u, static_cast<unsigned int>(OperandKind::Capability)),"ImageMipmap");
-	m_operandNames.emplaceUnique(Hash64(17u, static_cast<unsigned int>(OperandKind::Capability)),"Pipes");
-	m_operandNames.emplaceUnique(Hash64(18u, static_cast<unsigned int>(OperandKind::Capability)),"Groups");
-	m_operandNames.emplaceUnique(Hash64(19u, static_cast<unsigned int>(OperandKind::Capability)),"DeviceEnqueue");
-	m_operandNames.emplaceUnique(Hash64(20u, static_cast<unsigned int>(OperandKind::Capability)),"LiteralSampler");
-	m_operandNames.emplaceUnique(Hash64(21u, static_cast<unsigned int>(OperandKind::Capability)),"AtomicStorage");
-	m_operandNames.emplaceUnique(Hash64(22u, static_cast<unsigned int>(OperandKind::Capability)),"Int16");
-	m_operandNames.emplaceUnique(Hash64(23u, static_cast<unsigned int>(OperandKind::Capability)),"TessellationPointSize");
-	m_operandNames.emplaceUnique(Hash64(24u, static_cast<unsigned int>(OperandKind::Capability)),"GeometryPointSize");
-	m_operandNames.emplaceUnique(Hash64(25u, static_cast<unsigned int>(OperandKind::Capability)),"ImageGatherExtended");
-	m_operandNames.emplaceUnique(Hash64(27u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageMultisample");
-	m_operandNames.emplaceUnique(Hash64(28u, static_cast<unsigned int>(OperandKind::Capability)),"UniformBufferArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(29u, static_cast<unsigned int>(OperandKind::Capability)),"SampledImageArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(30u, static_cast<unsigned int>(OperandKind::Capability)),"StorageBufferArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(31u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(32u, static_cast<unsigned int>(OperandKind::Capability)),"ClipDistance");
-	m_operandNames.emplaceUnique(Hash64(33u, static_cast<unsigned int>(OperandKind::Capability)),"CullDistance");
-	m_operandNames.emplaceUnique(Hash64(34u, static_cast<unsigned int>(OperandKind::Capability)),"ImageCubeArray");
-	m_operandNames.emplaceUnique(Hash64(35u, static_cast<unsigned int>(OperandKind::Capability)),"SampleRateShading");
-	m_operandNames.emplaceUnique(Hash64(36u, static_cast<unsigned int>(OperandKind::Capability)),"ImageRect");
-	m_operandNames.emplaceUnique(Hash64(37u, static_cast<unsigned int>(OperandKind::Capability)),"SampledRect");
-	m_operandNames.emplaceUnique(Hash64(38u, static_cast<unsigned int>(OperandKind::Capability)),"GenericPointer");
-	m_operandNames.emplaceUnique(Hash64(39u, static_cast<unsigned int>(OperandKind::Capability)),"Int8");
-	m_operandNames.emplaceUnique(Hash64(40u, static_cast<unsigned int>(OperandKind::Capability)),"InputAttachment");
-	m_operandNames.emplaceUnique(Hash64(41u, static_cast<unsigned int>(OperandKind::Capability)),"SparseResidency");
-	m_operandNames.emplaceUnique(Hash64(42u, static_cast<unsigned int>(OperandKind::Capability)),"MinLod");
-	m_operandNames.emplaceUnique(Hash64(43u, static_cast<unsigned int>(OperandKind::Capability)),"Sampled1D");
-	m_operandNames.emplaceUnique(Hash64(44u, static_cast<unsigned int>(OperandKind::Capability)),"Image1D");
-	m_operandNames.emplaceUnique(Hash64(45u, static_cast<unsigned int>(OperandKind::Capability)),"SampledCubeArray");
-	m_operandNames.emplaceUnique(Hash64(46u, static_cast<unsigned int>(OperandKind::Capability)),"SampledBuffer");
-	m_operandNames.emplaceUnique(Hash64(47u, static_cast<unsigned int>(OperandKind::Capability)),"ImageBuffer");
-	m_operandNames.emplaceUnique(Hash64(48u, static_cast<unsigned int>(OperandKind::Capability)),"ImageMSArray");
-	m_operandNames.emplaceUnique(Hash64(49u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageExtendedFormats");
-	m_operandNames.emplaceUnique(Hash64(50u, static_cast<unsigned int>(OperandKind::Capability)),"ImageQuery");
-	m_operandNames.emplaceUnique(Hash64(51u, static_cast<unsigned int>(OperandKind::Capability)),"DerivativeControl");
-	m_operandNames.emplaceUnique(Hash64(52u, static_cast<unsigned int>(OperandKind::Capability)),"InterpolationFunction");
-	m_operandNames.emplaceUnique(Hash64(53u, static_cast<unsigned int>(OperandKind::Capability)),"TransformFeedback");
-	m_operandNames.emplaceUnique(Hash64(54u, static_cast<unsigned int>(OperandKind::Capability)),"GeometryStreams");
-	m_operandNames.emplaceUnique(Hash64(55u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageReadWithoutFormat");
-	m_operandNames.emplaceUnique(Hash64(56u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageWriteWithoutFormat");
-	m_operandNames.emplaceUnique(Hash64(57u, static_cast<unsigned int>(OperandKind::Capability)),"MultiViewport");
-	m_operandNames.emplaceUnique(Hash64(58u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupDispatch");
-	m_operandNames.emplaceUnique(Hash64(59u, static_cast<unsigned int>(OperandKind::Capability)),"NamedBarrier");
-	m_operandNames.emplaceUnique(Hash64(60u, static_cast<unsigned int>(OperandKind::Capability)),"PipeStorage");
-	m_operandNames.emplaceUnique(Hash64(61u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniform");
-	m_operandNames.emplaceUnique(Hash64(62u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformVote");
-	m_operandNames.emplaceUnique(Hash64(63u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformArithmetic");
-	m_operandNames.emplaceUnique(Hash64(64u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformBallot");
-	m_operandNames.emplaceUnique(Hash64(65u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformShuffle");
-	m_operandNames.emplaceUnique(Hash64(66u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformShuffleRelative");
-	m_operandNames.emplaceUnique(Hash64(67u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformClustered");
-	m_operandNames.emplaceUnique(Hash64(68u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformQuad");
-	m_operandNames.emplaceUnique(Hash64(69u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderLayer");
-	m_operandNames.emplaceUnique(Hash64(70u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderViewportIndex");
-	m_operandNames.emplaceUnique(Hash64(4423u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupBallotKHR");
-	m_operandNames.emplaceUnique(Hash64(4427u, static_cast<unsigned int>(OperandKind::Capability)),"DrawParameters");
-	m_operandNames.emplaceUnique(Hash64(4431u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupVoteKHR");
-	m_operandNames.emplaceUnique(Hash64(4433u, static_cast<unsigned int>(OperandKind::Capability)),"StorageBuffer16BitAccess");
-	m_operandNames.emplaceUnique(Hash64(4433u, static_cast<unsigned int>(OperandKind::Capability)),"StorageUniformBufferBlock16");
-	m_operandNames.emplaceUnique(Hash64(4434u, static_cast<unsigned int>(OperandKind::Capability)),"UniformAndStorageBuffer16BitAccess");
-	m_operandNames.emplaceUnique(Hash64(4434u, static_cast<unsigned int>(OperandKind::Capability)),"StorageUniform16");
-	m_operandNames.emplaceUnique(Hash64(4435u, static_cast<unsigned int>(OperandKind::Capability)),"StoragePushConstant16");
-	m_operandNames.emplaceUnique(Hash64(4436u, static_cast<unsigned int>(OperandKind::Capability)),"StorageInputOutput16");
-	m_operandNames.emplaceUnique(Hash64(4437u, static_cast<unsigned int>(OperandKind::Capability)),"DeviceGroup");
-	m_operandNames.emplaceUnique(Hash64(4439u, static_cast<unsigned int>(OperandKind::Capability)),"MultiView");
-	m_operandNames.emplaceUnique(Hash64(4441u, static_cast<unsigned int>(OperandKind::Capability)),"VariablePointersStorageBuffer");
-	m_operandNames.emplaceUnique(Hash64(4442u, static_cast<unsigned int>(OperandKind::Capability)),"VariablePointers");
-	m_operandNames.emplaceUnique(Hash64(4445u, static_cast<unsigned int>(OperandKind::Capability)),"AtomicStorageOps");
-	m_operandNames.emplaceUnique(Hash64(4447u, static_cast<unsigned int>(OperandKind::Capability)),"SampleMaskPostDepthCoverage");
-	m_operandNames.emplaceUnique(Hash64(4448u, static_cast<unsigned int>(OperandKind::Capability)),"StorageBuffer8BitAccess");
-	m_operandNames.emplaceUnique(Hash64(4449u, static_cast<unsigned int>(OperandKind::Capability)),"UniformAndStorageBuffer8BitAccess");
-	m_operandNames.emplaceUnique(Hash64(4450u, static_cast<unsigned int>(OperandKind::Capability)),"StoragePushConstant8");
-	m_operandNames.emplaceUnique(Hash64(4464u, static_cast<unsigned int>(OperandKind::Capability)),"DenormPreserve");
-	m_operandNames.emplaceUnique(Hash64(4465u, static_cast<unsigned int>(OperandKind::Capability)),"DenormFlushToZero");
-	m_operandNames.emplaceUnique(Hash64(4466u, static_cast<unsigned int>(OperandKind::Capability)),"SignedZeroInfNanPreserve");
-	m_operandNames.emplaceUnique(Hash64(4467u, static_cast<unsigned int>(OperandKind::Capability)),"RoundingModeRTE");
-	m_operandNames.emplaceUnique(Hash64(4468u, static_cast<unsigned int>(OperandKind::Capability)),"RoundingModeRTZ");
-	m_operandNames.emplaceUnique(Hash64(4471u, static_cast<unsigned int>(OperandKind::Capability)),"RayQueryProvisionalKHR");
-	m_operandNames.emplaceUnique(Hash64(4478u, static_cast<unsigned int>(OperandKind::Capability)),"RayTraversalPrimitiveCullingProvisionalKHR");
-	m_operandNames.emplaceUnique(Hash64(5008u, static_cast<unsigned int>(OperandKind::Capability)),"Float16ImageAMD");
-	m_operandNames.emplaceUnique(Hash64(5009u, static_cast<unsigned int>(OperandKind::Capability)),"ImageGatherBiasLodAMD");
-	m_operandNames.emplaceUnique(Hash64(5010u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentMaskAMD");
-	m_operandNames.emplaceUnique(Hash64(5013u, static_cast<unsigned int>(OperandKind::Capability)),"StencilExportEXT");
-	m_operandNames.emplaceUnique(Hash64(5015u, static_cast<unsigned int>(OperandKind::Capability)),"ImageReadWriteLodAMD");
-	m_operandNames.emplaceUnique(Hash64(5055u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderClockKHR");
-	m_operandNames.emplaceUnique(Hash64(5249u, static_cast<unsigned int>(OperandKind::Capability)),"SampleMaskOverrideCoverageNV");
-	m_operandNames.emplaceUnique(Hash64(5251u, static_cast<unsigned int>(OperandKind::Capability)),"GeometryShaderPassthroughNV");
-	m_operandNames.emplaceUnique(Hash64(5254u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderViewportIndexLayerEXT");
-	m_operandNames.emplaceUnique(Hash64(5254u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderViewportIndexLayerNV");
-	m_operandNames.emplaceUnique(Hash64(5255u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderViewportMaskNV");
-	m_operandNames.emplaceUnique(Hash64(5259u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderStereoViewNV");
-	m_operandNames.emplaceUnique(Hash64(5260u, static_cast<unsigned int>(OperandKind::Capability)),"PerViewAttributesNV");
-	m_operandNames.emplaceUnique(Hash64(5265u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentFullyCoveredEXT");
-	m_operandNames.emplaceUnique(Hash64(5266u, static_cast<unsigned int>(OperandKind::Capability)),"MeshShadingNV");
-	m_operandNames.emplaceUnique(Hash64(5282u, static_cast<unsigned int>(OperandKind::Capability)),"ImageFootprintNV");
-	m_operandNames.emplaceUnique(Hash64(5284u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentBarycentricNV");
-	m_operandNames.emplaceUnique(Hash64(5288u, static_cast<unsigned int>(OperandKind::Capability)),"ComputeDerivativeGroupQuadsNV");
-	m_operandNames.emplaceUnique(Hash64(5291u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentDensityEXT");
-	m_operandNames.emplaceUnique(Hash64(5291u, static_cast<unsigned int>(OperandKind::Capability)),"ShadingRateNV");
-	m_operandNames.emplaceUnique(Hash64(5297u, static_cast<unsigned int>(OperandKind::Capability)),"GroupNonUniformPartitionedNV");
-	m_operandNames.emplaceUnique(Hash64(5301u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderNonUniform");
-	m_operandNames.emplaceUnique(Hash64(5301u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderNonUniformEXT");
-	m_operandNames.emplaceUnique(Hash64(5302u, static_cast<unsigned int>(OperandKind::Capability)),"RuntimeDescriptorArray");
-	m_operandNames.emplaceUnique(Hash64(5302u, static_cast<unsigned int>(OperandKind::Capability)),"RuntimeDescriptorArrayEXT");
-	m_operandNames.emplaceUnique(Hash64(5303u, static_cast<unsigned int>(OperandKind::Capability)),"InputAttachmentArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(5303u, static_cast<unsigned int>(OperandKind::Capability)),"InputAttachmentArrayDynamicIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5304u, static_cast<unsigned int>(OperandKind::Capability)),"UniformTexelBufferArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(5304u, static_cast<unsigned int>(OperandKind::Capability)),"UniformTexelBufferArrayDynamicIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5305u, static_cast<unsigned int>(OperandKind::Capability)),"StorageTexelBufferArrayDynamicIndexing");
-	m_operandNames.emplaceUnique(Hash64(5305u, static_cast<unsigned int>(OperandKind::Capability)),"StorageTexelBufferArrayDynamicIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5306u, static_cast<unsigned int>(OperandKind::Capability)),"UniformBufferArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5306u, static_cast<unsigned int>(OperandKind::Capability)),"UniformBufferArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5307u, static_cast<unsigned int>(OperandKind::Capability)),"SampledImageArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5307u, static_cast<unsigned int>(OperandKind::Capability)),"SampledImageArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5308u, static_cast<unsigned int>(OperandKind::Capability)),"StorageBufferArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5308u, static_cast<unsigned int>(OperandKind::Capability)),"StorageBufferArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5309u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5309u, static_cast<unsigned int>(OperandKind::Capability)),"StorageImageArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5310u, static_cast<unsigned int>(OperandKind::Capability)),"InputAttachmentArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5310u, static_cast<unsigned int>(OperandKind::Capability)),"InputAttachmentArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5311u, static_cast<unsigned int>(OperandKind::Capability)),"UniformTexelBufferArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5311u, static_cast<unsigned int>(OperandKind::Capability)),"UniformTexelBufferArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5312u, static_cast<unsigned int>(OperandKind::Capability)),"StorageTexelBufferArrayNonUniformIndexing");
-	m_operandNames.emplaceUnique(Hash64(5312u, static_cast<unsigned int>(OperandKind::Capability)),"StorageTexelBufferArrayNonUniformIndexingEXT");
-	m_operandNames.emplaceUnique(Hash64(5340u, static_cast<unsigned int>(OperandKind::Capability)),"RayTracingNV");
-	m_operandNames.emplaceUnique(Hash64(5345u, static_cast<unsigned int>(OperandKind::Capability)),"VulkanMemoryModel");
-	m_operandNames.emplaceUnique(Hash64(5345u, static_cast<unsigned int>(OperandKind::Capability)),"VulkanMemoryModelKHR");
-	m_operandNames.emplaceUnique(Hash64(5346u, static_cast<unsigned int>(OperandKind::Capability)),"VulkanMemoryModelDeviceScope");
-	m_operandNames.emplaceUnique(Hash64(5346u, static_cast<unsigned int>(OperandKind::Capability)),"VulkanMemoryModelDeviceScopeKHR");
-	m_operandNames.emplaceUnique(Hash64(5347u, static_cast<unsigned int>(OperandKind::Capability)),"PhysicalStorageBufferAddresses");
-	m_operandNames.emplaceUnique(Hash64(5347u, static_cast<unsigned int>(OperandKind::Capability)),"PhysicalStorageBufferAddressesEXT");
-	m_operandNames.emplaceUnique(Hash64(5350u, static_cast<unsigned int>(OperandKind::Capability)),"ComputeDerivativeGroupLinearNV");
-	m_operandNames.emplaceUnique(Hash64(5353u, static_cast<unsigned int>(OperandKind::Capability)),"RayTracingProvisionalKHR");
-	m_operandNames.emplaceUnique(Hash64(5357u, static_cast<unsigned int>(OperandKind::Capability)),"CooperativeMatrixNV");
-	m_operandNames.emplaceUnique(Hash64(5363u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentShaderSampleInterlockEXT");
-	m_operandNames.emplaceUnique(Hash64(5372u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentShaderShadingRateInterlockEXT");
-	m_operandNames.emplaceUnique(Hash64(5373u, static_cast<unsigned int>(OperandKind::Capability)),"ShaderSMBuiltinsNV");
-	m_operandNames.emplaceUnique(Hash64(5378u, static_cast<unsigned int>(OperandKind::Capability)),"FragmentShaderPixelInterlockEXT");
-	m_operandNames.emplaceUnique(Hash64(5379u, static_cast<unsigned int>(OperandKind::Capability)),"DemoteToHelperInvocationEXT");
-	m_operandNames.emplaceUnique(Hash64(5568u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupShuffleINTEL");
-	m_operandNames.emplaceUnique(Hash64(5569u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupBufferBlockIOINTEL");
-	m_operandNames.emplaceUnique(Hash64(5570u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupImageBlockIOINTEL");
-	m_operandNames.emplaceUnique(Hash64(5579u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupImageMediaBlockIOINTEL");
-	m_operandNames.emplaceUnique(Hash64(5584u, static_cast<unsigned int>(OperandKind::Capability)),"IntegerFunctions2INTEL");
-	m_operandNames.emplaceUnique(Hash64(5603u, static_cast<unsigned int>(OperandKind::Capability)),"FunctionPointersINTEL");
-	m_operandNames.emplaceUnique(Hash64(5604u, static_cast<unsigned int>(OperandKind::Capability)),"IndirectReferencesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5696u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupAvcMotionEstimationINTEL");
-	m_operandNames.emplaceUnique(Hash64(5697u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupAvcMotionEstimationIntraINTEL");
-	m_operandNames.emplaceUnique(Hash64(5698u, static_cast<unsigned int>(OperandKind::Capability)),"SubgroupAvcMotionEstimationChromaINTEL");
-	m_operandNames.emplaceUnique(Hash64(5824u, static_cast<unsigned int>(OperandKind::Capability)),"FPGAMemoryAttributesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5886u, static_cast<unsigned int>(OperandKind::Capability)),"UnstructuredLoopControlsINTEL");
-	m_operandNames.emplaceUnique(Hash64(5888u, static_cast<unsigned int>(OperandKind::Capability)),"FPGALoopControlsINTEL");
-	m_operandNames.emplaceUnique(Hash64(5892u, static_cast<unsigned int>(OperandKind::Capability)),"KernelAttributesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5897u, static_cast<unsigned int>(OperandKind::Capability)),"FPGAKernelAttributesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5945u, static_cast<unsigned int>(OperandKind::Capability)),"BlockingPipesINTEL");
-	m_operandNames.emplaceUnique(Hash64(5948u, static_cast<unsigned int>(OperandKind::Capability)),"FPGARegINTEL");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::RayQueryIntersection)),"RayQueryCandidateIntersectionKHR");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::RayQueryIntersection)),"RayQueryCommittedIntersectionKHR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::RayQueryCommittedIntersectionType)),"RayQueryCommittedIntersectionNoneKHR");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::RayQueryCommittedIntersectionType)),"RayQueryCommittedIntersectionTriangleKHR");
-	m_operandNames.emplaceUnique(Hash64(2u, static_cast<unsigned int>(OperandKind::RayQueryCommittedIntersectionType)),"RayQueryCommittedIntersectionGeneratedKHR");
-	m_operandNames.emplaceUnique(Hash64(0u, static_cast<unsigned int>(OperandKind::RayQueryCandidateIntersectionType)),"RayQueryCandidateIntersectionTriangleKHR");
-	m_operandNames.emplaceUnique(Hash64(1u, static_cast<unsigned int>(OperandKind::RayQueryCandidateIntersectionType)),"RayQueryCandidateIntersectionAABBKHR");
-};
+		unsigned int value;
+		const char* name;
+	};
+
+	constexpr OperandName namesImageOperands[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "Bias" },
+		{ 0x0002u, "Lod" },
+		{ 0x0004u, "Grad" },
+		{ 0x0008u, "ConstOffset" },
+		{ 0x0010u, "Offset" },
+		{ 0x0020u, "ConstOffsets" },
+		{ 0x0040u, "Sample" },
+		{ 0x0080u, "MinLod" },
+		{ 0x0100u, "MakeTexelAvailable" },
+		{ 0x0200u, "MakeTexelVisible" },
+		{ 0x0400u, "NonPrivateTexel" },
+		{ 0x0800u, "VolatileTexel" },
+		{ 0x1000u, "SignExtend" },
+		{ 0x2000u, "ZeroExtend" },
+	};
+	constexpr OperandName namesFPFastMathMode[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "NotNaN" },
+		{ 0x0002u, "NotInf" },
+		{ 0x0004u, "NSZ" },
+		{ 0x0008u, "AllowRecip" },
+		{ 0x0010u, "Fast" },
+	};
+	constexpr OperandName namesSelectionControl[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "Flatten" },
+		{ 0x0002u, "DontFlatten" },
+	};
+	constexpr OperandName namesLoopControl[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "Unroll" },
+		{ 0x0002u, "DontUnroll" },
+		{ 0x0004u, "DependencyInfinite" },
+		{ 0x0008u, "DependencyLength" },
+		{ 0x0010u, "MinIterations" },
+		{ 0x0020u, "MaxIterations" },
+		{ 0x0040u, "IterationMultiple" },
+		{ 0x0080u, "PeelCount" },
+		{ 0x0100u, "PartialCount" },
+		{ 0x10000u, "InitiationIntervalINTEL" },
+		{ 0x20000u, "MaxConcurrencyINTEL" },
+		{ 0x40000u, "DependencyArrayINTEL" },
+		{ 0x80000u, "PipelineEnableINTEL" },
+		{ 0x100000u, "LoopCoalesceINTEL" },
+		{ 0x200000u, "MaxInterleavingINTEL" },
+		{ 0x400000u, "SpeculatedIterationsINTEL" },
+	};
+	constexpr OperandName namesFunctionControl[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "Inline" },
+		{ 0x0002u, "DontInline" },
+		{ 0x0004u, "Pure" },
+		{ 0x0008u, "Const" },
+	};
+	constexpr OperandName namesMemorySemantics[] = {
+		{ 0x0000u, "Relaxed" },
+		{ 0x0002u, "Acquire" },
+		{ 0x0004u, "Release" },
+		{ 0x0008u, "AcquireRelease" },
+		{ 0x0010u, "SequentiallyConsistent" },
+		{ 0x0040u, "UniformMemory" },
+		{ 0x0080u, "SubgroupMemory" },
+		{ 0x0100u, "WorkgroupMemory" },
+		{ 0x0200u, "CrossWorkgroupMemory" },
+		{ 0x0400u, "AtomicCounterMemory" },
+		{ 0x0800u, "ImageMemory" },
+		{ 0x1000u, "OutputMemory" },
+		{ 0x2000u, "MakeAvailable" },
+		{ 0x4000u, "MakeVisible" },
+		{ 0x8000u, "Volatile" },
+	};
+	constexpr OperandName namesMemoryAccess[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "Volatile" },
+		{ 0x0002u, "Aligned" },
+		{ 0x0004u, "Nontemporal" },
+		{ 0x0008u, "MakePointerAvailable" },
+		{ 0x0010u, "MakePointerVisible" },
+		{ 0x0020u, "NonPrivatePointer" },
+	};
+	constexpr OperandName namesKernelProfilingInfo[] = {
+		{ 0x0000u, "None" },
+		{ 0x0001u, "CmdExecTime" },
+	};
+	constexpr OperandName namesRayFlags[] = {
+		{ 0x0000u, "NoneKHR" },
+		{ 0x0001u, "OpaqueKHR" },
+		{ 0x0002u, "NoOpaqueKHR" },
+		{ 0x0004u, "TerminateOnFirstHitKHR" },
+		{ 0x0008u, "SkipClosestHitShaderKHR" },
+		{ 0x0010u, "CullBackFacingTrianglesKHR" },
+		{ 0x0020u, "CullFrontFacingTrianglesKHR" },
+		{ 0x0040u, "CullOpaqueKHR" },
+		{ 0x0080u, "CullNoOpaqueKHR" },
+		{ 0x0100u, "SkipTrianglesKHR" },
+		{ 0x0200u, "SkipAABBsKHR" },
+	};
+	constexpr OperandName namesSourceLanguage[] = {
+		{ 0u, "Unknown" },
+		{ 1u, "ESSL" },
+		{ 2u, "GLSL" },
+		{ 3u, "OpenCL_C" },
+		{ 4u, "OpenCL_CPP" },
+		{ 5u, "HLSL" },
+	};
+	constexpr OperandName namesExecutionModel[] = {
+		{ 0u, "Vertex" },
+		{ 1u, "TessellationControl" },
+		{ 2u, "TessellationEvaluation" },
+		{ 3u, "Geometry" },
+		{ 4u, "Fragment" },
+		{ 5u, "GLCompute" },
+		{ 6u, "Kernel" },
+		{ 5267u, "TaskNV" },
+		{ 5268u, "MeshNV" },
+		{ 5313u, "RayGenerationNV" },
+		{ 5314u, "IntersectionNV" },
+		{ 5315u, "AnyHitNV" },
+		{ 5316u, "ClosestHitNV" },
+		{ 5317u, "MissNV" },
+		{ 5318u, "CallableNV" },
+	};
+	constexpr OperandName namesAddressingModel[] = {
+		{ 0u, "Logical" },
+		{ 1u, "Physical32" },
+		{ 2u, "Physical64" },
+		{ 5348u, "PhysicalStorageBuffer64" },
+	};
+	constexpr OperandName namesMemoryModel[] = {
+		{ 0u, "Simple" },
+		{ 1u, "GLSL450" },
+		{ 2u, "OpenCL" },
+		{ 3u, "Vulkan" },
+	};
+	constexpr OperandName namesExecutionMode[] = {
+		{ 0u, "Invocations" },
+		{ 1u, "SpacingEqual" },
+		{ 2u, "SpacingFractionalEven" },
+		{ 3u, "SpacingFractionalOdd" },
+		{ 4u, "VertexOrderCw" },
+		{ 5u, "VertexOrderCcw" },
+		{ 6u, "PixelCenterInteger" },
+		{ 7u, "OriginUpperLeft" },
+		{ 8u, "OriginLowerLeft" },
+		{ 9u, "EarlyFragmentTests" },
+		{ 10u, "PointMode" },
+		{ 11u, "Xfb" },
+		{ 12u, "DepthReplacing" },
+		{ 14u, "DepthGreater" },
+		{ 15u, "DepthLess" },
+		{ 16u, "DepthUnchanged" },
+		{ 17u, "LocalSize" },
+		{ 18u, "LocalSizeHint" },
+		{ 19u, "InputPoints" },
+		{ 20u, "InputLines" },
+		{ 21u, "InputLinesAdjacency" },
+		{ 22u, "Triangles" },
+		{ 23u, "InputTrianglesAdjacency" },
+		{ 24u, "Quads" },
+		{ 25u, "Isolines" },
+		{ 26u, "OutputVertices" },
+		{ 27u, "OutputPoints" },
+		{ 28u, "OutputLineStrip" },
+		{ 29u, "OutputTriangleStrip" },
+		{ 30u, "VecTypeHint" },
+		{ 31u, "ContractionOff" },
+		{ 33u, "Initializer" },
+		{ 34u, "Finalizer" },
+		{ 35u, "SubgroupSize" },
+		{ 36u, "SubgroupsPerWorkgroup" },
+		{ 37u, "SubgroupsPerWorkgroupId" },
+		{ 38u, "LocalSizeId" },
+		{ 39u, "LocalSizeHintId" },
+		{ 4446u, "PostDepthCoverage" },
+		{ 4459u, "DenormPreserve" },
+		{ 4460u, "DenormFlushToZero" },
+		{ 4461u, "SignedZeroInfNanPreserve" },
+		{ 4462u, "RoundingModeRTE" },
+		{ 4463u, "RoundingModeRTZ" },
+		{ 5027u, "StencilRefReplacingEXT" },
+		{ 5269u, "OutputLinesNV" },
+		{ 5270u, "OutputPrimitivesNV" },
+		{ 5289u, "DerivativeGroupQuadsNV" },
+		{ 5290u, "DerivativeGroupLinearNV" },
+		{ 5298u, "OutputTrianglesNV" },
+		{ 5366u, "PixelInterlockOrderedEXT" },
+		{ 5367u, "PixelInterlockUnorderedEXT" },
+		{ 5368u, "SampleInterlockOrderedEXT" },
+		{ 5369u, "SampleInterlockUnorderedEXT" },
+		{ 5370u, "ShadingRateInterlockOrderedEXT" },
+		{ 5371u, "ShadingRateInterlockUnorderedEXT" },
+		{ 5893u, "MaxWorkgroupSizeINTEL" },
+		{ 5894u, "MaxWorkDimINTEL" },
+		{ 5895u, "NoGlobalOffsetINTEL" },
+		{ 5896u, "NumSIMDWorkitemsINTEL" },
+	};
+	constexpr OperandName namesStorageClass[] = {
+		{ 0u, "UniformConstant" },
+		{ 1u, "Input" },
+		{ 2u, "Uniform" },
+		{ 3u, "Output" },
+		{ 4u, "Workgroup" },
+		{ 5u, "CrossWorkgroup" },
+		{ 6u, "Private" },
+		{ 7u, "Function" },
+		{ 8u, "Generic" },
+		{ 9u, "PushConstant" },
+		{ 10u, "AtomicCounter" },
+		{ 11u, "Image" },
+		{ 12u, "StorageBuffer" },
+		{ 5328u, "CallableDataNV" },
+		{ 5329u, "IncomingCallableDataNV" },
+		{ 5338u, "RayPayloadNV" },
+		{ 5339u, "HitAttributeNV" },
+		{ 5342u, "IncomingRayPayloadNV" },
+		{ 5343u, "ShaderRecordBufferNV" },
+		{ 5349u, "PhysicalStorageBuffer" },
+		{ 5605u, "CodeSectionINTEL" },
+	};
+	constexpr OperandName namesDim[] = {
+		{ 0u, "Dim1D" },
+		{ 1u, "Dim2D" },
+		{ 2u, "Dim3D" },
+		{ 3u, "Cube" },
+		{ 4u, "Rect" },
+		{ 5u, "Buffer" },
+		{ 6u, "SubpassData" },
+	};
+	constexpr OperandName namesSamplerAddressingMode[] = {
+		{ 0u, "None" },
+		{ 1u, "ClampToEdge" },
+		{ 2u, "Clamp" },
+		{ 3u, "Repeat" },
+		{ 4u, "RepeatMirrored" },
+	};
+	constexpr OperandName namesSamplerFilterMode[] = {
+		{ 0u, "Nearest" },
+		{ 1u, "Linear" },
+	};
+	constexpr OperandName namesImageFormat[] = {
+		{ 0u, "Unknown" },
+		{ 1u, "Rgba32f" },
+		{ 2u, "Rgba16f" },
+		{ 3u, "R32f" },
+		{ 4u, "Rgba8" },
+		{ 5u, "Rgba8Snorm" },
+		{ 6u, "Rg32f" },
+		{ 7u, "Rg16f" },
+		{ 8u, "R11fG11fB10f" },
+		{ 9u, "R16f" },
+		{ 10u, "Rgba16" },
+		{ 11u, "Rgb10A2" },
+		{ 12u, "Rg16" },
+		{ 13u, "Rg8" },
+		{ 14u, "R16" },
+		{ 15u, "R8" },
+		{ 16u, "Rgba16Snorm" },
+		{ 17u, "Rg16Snorm" },
+		{ 18u, "Rg8Snorm" },
+		{ 19u, "R16Snorm" },
+		{ 20u, "R8Snorm" },
+		{ 21u, "Rgba32i" },
+		{ 22u, "Rgba16i" },
+		{ 23u, "Rgba8i" },
+		{ 24u, "R32i" },
+		{ 25u, "Rg32i" },
+		{ 26u, "Rg16i" },
+		{ 27u, "Rg8i" },
+		{ 28u, "R16i" },
+		{ 29u, "R8i" },
+		{ 30u, "Rgba32ui" },
+		{ 31u, "Rgba16ui" },
+		{ 32u, "Rgba8ui" },
+		{ 33u, "R32ui" },
+		{ 34u, "Rgb10a2ui" },
+		{ 35u, "Rg32ui" },
+		{ 36u, "Rg16ui" },
+		{ 37u, "Rg8ui" },
+		{ 38u, "R16ui" },
+		{ 39u, "R8ui" },
+	};
+	constexpr OperandName namesImageChannelOrder[] = {
+		{ 0u, "R" },
+		{ 1u, "A" },
+		{ 2u, "RG" },
+		{ 3u, "RA" },
+		{ 4u, "RGB" },
+		{ 5u, "RGBA" },
+		{ 6u, "BGRA" },
+		{ 7u, "ARGB" },
+		{ 8u, "Intensity" },
+		{ 9u, "Luminance" },
+		{ 10u, "Rx" },
+		{ 11u, "RGx" },
+		{ 12u, "RGBx" },
+		{ 13u, "Depth" },
+		{ 14u, "DepthStencil" },
+		{ 15u, "sRGB" },
+		{ 16u, "sRGBx" },
+		{ 17u, "sRGBA" },
+		{ 18u, "sBGRA" },
+		{ 19u, "ABGR" },
+	};
+	constexpr OperandName namesImageChannelDataType[] = {
+		{ 0u, "SnormInt8" },
+		{ 1u, "SnormInt16" },
+		{ 2u, "UnormInt8" },
+		{ 3u, "UnormInt16" },
+		{ 4u, "UnormShort565" },
+		{ 5u, "UnormShort555" },
+		{ 6u, "UnormInt101010" },
+		{ 7u, "SignedInt8" },
+		{ 8u, "SignedInt16" },
+		{ 9u, "SignedInt32" },
+		{ 10u, "UnsignedInt8" },
+		{ 11u, "UnsignedInt16" },
+		{ 12u, "UnsignedInt32" },
+		{ 13u, "HalfFloat" },
+		{ 14u, "Float" },
+		{ 15u, "UnormInt24" },
+		{ 16u, "UnormInt101010_2" },
+	};
+	constexpr OperandName namesFPRoundingMode[] = {
+		{ 0u, "RTE" },
+		{ 1u, "RTZ" },
+		{ 2u, "RTP" },
+		{ 3u, "RTN" },
+	};
+	constexpr OperandName namesLinkageType[] = {
+		{ 0u, "Export" },
+		{ 1u, "Import" },
+	};
+	constexpr OperandName namesAccessQualifier[] = {
+		{ 0u, "ReadOnly" },
+		{ 1u, "WriteOnly" },
+		{ 2u, "ReadWrite" },
+	};
+	constexpr OperandName namesFunctionParameterAttribute[] = {
+		{ 0u, "Zext" },
+		{ 1u, "Sext" },
+		{ 2u, "ByVal" },
+		{ 3u, "Sret" },
+		{ 4u, "NoAlias" },
+		{ 5u, "NoCapture" },
+		{ 6u, "NoWrite" },
+		{ 7u, "NoReadWrite" },
+	};
+	constexpr OperandName namesDecoration[] = {
+		{ 0u, "RelaxedPrecision" },
+		{ 1u, "SpecId" },
+		{ 2u, "Block" },
+		{ 3u, "BufferBlock" },
+		{ 4u, "RowMajor" },
+		{ 5u, "ColMajor" },
+		{ 6u, "ArrayStride" },
+		{ 7u, "MatrixStride" },
+		{ 8u, "GLSLShared" },
+		{ 9u, "GLSLPacked" },
+		{ 10u, "CPacked" },
+		{ 11u, "BuiltIn" },
+		{ 13u, "NoPerspective" },
+		{ 14u, "Flat" },
+		{ 15u, "Patch" },
+		{ 16u, "Centroid" },
+		{ 17u, "Sample" },
+		{ 18u, "Invariant" },
+		{ 19u, "Restrict" },
+		{ 20u, "Aliased" },
+		{ 21u, "Volatile" },
+		{ 22u, "Constant" },
+		{ 23u, "Coherent" },
+		{ 24u, "NonWritable" },
+		{ 25u, "NonReadable" },
+		{ 26u, "Uniform" },
+		{ 27u, "UniformId" },
+		{ 28u, "SaturatedConversion" },
+		{ 29u, "Stream" },
+		{ 30u, "Location" },
+		{ 31u, "Component" },
+		{ 32u, "Index" },
+		{ 33u, "Binding" },
+		{ 34u, "DescriptorSet" },
+		{ 35u, "Offset" },
+		{ 36u, "XfbBuffer" },
+		{ 37u, "XfbStride" },
+		{ 38u, "FuncParamAttr" },
+		{ 39u, "FPRoundingMode" },
+		{ 40u, "FPFastMathMode" },
+		{ 41u, "LinkageAttributes" },
+		{ 42u, "NoContraction" },
+		{ 43u, "InputAttachmentIndex" },
+		{ 44u, "Alignment" },
+		{ 45u, "MaxByteOffset" },
+		{ 46u, "AlignmentId" },
+		{ 47u, "MaxByteOffsetId" },
+		{ 4469u, "NoSignedWrap" },
+		{ 4470u, "NoUnsignedWrap" },
+		{ 4999u, "ExplicitInterpAMD" },
+		{ 5248u, "OverrideCoverageNV" },
+		{ 5250u, "PassthroughNV" },
+		{ 5252u, "ViewportRelativeNV" },
+		{ 5256u, "SecondaryViewportRelativeNV" },
+		{ 5271u, "PerPrimitiveNV" },
+		{ 5272u, "PerViewNV" },
+		{ 5273u, "PerTaskNV" },
+		{ 5285u, "PerVertexNV" },
+		{ 5300u, "NonUniform" },
+		{ 5355u, "RestrictPointer" },
+		{ 5356u, "AliasedPointer" },
+		{ 5602u, "ReferencedIndirectlyINTEL" },
+		{ 5634u, "CounterBuffer" },
+		{ 5635u, "UserSemantic" },
+		{ 5636u, "UserTypeGOOGLE" },
+		{ 5825u, "RegisterINTEL" },
+		{ 5826u, "MemoryINTEL" },
+		{ 5827u, "NumbanksINTEL" },
+		{ 5828u, "BankwidthINTEL" },
+		{ 5829u, "MaxPrivateCopiesINTEL" },
+		{ 5830u, "SinglepumpINTEL" },
+		{ 5831u, "DoublepumpINTEL" },
+		{ 5832u, "MaxReplicatesINTEL" },
+		{ 5833u, "SimpleDualPortINTEL" },
+		{ 5834u, "MergeINTEL" },
+		{ 5835u, "BankBitsINTEL" },
+		{ 5836u, "ForcePow2DepthINTEL" },
+	};
+	constexpr OperandName namesBuiltIn[] = {
+		{ 0u, "Position" },
+		{ 1u, "PointSize" },
+		{ 3u, "ClipDistance" },
+		{ 4u, "CullDistance" },
+		{ 5u, "VertexId" },
+		{ 6u, "InstanceId" },
+		{ 7u, "PrimitiveId" },
+		{ 8u, "InvocationId" },
+		{ 9u, "Layer" },
+		{ 10u, "ViewportIndex" },
+		{ 11u, "TessLevelOuter" },
+		{ 12u, "TessLevelInner" },
+		{ 13u, "TessCoord" },
+		{ 14u, "PatchVertices" },
+		{ 15u, "FragCoord" },
+		{ 16u, "PointCoord" },
+		{ 17u, "FrontFacing" },
+		{ 18u, "SampleId" },
+		{ 19u, "SamplePosition" },
+		{ 20u, "SampleMask" },
+		{ 22u, "FragDepth" },
+		{ 23u, "HelperInvocation" },
+		{ 24u, "NumWorkgroups" },
+		{ 25u, "WorkgroupSize" },
+		{ 26u, "WorkgroupId" },
+		{ 27u, "LocalInvocationId" },
+		{ 28u, "GlobalInvocationId" },
+		{ 29u, "LocalInvocationIndex" },
+		{ 30u, "WorkDim" },
+		{ 31u, "GlobalSize" },
+		{ 32u, "EnqueuedWorkgroupSize" },
+		{ 33u, "GlobalOffset" },
+		{ 34u, "GlobalLinearId" },
+		{ 36u, "SubgroupSize" },
+		{ 37u, "SubgroupMaxSize" },
+		{ 38u, "NumSubgroups" },
+		{ 39u, "NumEnqueuedSubgroups" },
+		{ 40u, "SubgroupId" },
+		{ 41u, "SubgroupLocalInvocationId" },
+		{ 42u, "VertexIndex" },
+		{ 43u, "InstanceIndex" },
+		{ 4416u, "SubgroupEqMask" },
+		{ 4417u, "SubgroupGeMask" },
+		{ 4418u, "SubgroupGtMask" },
+		{ 4419u, "SubgroupLeMask" },
+		{ 4420u, "SubgroupLtMask" },
+		{ 4424u, "BaseVertex" },
+		{ 4425u, "BaseInstance" },
+		{ 4426u, "DrawIndex" },
+		{ 4438u, "DeviceIndex" },
+		{ 4440u, "ViewIndex" },
+		{ 4992u, "BaryCoordNoPerspAMD" },
+		{ 4993u, "BaryCoordNoPerspCentroidAMD" },
+		{ 4994u, "BaryCoordNoPerspSampleAMD" },
+		{ 4995u, "BaryCoordSmoothAMD" },
+		{ 4996u, "BaryCoordSmoothCentroidAMD" },
+		{ 4997u, "BaryCoordSmoothSampleAMD" },
+		{ 4998u, "BaryCoordPullModelAMD" },
+		{ 5014u, "FragStencilRefEXT" },
+		{ 5253u, "ViewportMaskNV" },
+		{ 5257u, "SecondaryPositionNV" },
+		{ 5258u, "SecondaryViewportMaskNV" },
+		{ 5261u, "PositionPerViewNV" },
+		{ 5262u, "ViewportMaskPerViewNV" },
+		{ 5264u, "FullyCoveredEXT" },
+		{ 5274u, "TaskCountNV" },
+		{ 5275u, "PrimitiveCountNV" },
+		{ 5276u, "PrimitiveIndicesNV" },
+		{ 5277u, "ClipDistancePerViewNV" },
+		{ 5278u, "CullDistancePerViewNV" },
+		{ 5279u, "LayerPerViewNV" },
+		{ 5280u, "MeshViewCountNV" },
+		{ 5281u, "MeshViewIndicesNV" },
+		{ 5286u, "BaryCoordNV" },
+		{ 5287u, "BaryCoordNoPerspNV" },
+		{ 5292u, "FragSizeEXT" },
+		{ 5293u, "FragInvocationCountEXT" },
+		{ 5319u, "LaunchIdNV" },
+		{ 5320u, "LaunchSizeNV" },
+		{ 5321u, "WorldRayOriginNV" },
+		{ 5322u, "WorldRayDirectionNV" },
+		{ 5323u, "ObjectRayOriginNV" },
+		{ 5324u, "ObjectRayDirectionNV" },
+		{ 5325u, "RayTminNV" },
+		{ 5326u, "RayTmaxNV" },
+		{ 5327u, "InstanceCustomIndexNV" },
+		{ 5330u, "ObjectToWorldNV" },
+		{ 5331u, "WorldToObjectNV" },
+		{ 5332u, "HitTNV" },
+		{ 5333u, "HitKindNV" },
+		{ 5351u, "IncomingRayFlagsNV" },
+		{ 5352u, "RayGeometryIndexKHR" },
+		{ 5374u, "WarpsPerSMNV" },
+		{ 5375u, "SMCountNV" },
+		{ 5376u, "WarpIDNV" },
+		{ 5377u, "SMIDNV" },
+	};
+	constexpr OperandName namesScope[] = {
+		{ 0u, "CrossDevice" },
+		{ 1u, "Device" },
+		{ 2u, "Workgroup" },
+		{ 3u, "Subgroup" },
+		{ 4u, "Invocation" },
+		{ 5u, "QueueFamily" },
+		{ 6u, "ShaderCallKHR" },
+	};
+	constexpr OperandName namesGroupOperation[] = {
+		{ 0u, "Reduce" },
+		{ 1u, "InclusiveScan" },
+		{ 2u, "ExclusiveScan" },
+		{ 3u, "ClusteredReduce" },
+		{ 6u, "PartitionedReduceNV" },
+		{ 7u, "PartitionedInclusiveScanNV" },
+		{ 8u, "PartitionedExclusiveScanNV" },
+	};
+	constexpr OperandName namesKernelEnqueueFlags[] = {
+		{ 0u, "NoWait" },
+		{ 1u, "WaitKernel" },
+		{ 2u, "WaitWorkGroup" },
+	};
+	constexpr OperandName namesCapability[] = {
+		{ 0u, "Matrix" },
+		{ 1u, "Shader" },
+		{ 2u, "Geometry" },
+		{ 3u, "Tessellation" },
+		{ 4u, "Addresses" },
+		{ 5u, "Linkage" },
+		{ 6u, "Kernel" },
+		{ 7u, "Vector16" },
+		{ 8u, "Float16Buffer" },
+		{ 9u, "Float16" },
+		{ 10u, "Float64" },
+		{ 11u, "Int64" },
+		{ 12u, "Int64Atomics" },
+		{ 13u, "ImageBasic" },
+		{ 14u, "ImageReadWrite" },
+		{ 15u, "ImageMipmap" },
+		{ 17u, "Pipes" },
+		{ 18u, "Groups" },
+		{ 19u, "DeviceEnqueue" },
+		{ 20u, "LiteralSampler" },
+		{ 21u, "AtomicStorage" },
+		{ 22u, "Int16" },
+		{ 23u, "TessellationPointSize" },
+		{ 24u, "GeometryPointSize" },
+		{ 25u, "ImageGatherExtended" },
+		{ 27u, "StorageImageMultisample" },
+		{ 28u, "UniformBufferArrayDynamicIndexing" },
+		{ 29u, "SampledImageArrayDynamicIndexing" },
+		{ 30u, "StorageBufferArrayDynamicIndexing" },
+		{ 31u, "StorageImageArrayDynamicIndexing" },
+		{ 32u, "ClipDistance" },
+		{ 33u, "CullDistance" },
+		{ 34u, "ImageCubeArray" },
+		{ 35u, "SampleRateShading" },
+		{ 36u, "ImageRect" },
+		{ 37u, "SampledRect" },
+		{ 38u, "GenericPointer" },
+		{ 39u, "Int8" },
+		{ 40u, "InputAttachment" },
+		{ 41u, "SparseResidency" },
+		{ 42u, "MinLod" },
+		{ 43u, "Sampled1D" },
+		{ 44u, "Image1D" },
+		{ 45u, "SampledCubeArray" },
+		{ 46u, "SampledBuffer" },
+		{ 47u, "ImageBuffer" },
+		{ 48u, "ImageMSArray" },
+		{ 49u, "StorageImageExtendedFormats" },
+		{ 50u, "ImageQuery" },
+		{ 51u, "DerivativeControl" },
+		{ 52u, "InterpolationFunction" },
+		{ 53u, "TransformFeedback" },
+		{ 54u, "GeometryStreams" },
+		{ 55u, "StorageImageReadWithoutFormat" },
+		{ 56u, "StorageImageWriteWithoutFormat" },
+		{ 57u, "MultiViewport" },
+		{ 58u, "SubgroupDispatch" },
+		{ 59u, "NamedBarrier" },
+		{ 60u, "PipeStorage" },
+		{ 61u, "GroupNonUniform" },
+		{ 62u, "GroupNonUniformVote" },
+		{ 63u, "GroupNonUniformArithmetic" },
+		{ 64u, "GroupNonUniformBallot" },
+		{ 65u, "GroupNonUniformShuffle" },
+		{ 66u, "GroupNonUniformShuffleRelative" },
+		{ 67u, "GroupNonUniformClustered" },
+		{ 68u, "GroupNonUniformQuad" },
+		{ 69u, "ShaderLayer" },
+		{ 70u, "ShaderViewportIndex" },
+		{ 4423u, "SubgroupBallotKHR" },
+		{ 4427u, "DrawParameters" },
+		{ 4431u, "SubgroupVoteKHR" },
+		{ 4433u, "StorageBuffer16BitAccess" },
+		{ 4434u, "UniformAndStorageBuffer16BitAccess" },
+		{ 4435u, "StoragePushConstant16" },
+		{ 4436u, "StorageInputOutput16" },
+		{ 4437u, "DeviceGroup" },
+		{ 4439u, "MultiView" },
+		{ 4441u, "VariablePointersStorageBuffer" },
+		{ 4442u, "VariablePointers" },
+		{ 4445u, "AtomicStorageOps" },
+		{ 4447u, "SampleMaskPostDepthCoverage" },
+		{ 4448u, "StorageBuffer8BitAccess" },
+		{ 4449u, "UniformAndStorageBuffer8BitAccess" },
+		{ 4450u, "StoragePushConstant8" },
+		{ 4464u, "DenormPreserve" },
+		{ 4465u, "DenormFlushToZero" },
+		{ 4466u, "SignedZeroInfNanPreserve" },
+		{ 4467u, "RoundingModeRTE" },
+		{ 4468u, "RoundingModeRTZ" },
+		{ 4471u, "RayQueryProvisionalKHR" },
+		{ 4478u, "RayTraversalPrimitiveCullingProvisionalKHR" },
+		{ 5008u, "Float16ImageAMD" },
+		{ 5009u, "ImageGatherBiasLodAMD" },
+		{ 5010u, "FragmentMaskAMD" },
+		{ 5013u, "StencilExportEXT" },
+		{ 5015u, "ImageReadWriteLodAMD" },
+		{ 5055u, "ShaderClockKHR" },
+		{ 5249u, "SampleMaskOverrideCoverageNV" },
+		{ 5251u, "GeometryShaderPassthroughNV" },
+		{ 5254u, "ShaderViewportIndexLayerEXT" },
+		{ 5255u, "ShaderViewportMaskNV" },
+		{ 5259u, "ShaderStereoViewNV" },
+		{ 5260u, "PerViewAttributesNV" },
+		{ 5265u, "FragmentFullyCoveredEXT" },
+		{ 5266u, "MeshShadingNV" },
+		{ 5282u, "ImageFootprintNV" },
+		{ 5284u, "FragmentBarycentricNV" },
+		{ 5288u, "ComputeDerivativeGroupQuadsNV" },
+		{ 5291u, "FragmentDensityEXT" },
+		{ 5297u, "GroupNonUniformPartitionedNV" },
+		{ 5301u, "ShaderNonUniform" },
+		{ 5302u, "RuntimeDescriptorArray" },
+		{ 5303u, "InputAttachmentArrayDynamicIndexing" },
+		{ 5304u, "UniformTexelBufferArrayDynamicIndexing" },
+		{ 5305u, "StorageTexelBufferArrayDynamicIndexing" },
+		{ 5306u, "UniformBufferArrayNonUniformIndexing" },
+		{ 5307u, "SampledImageArrayNonUniformIndexing" },
+		{ 5308u, "StorageBufferArrayNonUniformIndexing" },
+		{ 5309u, "StorageImageArrayNonUniformIndexing" },
+		{ 5310u, "InputAttachmentArrayNonUniformIndexing" },
+		{ 5311u, "UniformTexelBufferArrayNonUniformIndexing" },
+		{ 5312u, "StorageTexelBufferArrayNonUniformIndexing" },
+		{ 5340u, "RayTracingNV" },
+		{ 5345u, "VulkanMemoryModel" },
+		{ 5346u, "VulkanMemoryModelDeviceScope" },
+		{ 5347u, "PhysicalStorageBufferAddresses" },
+		{ 5350u, "ComputeDerivativeGroupLinearNV" },
+		{ 5353u, "RayTracingProvisionalKHR" },
+		{ 5357u, "CooperativeMatrixNV" },
+		{ 5363u, "FragmentShaderSampleInterlockEXT" },
+		{ 5372u, "FragmentShaderShadingRateInterlockEXT" },
+		{ 5373u, "ShaderSMBuiltinsNV" },
+		{ 5378u, "FragmentShaderPixelInterlockEXT" },
+		{ 5379u, "DemoteToHelperInvocationEXT" },
+		{ 5568u, "SubgroupShuffleINTEL" },
+		{ 5569u, "SubgroupBufferBlockIOINTEL" },
+		{ 5570u, "SubgroupImageBlockIOINTEL" },
+		{ 5579u, "SubgroupImageMediaBlockIOINTEL" },
+		{ 5584u, "IntegerFunctions2INTEL" },
+		{ 5603u, "FunctionPointersINTEL" },
+		{ 5604u, "IndirectReferencesINTEL" },
+		{ 5696u, "SubgroupAvcMotionEstimationINTEL" },
+		{ 5697u, "SubgroupAvcMotionEstimationIntraINTEL" },
+		{ 5698u, "SubgroupAvcMotionEstimationChromaINTEL" },
+		{ 5824u, "FPGAMemoryAttributesINTEL" },
+		{ 5886u, "UnstructuredLoopControlsINTEL" },
+		{ 5888u, "FPGALoopControlsINTEL" },
+		{ 5892u, "KernelAttributesINTEL" },
+		{ 5897u, "FPGAKernelAttributesINTEL" },
+		{ 5945u, "BlockingPipesINTEL" },
+		{ 5948u, "FPGARegINTEL" },
+	};
+	constexpr OperandName namesRayQueryIntersection[] = {
+		{ 0u, "RayQueryCandidateIntersectionKHR" },
+		{ 1u, "RayQueryCommittedIntersectionKHR" },
+	};
+	constexpr OperandName namesRayQueryCommittedIntersectionType[] = {
+		{ 0u, "RayQueryCommittedIntersectionNoneKHR" },
+		{ 1u, "RayQueryCommittedIntersectionTriangleKHR" },
+		{ 2u, "RayQueryCommittedIntersectionGeneratedKHR" },
+	};
+	constexpr OperandName namesRayQueryCandidateIntersectionType[] = {
+		{ 0u, "RayQueryCandidateIntersectionTriangleKHR" },
+		{ 1u, "RayQueryCandidateIntersectionAABBKHR" },
+	};
+
+	// indexed by OperandKind, sorted by value
+	constexpr Grammar::ArrayView<OperandName> operandNames[] = {
+		{ namesImageOperands, 15u }, // ImageOperands
+		{ namesFPFastMathMode, 6u }, // FPFastMathMode
+		{ namesSelectionControl, 3u }, // SelectionControl
+		{ namesLoopControl, 17u }, // LoopControl
+		{ namesFunctionControl, 5u }, // FunctionControl
+		{ namesMemorySemantics, 15u }, // MemorySemantics
+		{ namesMemoryAccess, 7u }, // MemoryAccess
+		{ namesKernelProfilingInfo, 2u }, // KernelProfilingInfo
+		{ namesRayFlags, 11u }, // RayFlags
+		{ namesSourceLanguage, 6u }, // SourceLanguage
+		{ namesExecutionModel, 15u }, // ExecutionModel
+		{ namesAddressingModel, 4u }, // AddressingModel
+		{ namesMemoryModel, 4u }, // MemoryModel
+		{ namesExecutionMode, 60u }, // ExecutionMode
+		{ namesStorageClass, 21u }, // StorageClass
+		{ namesDim, 7u }, // Dim
+		{ namesSamplerAddressingMode, 5u }, // SamplerAddressingMode
+		{ namesSamplerFilterMode, 2u }, // SamplerFilterMode
+		{ namesImageFormat, 40u }, // ImageFormat
+		{ namesImageChannelOrder, 20u }, // ImageChannelOrder
+		{ namesImageChannelDataType, 17u }, // ImageChannelDataType
+		{ namesFPRoundingMode, 4u }, // FPRoundingMode
+		{ namesLinkageType, 2u }, // LinkageType
+		{ namesAccessQualifier, 3u }, // AccessQualifier
+		{ namesFunctionParameterAttribute, 8u }, // FunctionParameterAttribute
+		{ namesDecoration, 77u }, // Decoration
+		{ namesBuiltIn, 96u }, // BuiltIn
+		{ namesScope, 7u }, // Scope
+		{ namesGroupOperation, 7u }, // GroupOperation
+		{ namesKernelEnqueueFlags, 3u }, // KernelEnqueueFlags
+		{ namesCapability, 152u }, // Capability
+		{ namesRayQueryIntersection, 2u }, // RayQueryIntersection
+		{ namesRayQueryCommittedIntersectionType, 3u }, // RayQueryCommittedIntersectionType
+		{ namesRayQueryCandidateIntersectionType, 2u }, // RayQueryCandidateIntersectionType
+		{ nullptr, 0u }, // IdResultType
+		{ nullptr, 0u }, // IdResult
+		{ nullptr, 0u }, // IdMemorySemantics
+		{ nullptr, 0u }, // IdScope
+		{ nullptr, 0u }, // IdRef
+		{ nullptr, 0u }, // LiteralInteger
+		{ nullptr, 0u }, // LiteralString
+		{ nullptr, 0u }, // LiteralContextDependentNumber
+		{ nullptr, 0u }, // LiteralExtInstInteger
+		{ nullptr, 0u }, // LiteralSpecConstantOpInteger
+		{ nullptr, 0u }, // PairLiteralIntegerIdRef
+		{ nullptr, 0u }, // PairIdRefLiteralInteger
+		{ nullptr, 0u }, // PairIdRefIdRef
+	};
+}
+
 const Grammar::Instruction* Grammar::getInfo(unsigned int _opcode, Extension _extension) const
 {
-	return m_instructions.get(Hash64(_opcode, static_cast<unsigned int>(_extension)));
+	unsigned short index = 0u;
+	switch (_extension)
+	{
+	case Extension::Core:
+		index = _opcode < sizeof(coreLookup) / sizeof(coreLookup[0]) ? coreLookup[_opcode] : 0u;
+		break;
+	case Extension::Glsl:
+		index = _opcode < sizeof(glslLookup) / sizeof(glslLookup[0]) ? glslLookup[_opcode] : 0u;
+		break;
+	case Extension::OpenCl:
+		index = _opcode < sizeof(openClLookup) / sizeof(openClLookup[0]) ? openClLookup[_opcode] : 0u;
+		break;
+	default:
+		break;
+	}
+	return index == 0u ? nullptr : &instructions[index - 1u];
 };
 const char* Grammar::getOperandName(OperandKind _kind, unsigned int _literalValue) const
 {
-	const char** name = m_operandNames.get(Hash64(_literalValue, static_cast<unsigned int>(_kind)));
-	return name == nullptr ? nullptr : *name;
-};
+	const unsigned int kind = static_cast<unsigned int>(_kind);
+	if (kind >= sizeof(operandNames) / sizeof(operandNames[0]))
+	{
+		return nullptr;
+	}
+
+	// binary search
+	const OperandName* first = operandNames[kind].begin();
+	unsigned int count = operandNames[kind].size();
+	while (count > 0u)
+	{
+		const unsigned int half = count / 2u;
+		if (first[half].value < _literalValue)
+		{
+			first += half + 1u;
+			count -= half + 1u;
+		}
+		else
+		{
+			count = half;
+		}
+	}
+	return first != operandNames[kind].end() && first->value == _literalValue ? first->name : nullptr;
+};
\ No newline at end of file
@@ -6,9 +6,10 @@
 #include "spvgentwo/Module.h"
 #include "spvgentwo/TypeInferenceAndValiation.h"
 #include "spvgentwo/Grammar.h"
+#include "spvgentwo/ConstantFolding.h"
 
 spvgentwo::Instruction::Instruction(Module* _pModule, Instruction&& _other) noexcept :
-	List(stdrep::move(_other)),
+	OperandContainer(stdrep::move(_other)),
 	m_Operation(_other.m_Operation),
 	m_parentType(ParentType::Module)
 {
@@ -16,7 +17,7 @@ spvgentwo::Instruction::Instruction(Module* _pModule, Instruction&& _other) noex
 }
 
 spvgentwo::Instruction::Instruction(Function* _pFunction, Instruction&& _other) noexcept :
-	List(stdrep::move(_other)),
+	OperandContainer(stdrep::move(_other)),
 	m_Operation(_other.m_Operation),
 	m_parentType(ParentType::Function)
 {
@@ -24,7 +25,7 @@ spvgentwo::Instruction::Instruction(Function* _pFunction, Instruction&& _other)
 }
 
 spvgentwo::Instruction::Instruction(BasicBlock* _pBasicBlock, Instruction&& _other) noexcept :
-	List(stdrep::move(_other)),
+	OperandContainer(stdrep::move(_other)),
 	m_Operation(_other.m_Operation),
 	m_parentType(ParentType::BasicBlock)
 {
@@ -39,7 +40,7 @@ spvgentwo::Instruction& spvgentwo::Instruction::operator=(Instruction&& _other)
 {
 	if (this == &_other) return *this;
 
-	List::operator=(stdrep::move(_other));
+	OperandContainer::operator=(stdrep::move(_other));
 	m_Operation = _other.m_Operation;
 
 	return *this;
@@ -109,13 +110,79 @@ bool spvgentwo::Instruction::getBranchTargets(List<BasicBlock*>& _outTargetBlock
 
 void spvgentwo::Instruction::reset()
 {
+	if (empty() == false && m_parent.pModule != nullptr) // any parent set
+	{
+		if (Module* pModule = getModule(); pModule != nullptr && pModule->isTrackingUses())
+		{
+			pModule->removeUses(this);
+		}
+	}
+
 	m_Operation = spv::Op::OpNop;
 	clear(); // clear operands
 }
 
+void spvgentwo::Instruction::trackUse(const Operand& _operand)
+{
+	if (m_parent.pModule == nullptr || (hasResultType() && &_operand == &front())) // result type is not tracked
+	{
+		return;
+	}
+
+	if (Module* pModule = getModule(); pModule != nullptr && pModule->isTrackingUses())
+	{
+		pModule->addUse(this, _operand);
+	}
+}
+
+void spvgentwo::Instruction::logOperandAllocationFailure() const
+{
+	if (const Module* pModule = getModule(); pModule != nullptr)
+	{
+		pModule->logError("Failed to allocate operand for opcode %u", static_cast<unsigned int>(m_Operation));
+	}
+}
+
+spvgentwo::Instruction* spvgentwo::Instruction::finishOp()
+{
+	inferResultTypeOperand();
+	validateOperands();
+
+	return m_parentType == ParentType::BasicBlock ? simplify() : this;
+}
+
+spvgentwo::Instruction* spvgentwo::Instruction::simplify()
+{
+	Module* pModule = getModule();
+	if (pModule == nullptr || (pModule->isFoldingConstants() == false && pModule->isNumberingValues() == false))
+	{
+		return this;
+	}
+
+	BasicBlock* pBB = m_parent.pBasicBlock;
+	Instruction* pReplacement = pModule->isFoldingConstants() ? foldConstant(*this) : nullptr;
+
+	if (pReplacement == nullptr && pModule->isNumberingValues())
+	{
+		pReplacement = pBB->numberValue(this);
+		if (pReplacement == this)
+		{
+			return this;
+		}
+	}
+
+	// instructions constructed in place are not linked into their block yet and are kept
+	if (pReplacement == nullptr || pBB->remove(this) == false)
+	{
+		return this;
+	}
+
+	return pReplacement; // this was destroyed
+}
+
 unsigned int spvgentwo::Instruction::getWordCount() const
 {
-	return 1u + static_cast<unsigned int>(m_Elements); // (m_elements is number of operands)
+	return 1u + static_cast<unsigned int>(size()); // (size is number of operands)
 }
 
 unsigned int spvgentwo::Instruction::getOpCode() const
@@ -229,12 +296,24 @@ bool spvgentwo::Instruction::isSpecOrConstant() const
 
 void spvgentwo::Instruction::write(IWriter* _pWriter)
 {
-	_pWriter->put(getOpCode());
-	
+	// pass words to the writer in chunks instead of one call per operand
+	constexpr sgt_size_t ChunkSize = 64u;
+	unsigned int words[ChunkSize];
+
+	words[0] = getOpCode();
+	sgt_size_t count = 1u;
+
 	for (const Operand& operand : *this)
 	{
-		operand.write(_pWriter);
+		if (count == ChunkSize)
+		{
+			_pWriter->write(words, count);
+			count = 0u;
+		}
+		words[count++] = operand.getWord();
 	}
+
+	_pWriter->write(words, count);
 }
 
 bool spvgentwo::Instruction::readOperands(IReader* _pReader, const Grammar& _grammar, spv::Op _op, unsigned int _operandCount)
@@ -263,11 +342,28 @@ bool spvgentwo::Instruction::readOperands(IReader* _pReader, const Grammar& _gra
 
 	auto it = info->operands.begin();
 	const auto end = info->operands.end();
-	unsigned int word{ 0u };
+
+	reserve(_operandCount);
+
+	// fetch operand words from the reader in chunks instead of one call per word
+	constexpr unsigned int ChunkSize = 64u;
+	unsigned int words[ChunkSize];
+	unsigned int chunkPos = 0u, chunkLen = 0u;
 
 	bool trailingIDOperands = false;
-	while (_operandCount != 0u && it != end && _pReader->get(word))
+	while (_operandCount != 0u && it != end)
 	{
+		if (chunkPos == chunkLen)
+		{
+			chunkLen = _operandCount < ChunkSize ? _operandCount : ChunkSize;
+			chunkPos = 0u;
+			if (_pReader->read(words, chunkLen) == false)
+			{
+				break;
+			}
+		}
+
+		const unsigned int word = words[chunkPos++];
 		const auto& op = *it;
 
 		if (op.category == Grammar::OperandCategory::Id || trailingIDOperands)
@@ -569,14 +665,14 @@ spvgentwo::Instruction* spvgentwo::Instruction::opFunctionCallDynamic(Instructio
 
 	if (_pResultType->isType() && _pFunction->getOperation() == spv::Op::OpFunction)
 	{
-		makeOp(spv::Op::OpFunctionCall, _pResultType, InvalidId, _pFunction);
+		beginOp(spv::Op::OpFunctionCall, _pResultType, InvalidId, _pFunction);
 
 		for (Instruction* arg : _args)
 		{
 			addOperand(arg);
 		}
 
-		return this;
+		return finishOp();
 	}
 
 	getModule()->logError("_pResultType is not a type instruction or _pFunction is not OpFunction");
@@ -689,7 +785,7 @@ spvgentwo::Instruction* spvgentwo::Instruction::opPhiDynamic(const List<Instruct
 
 	if (type == nullptr) return error();
 
-	makeOp(spv::Op::OpPhi, type, InvalidId);
+	beginOp(spv::Op::OpPhi, type, InvalidId);
 
 	for (auto it = _variables.begin().next(); it != _variables.end(); ++it)
 	{
@@ -704,7 +800,7 @@ spvgentwo::Instruction* spvgentwo::Instruction::opPhiDynamic(const List<Instruct
 		addOperand(var->getBasicBlock());
 	}
 
-	return this;
+	return finishOp();
 }
 
 void spvgentwo::Instruction::opSelectionMerge(BasicBlock* _pMergeBlock, const spv::SelectionControlMask _control)
@@ -766,14 +862,14 @@ spvgentwo::Instruction* spvgentwo::Instruction::opAccessChain(Instruction* _pBas
 
 		Instruction* pResultType = pModule->addType(it->wrapPointer(pBaseType->getStorageClass()));
 
-		makeOp(spv::Op::OpAccessChain, pResultType, InvalidId, _pBase);
+		beginOp(spv::Op::OpAccessChain, pResultType, InvalidId, _pBase);
 		
 		for (auto i : _indices) 
 		{
 			addOperand(pModule->constant(i));
 		}
 
-		return this;
+		return finishOp();
 	}
 
 	getModule()->logError("Failed to deduct composite type of base operand for OpAccessChain");
@@ -857,14 +953,14 @@ spvgentwo::Instruction* spvgentwo::Instruction::opCompositeConstructDynamic(Inst
 		return error();
 	}
 
-	makeOp(spv::Op::OpCompositeConstruct, _pResultType, InvalidId);
+	beginOp(spv::Op::OpCompositeConstruct, _pResultType, InvalidId);
 
 	for (Instruction* constituent : _constituents)
 	{
 		addOperand(constituent);
 	}
 
-	return this;
+	return finishOp();
 }
 
 spvgentwo::Instruction* spvgentwo::Instruction::opCompositeExtractDynamic(Instruction* _pComposite, const List<unsigned int>& _indices)
@@ -890,14 +986,14 @@ spvgentwo::Instruction* spvgentwo::Instruction::opCompositeExtractDynamic(Instru
 	if (it != nullptr)
 	{
 		Instruction* pResultType = pModule->addType(*it);
-		makeOp(spv::Op::OpCompositeExtract, pResultType, InvalidId, _pComposite);
+		beginOp(spv::Op::OpCompositeExtract, pResultType, InvalidId, _pComposite);
 
 		for (auto i : _indices)
 		{
 			addOperand(literal_t{ i });
 		}
 
-		return this;
+		return finishOp();
 	}
 
 	pModule->logError("Invalid index sequence specified for composite type extraction");
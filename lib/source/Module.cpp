@@ -2,6 +2,11 @@
 #include "spvgentwo/Writer.h"
 #include "spvgentwo/Reader.h"
 #include "spvgentwo/Logger.h"
+#include "spvgentwo/TaskExecutor.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 spvgentwo::Module::Module(IAllocator* _pAllocator, const unsigned int _spvVersion, ILogger* _pLogger, ITypeInferenceAndVailation* _pTypeInferenceAndVailation) :
 	Module(_pAllocator, _spvVersion, spv::AddressingModel::Logical, spv::MemoryModel::Simple, _pLogger, _pTypeInferenceAndVailation) // use delegate constructor
@@ -26,11 +31,17 @@ spvgentwo::Module::Module(IAllocator* _pAllocator, const unsigned int _spvVersio
 	m_ModuleProccessed(_pAllocator),
 	m_Decorations(_pAllocator),
 	m_TypesAndConstants(_pAllocator),
-	m_TypeToInstr(_pAllocator),
 	m_InstrToType(_pAllocator),
+	m_TypeNodes(_pAllocator),
 	m_ConstantToInstr(_pAllocator),
 	m_InstrToConstant(_pAllocator),
+	m_TypeCache(_pAllocator),
+	m_ScalarConstantCache(_pAllocator),
 	m_NameLookup(_pAllocator),
+	m_IdToInstr(_pAllocator),
+	m_SparseIdToInstr(_pAllocator),
+	m_Uses(_pAllocator),
+	m_UseEntries(_pAllocator),
 	m_GlobalVariables(_pAllocator),
 	m_Undefs(_pAllocator),
 	m_Lines(_pAllocator),
@@ -57,11 +68,20 @@ spvgentwo::Module::Module(Module&& _other) noexcept:
 	m_ModuleProccessed(stdrep::move(_other.m_ModuleProccessed)),
 	m_Decorations(stdrep::move(_other.m_Decorations)),
 	m_TypesAndConstants(stdrep::move(_other.m_TypesAndConstants)),
-	m_TypeToInstr(stdrep::move(_other.m_TypeToInstr)),
 	m_InstrToType(stdrep::move(_other.m_InstrToType)),
+	m_TypeNodes(stdrep::move(_other.m_TypeNodes)),
 	m_ConstantToInstr(stdrep::move(_other.m_ConstantToInstr)),
 	m_InstrToConstant(stdrep::move(_other.m_InstrToConstant)),
+	m_TypeCache(stdrep::move(_other.m_TypeCache)),
+	m_ScalarConstantCache(stdrep::move(_other.m_ScalarConstantCache)),
 	m_NameLookup(stdrep::move(_other.m_NameLookup)),
+	m_IdToInstr(stdrep::move(_other.m_IdToInstr)),
+	m_SparseIdToInstr(stdrep::move(_other.m_SparseIdToInstr)),
+	m_Uses(stdrep::move(_other.m_Uses)),
+	m_UseEntries(stdrep::move(_other.m_UseEntries)),
+	m_trackUses(_other.m_trackUses),
+	m_foldConstants(_other.m_foldConstants),
+	m_numberValues(_other.m_numberValues),
 	m_GlobalVariables(stdrep::move(_other.m_GlobalVariables)),
 	m_Undefs(stdrep::move(_other.m_Undefs)),
 	m_Lines(stdrep::move(_other.m_Lines)),
@@ -91,10 +111,19 @@ spvgentwo::Module& spvgentwo::Module::operator=(Module&& _other) noexcept
 	m_ModuleProccessed = stdrep::move(_other.m_ModuleProccessed);
 	m_Decorations = stdrep::move(_other.m_Decorations);
 	m_TypesAndConstants = stdrep::move(_other.m_TypesAndConstants);
-	m_TypeToInstr = stdrep::move(_other.m_TypeToInstr);
 	m_InstrToType = stdrep::move(_other.m_InstrToType);
+	m_TypeNodes = stdrep::move(_other.m_TypeNodes);
 	m_ConstantToInstr = stdrep::move(_other.m_ConstantToInstr);
 	m_InstrToConstant= stdrep::move(_other.m_InstrToConstant);
+	m_TypeCache = stdrep::move(_other.m_TypeCache);
+	m_ScalarConstantCache = stdrep::move(_other.m_ScalarConstantCache);
+	m_IdToInstr = stdrep::move(_other.m_IdToInstr);
+	m_SparseIdToInstr = stdrep::move(_other.m_SparseIdToInstr);
+	m_Uses = stdrep::move(_other.m_Uses);
+	m_UseEntries = stdrep::move(_other.m_UseEntries);
+	m_trackUses = _other.m_trackUses;
+	m_foldConstants = _other.m_foldConstants;
+	m_numberValues = _other.m_numberValues;
 	m_GlobalVariables = stdrep::move(_other.m_GlobalVariables);
 	m_Undefs = stdrep::move(_other.m_Undefs);
 	m_Lines = stdrep::move(_other.m_Lines);
@@ -148,6 +177,9 @@ spvgentwo::Module::~Module()
 
 void spvgentwo::Module::reset()
 {
+	m_Uses.clear(); // keep m_trackUses enabled
+	m_UseEntries.clear();
+
 	m_Functions.clear();
 	m_EntryPoints.clear();
 
@@ -164,12 +196,15 @@ void spvgentwo::Module::reset()
 
 	m_TypesAndConstants.clear();
 
-	m_TypeToInstr.clear();
 	m_InstrToType.clear();
+	m_TypeNodes.clear();
+	clearTypeCaches();
 	m_ConstantToInstr.clear();
 	m_InstrToConstant.clear();
 
 	m_NameLookup.clear();
+	m_IdToInstr.clear();
+	m_SparseIdToInstr.clear();
 
 	m_GlobalVariables.clear();
 	m_Undefs.clear();
@@ -193,12 +228,36 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Module::remove(const Functio
 	const Instruction* opFunction = _pFunction->getFunction();
 	Instruction* opFunctionReplacement = _pReplacementToCall != nullptr ? _pReplacementToCall->getFunction() : nullptr;
 
+	// must be called before the function is erased
+	auto removeLookups = [this, opFunction, opFunctionReplacement, &uses](const Function& _func)
+	{
+		for (const Instruction& param : _func.getParameters())
+		{
+			removeFromLookupMaps(&param);
+		}
+		for (const BasicBlock& bb : _func)
+		{
+			removeFromLookupMaps(bb.getLabel());
+			for (const Instruction& instr : bb)
+			{
+				removeFromLookupMaps(&instr);
+			}
+		}
+
+		// only uses outside of the function remain
+		const Operand replacement(opFunctionReplacement);
+		gatherTrackedUses(opFunction, &uses, &replacement);
+
+		removeFromLookupMaps(opFunction);
+	};
+
 	// remove from functions if its not an entry point
 	bool found = false;
 	for (auto it = m_Functions.begin(), end = m_Functions.end(); it != end; ++it)
 	{
 		if (it.operator->() == _pFunction)
 		{
+			removeLookups(*it);
 			m_Functions.erase(it);
 			found = true;
 			break;
@@ -212,6 +271,12 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Module::remove(const Functio
 		{
 			if (it.operator->() == _pFunction)
 			{
+				removeFromLookupMaps(it->getEntryPoint());
+				for (const Instruction& mode : it->getExecutionModes())
+				{
+					removeFromLookupMaps(&mode);
+				}
+				removeLookups(*it);
 				m_EntryPoints.erase(it);
 				found = true;
 				break;
@@ -219,7 +284,7 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Module::remove(const Functio
 		}
 	}
 
-	if (found)
+	if (found && m_trackUses == false)
 	{
 		auto gatherUse = [opFunction, opFunctionReplacement, &uses](Instruction& instr)
 		{
@@ -236,7 +301,7 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Module::remove(const Functio
 
 		iterateInstructions(gatherUse);
 	}
-	else
+	else if (found == false)
 	{
 		logError("Could not remove function, not found in module");
 	}
@@ -244,6 +309,373 @@ spvgentwo::List<spvgentwo::Instruction*> spvgentwo::Module::remove(const Functio
 	return uses;
 }
 
+unsigned int spvgentwo::Module::removeDeadCode()
+{
+	HashMap<const Instruction*, bool> live(m_pAllocator);
+	Vector<const Instruction*> worklist(m_pAllocator);
+
+	auto mark = [&live, &worklist](const Instruction* _pInstr)
+	{
+		if (_pInstr != nullptr && live.get(_pInstr) == nullptr)
+		{
+			live.emplaceUnique(_pInstr, true);
+			worklist.emplace_back(_pInstr);
+		}
+	};
+
+	auto isLive = [&live](const Operand& _target) -> bool
+	{
+		// keep instructions with unresolved targets
+		return _target.isInstruction() == false || live.get(static_cast<const Instruction*>(_target.getInstruction())) != nullptr;
+	};
+
+	auto markFunction = [&mark](const Function& _func)
+	{
+		mark(_func.getFunction());
+		mark(_func.getFunctionEnd());
+		for (const Instruction& param : _func.getParameters())
+		{
+			mark(&param);
+		}
+		for (const BasicBlock& bb : _func)
+		{
+			mark(bb.getLabel());
+			for (const Instruction& instr : bb)
+			{
+				mark(&instr);
+			}
+		}
+	};
+
+	// roots: entry points and symbols exported for linkage
+	for (const EntryPoint& ep : m_EntryPoints)
+	{
+		mark(ep.getEntryPoint());
+		markFunction(ep);
+		for (const Instruction& mode : ep.getExecutionModes())
+		{
+			mark(&mode);
+		}
+	}
+
+	for (const Instruction& deco : m_Decorations)
+	{
+		if (isExportDecoration(deco))
+		{
+			mark(deco.front().getInstruction());
+		}
+	}
+
+	// decorations of live targets can reference further instructions (OpDecorateId), iterate until nothing new is reached
+	for (bool marked = true; marked;)
+	{
+		for (sgt_size_t i = 0u; i < worklist.size(); ++i)
+		{
+			const Instruction* pInstr = worklist[i];
+
+			if (pInstr->getOperation() == spv::Op::OpFunction && pInstr->getFunction() != nullptr)
+			{
+				markFunction(*pInstr->getFunction());
+			}
+
+			for (const Operand& op : *pInstr)
+			{
+				mark(op.getInstruction());
+			}
+		}
+		worklist.clear();
+
+		marked = false;
+		for (const Instruction& deco : m_Decorations)
+		{
+			if (live.get(&deco) == nullptr && deco.empty() == false && isLive(deco.front()))
+			{
+				mark(&deco);
+				marked = true;
+			}
+		}
+	}
+
+	unsigned int removed = 0u;
+
+	for (auto it = m_Functions.begin(); it != m_Functions.end();)
+	{
+		if (live.get(static_cast<const Instruction*>(it->getFunction())) != nullptr)
+		{
+			++it;
+			continue;
+		}
+
+		for (const Instruction& param : it->getParameters())
+		{
+			removeFromLookupMaps(&param);
+		}
+		for (const BasicBlock& bb : *it)
+		{
+			removeFromLookupMaps(bb.getLabel());
+			for (const Instruction& instr : bb)
+			{
+				removeFromLookupMaps(&instr);
+			}
+		}
+		removeFromLookupMaps(it->getFunction());
+		removeFromLookupMaps(it->getFunctionEnd());
+
+		it = m_Functions.erase(it);
+		++removed;
+	}
+
+	auto sweep = [this, &removed](List<Instruction>& _container, const auto& _keep)
+	{
+		for (auto it = _container.begin(); it != _container.end();)
+		{
+			if (_keep(*it))
+			{
+				++it;
+			}
+			else
+			{
+				removeFromLookupMaps(it.operator->());
+				it = _container.erase(it);
+				++removed;
+			}
+		}
+	};
+
+	auto keepLive = [&live](const Instruction& _instr) { return live.get(&_instr) != nullptr; };
+	auto keepLiveTarget = [&isLive](const Instruction& _instr) { return _instr.empty() || isLive(_instr.front()); };
+
+	sweep(m_Names, keepLiveTarget);
+	sweep(m_Decorations, keepLive);
+	sweep(m_GlobalVariables, keepLive);
+	sweep(m_Undefs, keepLive);
+	sweep(m_TypesAndConstants, [&keepLive, &keepLiveTarget](const Instruction& _instr)
+	{
+		// forward declaration of a live pointer type
+		return _instr.getOperation() == spv::Op::OpTypeForwardPointer ? keepLiveTarget(_instr) : keepLive(_instr);
+	});
+
+	return removed;
+}
+
+unsigned int spvgentwo::Module::inlineFunctions(const unsigned int _maxInstructions)
+{
+	HashMap<const Function*, bool> inlined(m_pAllocator);
+	unsigned int count = 0u;
+
+	// call graph, functions calling themselves (through other functions) are not inlined as the cloned calls would be inlined forever
+	HashMap<const Function*, List<const Function*>> callees(m_pAllocator);
+	auto gatherCallees = [this, &callees](const Function& _func)
+	{
+		auto* pCalls = callees.emplaceUnique(&_func, m_pAllocator);
+		if (pCalls == nullptr)
+		{
+			return;
+		}
+		List<const Function*>& calls = pCalls->kv.value;
+		for (const BasicBlock& bb : _func)
+		{
+			for (const Instruction& instr : bb)
+			{
+				if (const Instruction* pOpFunction = instr == spv::Op::OpFunctionCall ? instr.getFirstActualOperand()->getInstruction() : nullptr; pOpFunction != nullptr && pOpFunction->getFunction() != nullptr)
+				{
+					calls.emplace_back(pOpFunction->getFunction());
+				}
+			}
+		}
+	};
+
+	for (const Function& func : m_Functions)
+	{
+		gatherCallees(func);
+	}
+	for (const EntryPoint& ep : m_EntryPoints)
+	{
+		gatherCallees(ep);
+	}
+
+	HashMap<const Function*, bool> recursive(m_pAllocator);
+	{
+		HashMap<const Function*, bool> visited(m_pAllocator);
+		Vector<const Function*> worklist(m_pAllocator);
+
+		for (const auto& [pFunc, calls] : callees)
+		{
+			if (calls.empty())
+			{
+				continue;
+			}
+
+			visited.clear();
+			worklist.reset();
+			worklist.emplace_back(pFunc);
+
+			while (worklist.empty() == false && recursive.get(pFunc) == nullptr)
+			{
+				const List<const Function*>* pCalls = callees.get(worklist.back());
+				worklist.reset(worklist.size() - 1u);
+
+				if (pCalls == nullptr)
+				{
+					continue;
+				}
+
+				for (const Function* pCallee : *pCalls)
+				{
+					if (pCallee == pFunc)
+					{
+						recursive.emplaceUnique(pFunc, true);
+						break;
+					}
+					if (visited.get(pCallee) == nullptr)
+					{
+						visited.emplaceUnique(pCallee, true);
+						worklist.emplace_back(pCallee);
+					}
+				}
+			}
+		}
+	}
+
+	auto inlineCalls = [&](Function& _caller)
+	{
+		// blocks cloned into _caller are visited next, inlining their calls too
+		for (BasicBlock& bb : _caller)
+		{
+			for (Instruction& instr : bb)
+			{
+				if (instr != spv::Op::OpFunctionCall)
+				{
+					continue;
+				}
+
+				const Instruction* pOpFunction = instr.getFirstActualOperand()->getInstruction();
+				const Function* pCallee = pOpFunction != nullptr ? pOpFunction->getFunction() : nullptr;
+				if (pCallee == nullptr || recursive.get(pCallee) != nullptr)
+				{
+					continue;
+				}
+
+				sgt_size_t size = 0u;
+				for (const BasicBlock& calleeBB : *pCallee)
+				{
+					size += calleeBB.size();
+				}
+
+				if (size <= _maxInstructions && _caller.inlineCall(&instr))
+				{
+					inlined.emplaceUnique(pCallee, true);
+					++count;
+					break; // the remaining instructions were moved to the next block
+				}
+			}
+		}
+	};
+
+	for (Function& func : m_Functions)
+	{
+		inlineCalls(func);
+	}
+	for (EntryPoint& ep : m_EntryPoints)
+	{
+		inlineCalls(ep);
+	}
+
+	if (count == 0u)
+	{
+		return count;
+	}
+
+	// OpFunctions still referenced by calls (or other instructions) or exported
+	HashMap<const Instruction*, bool> referenced(m_pAllocator);
+	auto gatherReferences = [&referenced](const Function& _func)
+	{
+		for (const BasicBlock& bb : _func)
+		{
+			for (const Instruction& instr : bb)
+			{
+				for (const Operand& op : instr)
+				{
+					if (const Instruction* pInstr = op.getInstruction(); pInstr != nullptr && *pInstr == spv::Op::OpFunction)
+					{
+						referenced.emplaceUnique(pInstr, true);
+					}
+				}
+			}
+		}
+	};
+
+	for (const Function& func : m_Functions)
+	{
+		gatherReferences(func);
+	}
+	for (const EntryPoint& ep : m_EntryPoints)
+	{
+		gatherReferences(ep);
+	}
+	for (const Instruction& deco : m_Decorations)
+	{
+		if (isExportDecoration(deco))
+		{
+			referenced.emplaceUnique(static_cast<const Instruction*>(deco.front().getInstruction()), true);
+		}
+	}
+
+	auto isDropped = [&inlined, &referenced](const Function* _pFunc) -> bool
+	{
+		return _pFunc != nullptr && inlined.get(_pFunc) != nullptr && referenced.get(_pFunc->getFunction()) == nullptr;
+	};
+
+	// names and decorations of the dropped functions instructions
+	auto sweep = [this, &isDropped](List<Instruction>& _container)
+	{
+		for (auto it = _container.begin(); it != _container.end();)
+		{
+			const Instruction* pTarget = it->empty() ? nullptr : it->front().getInstruction();
+			if (pTarget != nullptr && isDropped(pTarget->getFunction()))
+			{
+				removeFromLookupMaps(it.operator->());
+				it = _container.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	};
+
+	sweep(m_Names);
+	sweep(m_Decorations);
+
+	for (auto it = m_Functions.begin(); it != m_Functions.end();)
+	{
+		if (isDropped(it.operator->()) == false)
+		{
+			++it;
+			continue;
+		}
+
+		for (const Instruction& param : it->getParameters())
+		{
+			removeFromLookupMaps(&param);
+		}
+		for (const BasicBlock& bb : *it)
+		{
+			removeFromLookupMaps(bb.getLabel());
+			for (const Instruction& instr : bb)
+			{
+				removeFromLookupMaps(&instr);
+			}
+		}
+		removeFromLookupMaps(it->getFunction());
+		removeFromLookupMaps(it->getFunctionEnd());
+
+		it = m_Functions.erase(it);
+	}
+
+	return count;
+}
+
 spvgentwo::EntryPoint& spvgentwo::Module::addEntryPoint()
 {
 	return m_EntryPoints.emplace_back(this);
@@ -299,7 +731,14 @@ void spvgentwo::Module::addExtension(const char* _pExtName)
 
 spvgentwo::Instruction* spvgentwo::Module::getExtensionInstructionImport(const char* _pExtName)
 {
-	Instruction& opExtInst = m_ExtInstrImport.emplaceUnique(_pExtName, this).kv.value;
+	auto* pNode = m_ExtInstrImport.emplaceUnique(_pExtName, this);
+	if (pNode == nullptr)
+	{
+		logError("Failed to allocate OpExtInstImport %s", _pExtName);
+		return getErrorInstr();
+	}
+
+	Instruction& opExtInst = pNode->kv.value;
 	if (opExtInst.empty())
 	{
 		opExtInst.opExtInstImport(_pExtName);
@@ -370,24 +809,47 @@ spvgentwo::Instruction* spvgentwo::Module::addDecorationInstr()
 
 spvgentwo::Instruction* spvgentwo::Module::addConstant(const Constant& _const, const char* _pName)
 {
-	auto& node = m_ConstantToInstr.emplaceUnique(_const, nullptr);
-	if (node.kv.value != nullptr)
+	if (_const.getType().isVoid())
+	{
+		logError("Constant has no type, constituents could not be allocated");
+		return getErrorInstr();
+	}
+
+	auto* pNode = m_ConstantToInstr.emplaceUnique(_const, nullptr);
+	if (pNode == nullptr)
+	{
+		logError("Failed to allocate constant lookup entry");
+		return getErrorInstr();
+	}
+	else if (pNode->kv.value != nullptr)
+	{
+		return pNode->kv.value;
+	}
+
+	Instruction* pInstr = addConstantInstr(*pNode, addType(_const.getType()));
+
+	if (_pName != nullptr)
 	{
-		return node.kv.value;
+		addName(pInstr, _pName);
 	}
 
-	Instruction* pType = addType(_const.getType());
+	return pInstr;
+}
+
+spvgentwo::Instruction* spvgentwo::Module::addConstantInstr(HashMap<Constant, Instruction*>::Node& _node, Instruction* _pType)
+{
+	const Constant& _const = _node.kv.key;
 
 	auto entry = Entry<Instruction>::create(m_pAllocator, this);
 
-	Instruction* pInstr = node.kv.value = entry->operator->();
+	Instruction* pInstr = _node.kv.value = entry->operator->();
 
-	m_InstrToConstant.emplaceUnique(pInstr, &node.kv.key);
+	m_InstrToConstant.emplaceUnique(pInstr, &_const);
 
 	const spv::Op constantOp = _const.getOperation();
 	pInstr->setOperation(constantOp);
 
-	pInstr->addOperand(pType);
+	pInstr->addOperand(_pType);
 	pInstr->addOperand(InvalidId);
 
 	switch (constantOp)
@@ -409,10 +871,7 @@ spvgentwo::Instruction* spvgentwo::Module::addConstant(const Constant& _const, c
 		break;
 	case spv::Op::OpConstantComposite:
 	case spv::Op::OpSpecConstantComposite:
-		for(const Constant& component : _const.getComponents())
-		{
-			pInstr->addOperand(addConstant(component));		
-		}
+		addConstituents(*pInstr, _const.getComponents());
 		break;
 	case spv::Op::OpSpecConstantOp:
 		logFatal("OpSpecConstantOp not supported by Module::constant() or addConstant(), use Instruction::toSpecOp or opSpecConstantOp()");
@@ -427,12 +886,44 @@ spvgentwo::Instruction* spvgentwo::Module::addConstant(const Constant& _const, c
 
 	m_TypesAndConstants.append_entry(entry);
 
-	if (_pName != nullptr)
+	return pInstr;
+}
+
+void spvgentwo::Module::addConstituents(Instruction& _composite, const Vector<Constant>& _components)
+{
+	const unsigned int count = static_cast<unsigned int>(_components.size());
+
+	// presize for the worst case of all constituents being new
+	m_ConstantToInstr.reserve(m_ConstantToInstr.elements() + count);
+	m_InstrToConstant.reserve(m_InstrToConstant.elements() + count);
+
+	// constituents of arrays and vectors share their type, only look it up when it changes
+	const Type* pPrevType = nullptr;
+	Instruction* pType = nullptr;
+
+	for (const Constant& component : _components)
 	{
-		addName(pInstr, _pName);
-	}
+		auto* pNode = m_ConstantToInstr.emplaceUnique(component, nullptr);
 
-	return pInstr;
+		if (pNode == nullptr)
+		{
+			logError("Failed to allocate constant lookup entry");
+			_composite.addOperand(getErrorInstr());
+			continue;
+		}
+		else if (pNode->kv.value == nullptr)
+		{
+			if (pPrevType == nullptr || *pPrevType != component.getType())
+			{
+				pPrevType = &component.getType();
+				pType = addType(component.getType());
+			}
+
+			addConstantInstr(*pNode, pType);
+		}
+
+		_composite.addOperand(pNode->kv.value);
+	}
 }
 
 const spvgentwo::Constant* spvgentwo::Module::getConstantInfo(const Instruction* _pConstantInstr)
@@ -451,19 +942,93 @@ const spvgentwo::Constant* spvgentwo::Module::getConstantInfo(const Instruction*
 
 spvgentwo::Instruction* spvgentwo::Module::addType(const Type& _type, const char* _pName)
 {
-	auto& node = m_TypeToInstr.emplaceUnique(_type, nullptr);
-	if (node.kv.value != nullptr)
-	{
-		return node.kv.value;
-	}
+	const TypeNode* pNode = internType(_type, _pName);
+	return pNode != nullptr ? pNode->getInstruction() : nullptr;
+}
 
-	auto entry = Entry<Instruction>::create(m_pAllocator, this);
+const spvgentwo::TypeNode* spvgentwo::Module::internType(const Type& _type, const char* _pName)
+{
+	SmallVector<const TypeNode*, 4u> subTypes(m_pAllocator);
+
+	for (const Type& sub : _type.getSubTypes())
+	{
+		const TypeNode* pSub = internType(sub);
+		if (pSub == nullptr)
+		{
+			return nullptr;
+		}
+		subTypes.emplace_back(pSub);
+	}
+
+	return internType(_type, subTypes.data(), static_cast<unsigned int>(subTypes.size()), _pName);
+}
+
+const spvgentwo::TypeNode* spvgentwo::Module::internType(const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count, const char* _pName)
+{
+	const Hash64 h = TypeNode::hash(_type, _pSubTypes, _count);
+
+	TypeNode* pNode = findTypeNode(h, _type, _pSubTypes, _count);
+
+	if (pNode == nullptr)
+	{
+		// new type, the builder facing Type holds a copy of the sub types
+		Type type(m_pAllocator);
+		type = _type;
+
+		if (_type.getSubTypes().size() != _count)
+		{
+			type.getSubTypes().clear();
+			for (unsigned int i = 0u; i < _count; ++i)
+			{
+				type.getSubTypes().emplace_back(_pSubTypes[i]->getType());
+			}
+		}
+
+		pNode = emplaceTypeNode(h, stdrep::move(type), nullptr, _pSubTypes, _count);
+		if (pNode == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	if (pNode->getInstruction() == nullptr && declareType(*pNode) != nullptr && _pName != nullptr)
+	{
+		addName(pNode->getInstruction(), _pName);
+	}
+
+	return pNode;
+}
+
+spvgentwo::Instruction* spvgentwo::Module::addType(const TypeNode* _pNode)
+{
+	if (_pNode == nullptr)
+	{
+		return nullptr;
+	}
+
+	return _pNode->getInstruction() != nullptr ? _pNode->getInstruction() : declareType(*const_cast<TypeNode*>(_pNode));
+}
+
+spvgentwo::Instruction* spvgentwo::Module::declareType(TypeNode& _node)
+{
+	const Type& type = _node.getType();
+	const unsigned int count = static_cast<unsigned int>(_node.getSubTypes().size());
+	const TypeNode* const* pSubTypes = _node.getSubTypes().data();
+
+	// sub types are declared first
+	for (const TypeNode* pSub : _node.getSubTypes())
+	{
+		if (pSub != nullptr && pSub->getInstruction() == nullptr && declareType(*const_cast<TypeNode*>(pSub)) == nullptr)
+		{
+			return nullptr;
+		}
+	}
 
-	Instruction* pInstr = node.kv.value = entry->operator->();
+	auto instr = Entry<Instruction>::create(m_pAllocator, this);
 
-	m_InstrToType.emplaceUnique(pInstr, &node.kv.key);
+	Instruction* pInstr = instr->operator->();
 
-	const spv::Op base = _type.getType();
+	const spv::Op base = type.getType();
 
 	pInstr->setOperation(base);
 
@@ -472,6 +1037,8 @@ spvgentwo::Instruction* spvgentwo::Module::addType(const Type& _type, const char
 		pInstr->addOperand(InvalidId);
 	}
 
+	Instruction* pSub = count != 0u && pSubTypes[0] != nullptr ? pSubTypes[0]->getInstruction() : nullptr;
+
 	switch (base)
 	{
 	case spv::Op::OpTypeVoid:
@@ -485,50 +1052,50 @@ spvgentwo::Instruction* spvgentwo::Module::addType(const Type& _type, const char
 	case spv::Op::OpTypeNamedBarrier:
 		break; // nothing to do
 	case spv::Op::OpTypeInt:
-		pInstr->appendLiterals(_type.getIntWidth(), (unsigned int) _type.getIntSign());
+		pInstr->appendLiterals(type.getIntWidth(), (unsigned int) type.getIntSign());
 		break;
 	case spv::Op::OpTypeFloat:
-		pInstr->appendLiterals(_type.getFloatWidth());
+		pInstr->appendLiterals(type.getFloatWidth());
 		break;
 	case spv::Op::OpTypeVector:
 	case spv::Op::OpTypeMatrix:
-		pInstr->addOperand(addType(_type.getSubTypes().front())); // column type
-		pInstr->appendLiterals(_type.getMatrixColumnCount());
+		pInstr->addOperand(pSub); // column type
+		pInstr->appendLiterals(type.getMatrixColumnCount());
 		break;
 	case spv::Op::OpTypePointer:
-		pInstr->appendLiterals(_type.getStorageClass());
-		pInstr->addOperand(addType(_type.getSubTypes().front())); // base type
+		pInstr->appendLiterals(type.getStorageClass());
+		pInstr->addOperand(pSub); // base type
 		break;
 	case spv::Op::OpTypeForwardPointer:
-		pInstr->addOperand(addType(_type.getSubTypes().front())); // base type
-		pInstr->appendLiterals(_type.getStorageClass());
+		pInstr->addOperand(pSub); // base type
+		pInstr->appendLiterals(type.getStorageClass());
 		break;
 	case spv::Op::OpTypeStruct:
 	case spv::Op::OpTypeFunction:
-		for (const Type& member : _type.getSubTypes())
+		for (unsigned int i = 0u; i < count; ++i)
 		{
-			pInstr->addOperand(addType(member)); // member type
+			pInstr->addOperand(pSubTypes[i] != nullptr ? pSubTypes[i]->getInstruction() : nullptr); // member type
 		}
 		break;
 	case spv::Op::OpTypeRuntimeArray:
 	case spv::Op::OpTypeSampledImage:
-		pInstr->addOperand(addType(_type.getSubTypes().front())); // element type
+		pInstr->addOperand(pSub); // element type
 		break;
 	case spv::Op::OpTypeArray:
-		pInstr->addOperand(addType(_type.getSubTypes().front())); // element type
-		pInstr->addOperand(constant(_type.getArrayLength())); // length as constant
+		pInstr->addOperand(pSub); // element type
+		pInstr->addOperand(constant(type.getArrayLength())); // length as constant
 		break;
 	case spv::Op::OpTypeImage:
-		pInstr->addOperand(addType(_type.getSubTypes().front())); // sampled type
-		pInstr->appendLiterals(_type.getImageDimension());
-		pInstr->appendLiterals(_type.getImageDepth());
-		pInstr->appendLiterals(_type.getImageArray());
-		pInstr->appendLiterals(_type.getImageMultiSampled());
-		pInstr->appendLiterals(_type.getImageSamplerAccess());
-		pInstr->appendLiterals(_type.getImageFormat());
-		if(_type.getAccessQualifier() != spv::AccessQualifier::Max)
+		pInstr->addOperand(pSub); // sampled type
+		pInstr->appendLiterals(type.getImageDimension());
+		pInstr->appendLiterals(type.getImageDepth());
+		pInstr->appendLiterals(type.getImageArray());
+		pInstr->appendLiterals(type.getImageMultiSampled());
+		pInstr->appendLiterals(type.getImageSamplerAccess());
+		pInstr->appendLiterals(type.getImageFormat());
+		if(type.getAccessQualifier() != spv::AccessQualifier::Max)
 		{
-			pInstr->appendLiterals(_type.getAccessQualifier());
+			pInstr->appendLiterals(type.getAccessQualifier());
 		}
 		break;
 	default:
@@ -538,25 +1105,199 @@ spvgentwo::Instruction* spvgentwo::Module::addType(const Type& _type, const char
 
 	pInstr->validateOperands();
 
-	m_TypesAndConstants.append_entry(entry);
+	m_TypesAndConstants.append_entry(instr);
+
+	_node.m_pInstr = pInstr;
+	m_InstrToType.emplaceUnique(pInstr, &_node);
+
+	return pInstr;
+}
 
-	if (_pName != nullptr) 
+spvgentwo::TypeNode* spvgentwo::Module::findTypeNode(const Hash64 _hash, const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count) const
+{
+	for (auto& node : m_TypeNodes.getRange(_hash))
 	{
-		addName(pInstr, _pName);
+		if (node.kv.value.equals(_type, _pSubTypes, _count))
+		{
+			return &node.kv.value;
+		}
 	}
+	return nullptr;
+}
 
-	return pInstr;
+const spvgentwo::TypeNode* spvgentwo::Module::findTypeNode(const Type& _type) const
+{
+	SmallVector<const TypeNode*, 4u> subTypes(m_pAllocator);
+
+	for (const Type& sub : _type.getSubTypes())
+	{
+		subTypes.emplace_back(findTypeNode(sub)); // nullptr for not yet declared types (OpTypeForwardPointer)
+	}
+
+	const unsigned int count = static_cast<unsigned int>(subTypes.size());
+	return findTypeNode(TypeNode::hash(_type, subTypes.data(), count), _type, subTypes.data(), count);
+}
+
+const spvgentwo::TypeNode* spvgentwo::Module::addTypeNode(Type&& _type, Instruction* _pInstr, const TypeNode* const* _pSubTypes, const unsigned int _count)
+{
+	const Hash64 h = TypeNode::hash(_type, _pSubTypes, _count);
+
+	TypeNode* pNode = findTypeNode(h, _type, _pSubTypes, _count);
+
+	if (pNode == nullptr)
+	{
+		pNode = emplaceTypeNode(h, stdrep::move(_type), _pInstr, _pSubTypes, _count);
+		if (pNode == nullptr)
+		{
+			return nullptr;
+		}
+	}
+	else if (pNode->m_pInstr == nullptr)
+	{
+		pNode->m_pInstr = _pInstr;
+	}
+	else if (pNode->m_pInstr != _pInstr)
+	{
+		bool known = false;
+		for (const Instruction* pDuplicate : pNode->m_duplicates)
+		{
+			known |= pDuplicate == _pInstr;
+		}
+
+		if (known == false)
+		{
+			pNode->m_duplicates.emplace_back(_pInstr);
+		}
+	}
+
+	m_InstrToType.emplaceUnique(_pInstr, pNode);
+
+	return pNode;
+}
+
+spvgentwo::TypeNode* spvgentwo::Module::emplaceTypeNode(const Hash64 _hash, Type&& _type, Instruction* _pInstr, const TypeNode* const* _pSubTypes, const unsigned int _count)
+{
+	auto* pMapNode = m_TypeNodes.emplace(_hash, TypeNode(m_pAllocator, stdrep::move(_type), _pInstr, _hash, _pSubTypes, _count));
+	if (pMapNode == nullptr)
+	{
+		logError("Failed to allocate type node");
+		return nullptr;
+	}
+
+	for (unsigned int i = 0u; i < _count; ++i)
+	{
+		if (_pSubTypes[i] != nullptr)
+		{
+			++const_cast<TypeNode*>(_pSubTypes[i])->m_parents;
+		}
+	}
+
+	return &pMapNode->kv.value;
+}
+
+void spvgentwo::Module::releaseTypeNode(TypeNode* _pNode)
+{
+	// nodes without instruction are kept while other types are composed of them, they are declared again on their next use
+	if (_pNode->m_pInstr != nullptr || _pNode->m_parents != 0u)
+	{
+		return;
+	}
+
+	SmallVector<const TypeNode*, 2u> subTypes(stdrep::move(_pNode->m_subTypes));
+	m_TypeNodes.erase(_pNode->getHash(), _pNode);
+
+	for (const TypeNode* pSub : subTypes)
+	{
+		if (TypeNode* pSubNode = const_cast<TypeNode*>(pSub); pSubNode != nullptr)
+		{
+			--pSubNode->m_parents;
+			releaseTypeNode(pSubNode);
+		}
+	}
+}
+
+const spvgentwo::TypeNode* spvgentwo::Module::getTypeNode(const Instruction* _pTypeInstr) const
+{
+	const TypeNode* const* n = m_InstrToType.get(_pTypeInstr);
+	return n != nullptr ? *n : nullptr;
+}
+
+const spvgentwo::TypeNode* spvgentwo::Module::wrapType(const TypeNode* _pInner, const spv::Op _baseType, const unsigned int _count, const spv::StorageClass _storageClass)
+{
+	if (_pInner == nullptr)
+	{
+		return nullptr;
+	}
+
+	Type t(m_pAllocator);
+
+	switch (_baseType)
+	{
+	case spv::Op::OpTypeVector:
+		t.Vector(_count, nullptr);
+		break;
+	case spv::Op::OpTypeMatrix:
+		t.Matrix(_count, nullptr);
+		break;
+	case spv::Op::OpTypeArray:
+		t.Array(_count, nullptr);
+		break;
+	case spv::Op::OpTypePointer:
+		t.Pointer(_storageClass, nullptr);
+		break;
+	default:
+		t.setType(_baseType);
+		break;
+	}
+
+	return internType(t, &_pInner, 1u, nullptr);
+}
+
+void spvgentwo::Module::setCachedType(const unsigned int _index, Instruction* _pType)
+{
+	if (_index >= m_TypeCache.size() && m_TypeCache.resize(_index + 1u) == false)
+	{
+		return;
+	}
+
+	m_TypeCache[_index] = _pType;
+}
+
+bool spvgentwo::Module::isExportDecoration(const Instruction& _deco)
+{
+	auto it = _deco.begin();
+	return _deco.getOperation() == spv::Op::OpDecorate && _deco.size() > 2u && it->isInstruction() &&
+		(it + 1u)->isLiteral() && (it + 1u)->getLiteral() == static_cast<unsigned int>(spv::Decoration::LinkageAttributes) &&
+		_deco.back().isLiteral() && _deco.back().getLiteral() == static_cast<unsigned int>(spv::LinkageType::Export);
+}
+
+void spvgentwo::Module::clearTypeCaches()
+{
+	m_TypeCache.clear();
+	m_ScalarConstantCache.clear();
+}
+
+unsigned int spvgentwo::detail::nextTypeCacheIndex()
+{
+	// compiler intrinsics instead of <atomic>, the library does not depend on the standard library
+#if defined(_MSC_VER)
+	static volatile long s_index = 0;
+	return static_cast<unsigned int>(_InterlockedIncrement(&s_index) - 1);
+#else
+	static unsigned int s_index = 0u;
+	return __atomic_fetch_add(&s_index, 1u, __ATOMIC_RELAXED);
+#endif
 }
 
 const spvgentwo::Type* spvgentwo::Module::getTypeInfo(const Instruction* _pTypeInstr) const 
 {
 	if (_pTypeInstr != nullptr && _pTypeInstr->isType())
 	{
-		const Type* const* t = m_InstrToType.get(_pTypeInstr);
+		const TypeNode* const* t = m_InstrToType.get(_pTypeInstr);
 
 		if (t != nullptr)
 		{
-			return *t;
+			return &(*t)->getType();
 		}
 	}
 	return nullptr;
@@ -568,8 +1309,15 @@ spvgentwo::Instruction* spvgentwo::Module::addTypeInstr(const Type* _pType)
 
 	if (_pType != nullptr)
 	{
-		m_TypeToInstr.emplaceUnique(*_pType, instr);
-		m_InstrToType.emplaceUnique(instr, _pType);
+		SmallVector<const TypeNode*, 4u> subTypes(m_pAllocator);
+		for (const Type& sub : _pType->getSubTypes())
+		{
+			subTypes.emplace_back(findTypeNode(sub));
+		}
+
+		Type type(m_pAllocator);
+		type = *_pType;
+		addTypeNode(stdrep::move(type), instr, subTypes.data(), static_cast<unsigned int>(subTypes.size()));
 	}
 
 	return instr;
@@ -610,15 +1358,75 @@ void spvgentwo::Module::setMemoryModel(const spv::AddressingModel _addressModel,
 	m_MemoryModel.opMemoryModel(_addressModel, _memoryModel);
 }
 
-spvgentwo::spv::Id spvgentwo::Module::assignIDs()
+spvgentwo::spv::Id spvgentwo::Module::assignIDs(const bool _keepExisting)
 {
 	spv::Id maxId = 0;
 
-	iterateInstructions([&maxId](Instruction& instr)
+	if (_keepExisting)
+	{
+		if (resetIdLookup() == false)
+		{
+			return InvalidId;
+		}
+
+		bool success = true;
+
+		// first instruction claiming an id keeps it
+		iterateInstructions([&](Instruction& instr) -> bool
+		{
+			if (auto it = instr.getResultIdOperand(); it != nullptr && it->getId() != InvalidId)
+			{
+				const spv::Id id = it->id;
+				if (lookupId(id) == nullptr)
+				{
+					success = addIdLookup(id, &instr);
+					maxId = id > maxId ? id : maxId;
+				}
+			}
+			return success == false; // abort
+		});
+
+		iterateInstructions([&](Instruction& instr) -> bool
+		{
+			if (auto it = instr.getResultIdOperand(); success && it != nullptr)
+			{
+				if (const spv::Id id = it->getId(); id == InvalidId || lookupId(id) != &instr)
+				{
+					if (maxId == ~0u)
+					{
+						logError("No <id> left to assign");
+						success = false;
+					}
+					else
+					{
+						*it = ++maxId;
+						success = addIdLookup(maxId, &instr);
+					}
+				}
+			}
+			return success == false; // abort
+		});
+
+		if (success == false)
+		{
+			return InvalidId;
+		}
+
+		m_spvBound = maxId + 1u;
+
+		return maxId;
+	}
+
+	m_IdToInstr.clear();
+	m_SparseIdToInstr.clear();
+	m_IdToInstr.emplace_back(nullptr); // InvalidId
+
+	iterateInstructions([&maxId, this](Instruction& instr)
 	{
 		if (auto it = instr.getResultIdOperand(); it != nullptr)
 		{
 			*it = ++maxId;
+			m_IdToInstr.emplace_back(&instr);
 		}
 	});
 
@@ -627,13 +1435,16 @@ spvgentwo::spv::Id spvgentwo::Module::assignIDs()
 	return maxId;
 }
 
-bool spvgentwo::Module::resolveIDs()
+bool spvgentwo::Module::buildIdLookup()
 {
-	bool success = true;
+	if (resetIdLookup() == false)
+	{
+		return false;
+	}
 
-	HashMap<spv::Id, Instruction*> idToPtr(m_pAllocator);
+	bool success = true;
 
-	auto populate = [&idToPtr, &success, this](Instruction& _instr) -> bool
+	auto populate = [&success, this](Instruction& _instr) -> bool
 	{
 		// this instruction generates a new Id
 		if (auto it = _instr.getResultIdOperand(); it != nullptr)
@@ -645,408 +1456,975 @@ bool spvgentwo::Module::resolveIDs()
 				return true; // stop iterating
 			}
 
-			idToPtr.emplaceUnique(it->id, &_instr);
+			if (it->id >= m_spvBound)
+			{
+				logError("Result <id> %u exceeds the bound %u", it->id, m_spvBound);
+				success = false;
+				return true; // stop iterating
+			}
+
+			if (addIdLookup(it->id, &_instr) == false)
+			{
+				success = false;
+				return true; // stop iterating
+			}
 		}
 		return false;
 	};
 
 	iterateInstructions(populate);
 
-	if (success == false)
+	return success;
+}
+
+bool spvgentwo::Module::resetIdLookup()
+{
+	m_IdToInstr.clear();
+	m_SparseIdToInstr.clear();
+
+	const spv::Id reserve = m_spvBound < MaxIdLookupReserve ? m_spvBound : MaxIdLookupReserve;
+
+	if (m_IdToInstr.resize(reserve) == false)
 	{
+		logError("Failed to allocate id lookup for bound %u", m_spvBound);
 		return false;
 	}
 
-	auto lookUp = [&idToPtr, &success, this](Instruction& _instr) -> bool
+	return true;
+}
+
+bool spvgentwo::Module::addIdLookup(spv::Id _id, Instruction* _pInstr)
+{
+	const sgt_size_t id = _id;
+	const sgt_size_t size = m_IdToInstr.size();
+
+	if (id >= size)
 	{
-		for (auto it = _instr.begin(), end = _instr.end(); it != end; ++it)
+		// only grow if the table stays at least half populated by dense ids, otherwise a single huge <id> would allocate up to 32 GiB
+		if (id > size * 2u + MaxIdLookupReserve)
 		{
-			if (_instr.hasResult() && it == _instr.getResultIdOperand()) // dont replace the dummy resultID operand
+			auto* pNode = m_SparseIdToInstr.emplaceUnique(_id, _pInstr);
+			if (pNode == nullptr)
 			{
-				continue;
+				logError("Failed to grow id lookup for <id> %u", _id);
+				return false;
 			}
+			pNode->kv.value = _pInstr;
+			return true;
+		}
 
-			if (spv::Id id = it->getId(); id != InvalidId)
-			{
-				if (Instruction** ppInstr = idToPtr.get(id); ppInstr != nullptr) // lookup pointer for operand
-				{
-					Instruction* op = *ppInstr;
+		if (m_IdToInstr.reserve(id < size * 2u ? size * 2u : id + 1u) == false || m_IdToInstr.resize(id + 1u) == false)
+		{
+			logError("Failed to grow id lookup for <id> %u", _id);
+			return false;
+		}
+	}
 
-					// operand is a branch target
-					if (op->getOperation() == spv::Op::OpLabel &&
-						(_instr.getOperation() == spv::Op::OpBranch ||
-						 _instr.getOperation() == spv::Op::OpBranchConditional ||
-						 _instr.getOperation() == spv::Op::OpSwitch))
-					{
-						*it = op->getBasicBlock();
-					}
-					else
-					{
-						*it = op;
-					}	
-				}
-				else
-				{
-					logError("Instruction not found for Id %u", id);
-					success = false;
-					return true; // abort
-				}
-			}
+	m_IdToInstr[id] = _pInstr;
+
+	return true;
+}
+
+spvgentwo::Instruction* spvgentwo::Module::lookupId(spv::Id _id) const
+{
+	if (_id < m_IdToInstr.size())
+	{
+		return m_IdToInstr[_id];
+	}
+
+	Instruction** ppInstr = m_SparseIdToInstr.get(_id);
+	return ppInstr != nullptr ? *ppInstr : nullptr;
+}
+
+bool spvgentwo::Module::resolveIDs()
+{
+	if (buildIdLookup() == false)
+	{
+		return false;
+	}
+
+	bool success = true;
+
+	auto lookUp = [&success, this](Instruction& _instr) -> bool
+	{
+		if (const spv::Id id = resolveOperands(_instr); id != InvalidId)
+		{
+			logError("Instruction not found for Id %u", id);
+			success = false;
+			return true; // abort
 		}
 		return false; // continue iterating
 	};
 
 	iterateInstructions(lookUp);
 
+	buildUseLookup();
+
 	return success;
 }
 
-bool spvgentwo::Module::reconstructTypeAndConstantInfo()
+spvgentwo::spv::Id spvgentwo::Module::resolveOperands(Instruction& _instr) const
 {
-	m_InstrToType.clear();
-	m_TypeToInstr.clear();
-	m_InstrToConstant.clear();
-	m_ConstantToInstr.clear();
+	spv::Id unresolved = InvalidId;
 
-	for (Instruction& instr : m_TypesAndConstants)
+	for (auto it = _instr.begin(), end = _instr.end(); it != end; ++it)
 	{
-		auto it = instr.getFirstActualOperand(); // TODO: validate number of available operands with Grammar in read() (for now just assume the .spv is valid)
+		if (_instr.hasResult() && it == _instr.getResultIdOperand()) // dont replace the dummy resultID operand
+		{
+			continue;
+		}
 
-		if (instr.isType())
+		if (spv::Id id = it->getId(); id != InvalidId)
 		{
-			Type t(m_pAllocator);
-			t.setType(instr.getOperation());
+			Instruction* op = lookupId(id);
 
-			switch (instr.getOperation())
+			if (op == nullptr)
 			{
-			case spv::Op::OpTypeVoid:
-			case spv::Op::OpTypeBool:
-			case spv::Op::OpTypeSampler:
-			case spv::Op::OpTypeEvent:
-			case spv::Op::OpTypeDeviceEvent:
-			case spv::Op::OpTypeReserveId:
-			case spv::Op::OpTypeQueue:
-			case spv::Op::OpTypePipeStorage:
-			case spv::Op::OpTypeNamedBarrier:
-				break; // nothing to do
-			case spv::Op::OpTypeInt:
-				t.setIntWidth(it->getLiteral());
-				t.setIntSign((++it)->getLiteral() == 1u);
-				break;
-			case spv::Op::OpTypeFloat:
-				t.setFloatWidth(it->getLiteral());
-				break;
-			case spv::Op::OpTypeVector:
-			case spv::Op::OpTypeMatrix:
+				unresolved = unresolved == InvalidId ? id : unresolved;
+			}
+			// operand is a branch target
+			else if (op->getOperation() == spv::Op::OpLabel &&
+				(_instr.getOperation() == spv::Op::OpBranch ||
+				 _instr.getOperation() == spv::Op::OpBranchConditional ||
+				 _instr.getOperation() == spv::Op::OpSwitch))
 			{
-				const Type* sub = getTypeInfo(it->getInstruction());
-				if (sub == nullptr)
-				{
-					logError("Component or Column sub type not found");
-					return false;
-				}
-
-				t.Member(sub); // component / column type
-				t.setVectorComponentCount((++it)->getLiteral()); // or MatrixColumnCount
+				*it = op->getBasicBlock();
 			}
+			else
+			{
+				*it = op;
+			}
+		}
+	}
+
+	return unresolved;
+}
+
+void spvgentwo::Module::buildUseLookup()
+{
+	m_Uses.clear();
+	m_UseEntries.clear();
+
+	if (m_trackUses == false)
+	{
+		return;
+	}
+
+	iterateInstructions([this](Instruction& _instr)
+	{
+		for (auto it = _instr.getFirstActualOperand(), end = _instr.end(); it != end; ++it)
+		{
+			addUse(&_instr, *it);
+		}
+	});
+}
+
+bool spvgentwo::Module::reconstructTypeAndConstantInfo()
+{
+	m_InstrToType.clear();
+	m_TypeNodes.clear();
+	clearTypeCaches();
+	m_InstrToConstant.clear();
+	m_ConstantToInstr.clear();
+
+	for (Instruction& instr : m_TypesAndConstants)
+	{
+		if (addTypeOrConstantInfo(instr) == false)
+		{
+			return false;
+		}
+	}
+
+	return updateFunctionTypes();
+}
+
+bool spvgentwo::Module::addTypeOrConstantInfo(Instruction& _instr)
+{
+	auto it = _instr.getFirstActualOperand(); // TODO: validate number of available operands with Grammar in read() (for now just assume the .spv is valid)
+
+	if (_instr.isType())
+	{
+		Type t(m_pAllocator);
+		t.setType(_instr.getOperation());
+
+		switch (_instr.getOperation())
+		{
+		case spv::Op::OpTypeVoid:
+		case spv::Op::OpTypeBool:
+		case spv::Op::OpTypeSampler:
+		case spv::Op::OpTypeEvent:
+		case spv::Op::OpTypeDeviceEvent:
+		case spv::Op::OpTypeReserveId:
+		case spv::Op::OpTypeQueue:
+		case spv::Op::OpTypePipeStorage:
+		case spv::Op::OpTypeNamedBarrier:
+			break; // nothing to do
+		case spv::Op::OpTypeInt:
+			t.setIntWidth(it->getLiteral());
+			t.setIntSign((++it)->getLiteral() == 1u);
 			break;
-			case spv::Op::OpTypePointer:
-				t.setStorageClass(static_cast<spv::StorageClass>(it->getLiteral().value));
-				{
-					const Type* sub = getTypeInfo((++it)->getInstruction());
-					if (sub == nullptr)
-					{
-						logError("Pointer base type not found");
-						return false;
-					}
-					t.Member(sub);
-				}
-				break;
-			case spv::Op::OpTypeForwardPointer:
+		case spv::Op::OpTypeFloat:
+			t.setFloatWidth(it->getLiteral());
+			break;
+		case spv::Op::OpTypeVector:
+		case spv::Op::OpTypeMatrix:
+		{
+			const Type* sub = getTypeInfo(it->getInstruction());
+			if (sub == nullptr)
 			{
-				const Type* sub = getTypeInfo(it->getInstruction());
+				logError("Component or Column sub type not found");
+				return false;
+			}
+
+			t.Member(sub); // component / column type
+			t.setVectorComponentCount((++it)->getLiteral()); // or MatrixColumnCount
+		}
+		break;
+		case spv::Op::OpTypePointer:
+			t.setStorageClass(static_cast<spv::StorageClass>(it->getLiteral().value));
+			{
+				const Type* sub = getTypeInfo((++it)->getInstruction());
 				if (sub == nullptr)
 				{
-					logError("Pointer type not found");
+					logError("Pointer base type not found");
 					return false;
 				}
 				t.Member(sub);
-				t.setStorageClass(static_cast<spv::StorageClass>((++it)->getLiteral().value));
 			}
 			break;
-			case spv::Op::OpTypeStruct:
-			case spv::Op::OpTypeFunction:
-				for (auto end = instr.end(); it != end; ++it)
-				{
-					const Type* sub = getTypeInfo(it->getInstruction());
-					if (sub == nullptr)
-					{
-						logError("Member or Parameter sub type not found");
-						return false;
-					}
-					t.Member(sub); // member or parameter type
-				}
-				break;
-			case spv::Op::OpTypeRuntimeArray:
-			case spv::Op::OpTypeSampledImage:
+		case spv::Op::OpTypeForwardPointer:
+		{
+			const Type* sub = getTypeInfo(it->getInstruction());
+			if (sub == nullptr)
+			{
+				logError("Pointer type not found");
+				return false;
+			}
+			t.Member(sub);
+			t.setStorageClass(static_cast<spv::StorageClass>((++it)->getLiteral().value));
+		}
+		break;
+		case spv::Op::OpTypeStruct:
+		case spv::Op::OpTypeFunction:
+			for (auto end = _instr.end(); it != end; ++it)
 			{
 				const Type* sub = getTypeInfo(it->getInstruction());
 				if (sub == nullptr)
 				{
-					logError("Element or image type not found");
+					logError("Member or Parameter sub type not found");
 					return false;
 				}
-				t.Member(sub); // element or image type
+				t.Member(sub); // member or parameter type
 			}
 			break;
-			case spv::Op::OpTypeArray:
+		case spv::Op::OpTypeRuntimeArray:
+		case spv::Op::OpTypeSampledImage:
+		{
+			const Type* sub = getTypeInfo(it->getInstruction());
+			if (sub == nullptr)
 			{
-				const Type* sub = getTypeInfo(it->getInstruction());
-				if (sub == nullptr)
-				{
-					logError("Element type not found");
-					return false;
-				}
-				t.Member(sub); // element type
+				logError("Element or image type not found");
+				return false;
+			}
+			t.Member(sub); // element or image type
+		}
+		break;
+		case spv::Op::OpTypeArray:
+		{
+			const Type* sub = getTypeInfo(it->getInstruction());
+			if (sub == nullptr)
+			{
+				logError("Element type not found");
+				return false;
+			}
+			t.Member(sub); // element type
 
-				const Constant* c = getConstantInfo((++it)->getInstruction());
-				if (c == nullptr)
-				{
-					logError("Array length constant not found");
-					return false;
-				}
+			const Constant* c = getConstantInfo((++it)->getInstruction());
+			if (c == nullptr)
+			{
+				logError("Array length constant not found");
+				return false;
+			}
 
-				if (c->getType().isInt() == false || c->getData().empty())
-				{
-					logError("Invalid constant data");
-					return false;
-				}
+			if (c->getType().isInt() == false || c->getData().empty())
+			{
+				logError("Invalid constant data");
+				return false;
+			}
+
+			t.setArrayLength(c->getData().front()); // array length
+		}
+		break;
+		case spv::Op::OpTypeImage:
+		{
+			const Type* sub = getTypeInfo(it->getInstruction());
+			if (sub == nullptr)
+			{
+				logError("Sampled type not found");
+				return false;
+			}
+			t.Member(sub); // sampled type
+
+			t.setImageDimension(static_cast<spv::Dim>((++it)->getLiteral().value));
+			t.setImageDepth((++it)->getLiteral());
+			t.setImageArray((++it)->getLiteral() == 1u);
+			t.setImageMultiSampled((++it)->getLiteral() == 1u);
+			t.setImageSamplerAccess(static_cast<spvgentwo::SamplerImageAccess>((++it)->getLiteral().value));
+			t.setImageFormat(static_cast<spv::ImageFormat>((++it)->getLiteral().value));
 
-				t.setArrayLength(c->getData().front()); // array length
+			if (++it != nullptr)
+			{
+				t.setAccessQualifier(static_cast<spv::AccessQualifier>((++it)->getLiteral().value));
+			}
+		}
+		break;
+		default:
+			logFatal("Type not implemented");
+			return false;
+		}
+
+		// sub types are the type operands in order (array lengths are constants)
+		SmallVector<const TypeNode*, 4u> subTypes(m_pAllocator);
+		for (auto op = _instr.getFirstActualOperand(), end = _instr.end(); op != end; ++op)
+		{
+			if (const TypeNode* pSub = op->isInstruction() ? getTypeNode(op->getInstruction()) : nullptr; pSub != nullptr)
+			{
+				subTypes.emplace_back(pSub);
+			}
+		}
+
+		addTypeNode(stdrep::move(t), &_instr, subTypes.data(), static_cast<unsigned int>(subTypes.size()));
+	}
+	else if (_instr.isSpecOrConstant())
+	{
+		Constant c(m_pAllocator);
+
+		c.setOperation(_instr.getOperation());
+
+		const Type* t = getTypeInfo(_instr.getTypeInstr());
+		if (t == nullptr)
+		{
+			logError("Constant type not found");
+			return false;
+		}
+
+		c.getType() = *t;
+
+		switch (_instr.getOperation())
+		{
+		case spv::Op::OpConstantNull:
+		case spv::Op::OpConstantTrue:
+		case spv::Op::OpSpecConstantTrue:
+		case spv::Op::OpConstantFalse:
+		case spv::Op::OpSpecConstantFalse:
+			break; // nothing to do
+		case spv::Op::OpConstant:
+		case spv::Op::OpSpecConstant:
+		case spv::Op::OpConstantSampler:
+			for (auto end = _instr.end(); it != end; ++it)
+			{
+				c.getData().emplace_back(it->getLiteral());
 			}
 			break;
-			case spv::Op::OpTypeImage:
+		case spv::Op::OpConstantComposite:
+		case spv::Op::OpSpecConstantComposite:
+			for (auto end = _instr.end(); it != end; ++it)
 			{
-				const Type* sub = getTypeInfo(it->getInstruction());
+				const Constant* sub = getConstantInfo(it->getInstruction());
 				if (sub == nullptr)
 				{
-					logError("Sampled type not found");
+					logError("Constituent constant not found");
 					return false;
 				}
-				t.Member(sub); // sampled type
-
-				t.setImageDimension(static_cast<spv::Dim>((++it)->getLiteral().value));
-				t.setImageDepth((++it)->getLiteral());
-				t.setImageArray((++it)->getLiteral() == 1u);
-				t.setImageMultiSampled((++it)->getLiteral() == 1u);
-				t.setImageSamplerAccess(static_cast<spvgentwo::SamplerImageAccess>((++it)->getLiteral().value));
-				t.setImageFormat(static_cast<spv::ImageFormat>((++it)->getLiteral().value));
 
-				if (++it != nullptr)
+				Constant* pComponent = c.Component();
+				if (pComponent == nullptr)
 				{
-					t.setAccessQualifier(static_cast<spv::AccessQualifier>((++it)->getLiteral().value));
+					logError("Failed to allocate constant component");
+					return false;
 				}
+				*pComponent = *sub;
 			}
 			break;
-			default:
-				logFatal("Type not implemented");
-				return false;
+		case spv::Op::OpSpecConstantOp:
+			return true; // dont add to lookup
+		default:
+			logFatal("Constant not implemented");
+			return false;
+		}
+
+		auto* pNode = m_ConstantToInstr.emplaceUnique(stdrep::move(c), &_instr);
+		if (pNode == nullptr || m_InstrToConstant.emplaceUnique(&_instr, &pNode->kv.key) == nullptr)
+		{
+			logError("Failed to allocate constant lookup entry");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool spvgentwo::Module::updateFunctionTypes()
+{
+	auto update = [](Function& _fun) -> bool
+	{
+		if (auto it = _fun.getFunction()->getResultTypeOperand(); it != nullptr && it->isInstruction())
+		{
+			if (Instruction* funcType = _fun.setReturnType(it->instruction); funcType != nullptr)
+			{
+				for (Instruction& param : _fun.getParameters())
+				{
+					if (auto typeIt = param.getResultTypeOperand(); typeIt != nullptr && typeIt->isInstruction())
+					{
+						funcType->addOperand(typeIt->instruction);
+					}
+					else
+					{
+						return false;
+					}
+				}
+				return true;
 			}
+		}
+		return false;
+	};
+
+	for (Function& f : m_Functions)
+	{
+		if (update(f) == false)
+			return false;
+	}
+
+	for (EntryPoint& f : m_EntryPoints)
+	{
+		if (update(f) == false)
+			return false;
+	}
+
+	return true;
+}
+
+bool spvgentwo::Module::reconstructNames()
+{
+	m_NameLookup.clear();
+
+	for (const Instruction& instr : m_Names)
+	{
+		if (addNameInfo(instr) == false)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool spvgentwo::Module::addNameInfo(const Instruction& _instr)
+{
+	auto it = _instr.getFirstActualOperand();
+	const Instruction* target = it != nullptr ? it->getInstruction() : nullptr;
+
+	if (target == nullptr)
+	{
+		logError("Invalid OpName / OpMemberName target");
+		return false;
+	}
 
-			auto& node = m_TypeToInstr.emplaceUnique(stdrep::move(t), &instr);
-			m_InstrToType.emplaceUnique(&instr, &node.kv.key);
+	unsigned int memberIndex = ~0u;
+
+	if (_instr.getOperation() == spv::Op::OpMemberName)
+	{
+		if (++it == nullptr || it->isLiteral() == false)
+		{
+			logError("Invalid member index operand for OpMemberName");
+			return false;
 		}
-		else if (instr.isSpecOrConstant())
+		memberIndex = it->literal.value;
+	}
+	else if (_instr.getOperation() != spv::Op::OpName)
+	{
+		logError("Invalid name instructions");
+		return false;
+	}
+
+	auto* pNode = m_NameLookup.emplace(target, MemberName{ m_pAllocator, memberIndex });
+	if (pNode == nullptr)
+	{
+		logError("Failed to allocate name lookup entry");
+		return false;
+	}
+
+	String& name = pNode->kv.value.name;
+
+	getLiteralString(name, it.next(), _instr.end());
+
+	if (name.empty() || name.back() != '\0')
+	{
+		logError("Failed to parse name");
+		return false;
+	}
+
+	return true;
+}
+
+void spvgentwo::Module::finalizeEntryPoints()
+{
+	for (EntryPoint& ep : m_EntryPoints)
+	{
+		if (m_spvVersion < makeVersion(1u, 4u))
+		{
+			ep.finalizeGlobalInterface(GlobalInterfaceVersion::SpirV1_3);
+		}
+		else
 		{
-			Constant c(m_pAllocator);
+			ep.finalizeGlobalInterface(GlobalInterfaceVersion::SpirV14_x);
+		}
+	}
+}
+
+void spvgentwo::Module::prepareWrite(const bool _assingIDs)
+{
+	finalizeEntryPoints();
+
+	if (_assingIDs)
+	{
+		assignIDs(); // overwrites m_spvBound
+	}
+}
+
+void spvgentwo::Module::write(IWriter* _pWriter, const bool _assingIDs)
+{
+	prepareWrite(_assingIDs);
+
+	// write header
+	const unsigned int header[] = { spv::MagicNumber, m_spvVersion, GeneratorId, m_spvBound, m_spvSchema };
+	_pWriter->write(header, sizeof(header) / sizeof(header[0]));
+
+	auto writeInstr = [_pWriter](Instruction& instr)
+	{
+		instr.write(_pWriter);
+	};
 
-			c.setOperation(instr.getOperation());
+	iterateInstructions(writeInstr);
+}
+
+spvgentwo::sgt_size_t spvgentwo::Module::computeWordCount()
+{
+	finalizeEntryPoints();
+
+	sgt_size_t wordCount = 5u; // header
+
+	iterateInstructions([&wordCount](const Instruction& _instr)
+	{
+		wordCount += _instr.getWordCount();
+	});
+
+	return wordCount;
+}
+
+spvgentwo::sgt_size_t spvgentwo::Module::write(unsigned int* _pWords, sgt_size_t _wordCount, const bool _assingIDs)
+{
+	BinaryBufferWriter writer(_pWords, _wordCount);
+	write(&writer, _assingIDs);
+
+	if (writer.overflow())
+	{
+		logError("Buffer of %u words is too small for module of %u words", static_cast<unsigned int>(_wordCount), static_cast<unsigned int>(computeWordCount()));
+		return 0u;
+	}
+
+	return writer.position();
+}
+
+void spvgentwo::Module::writeParallel(IWriter* _pWriter, ITaskExecutor* _pExecutor, const bool _assingIDs)
+{
+	prepareWrite(_assingIDs);
+
+	struct FunctionRange
+	{
+		Function* pFunction;
+		unsigned int* pWords;
+		sgt_size_t wordCount;
+	};
 
-			const Type* t = getTypeInfo(instr.getTypeInstr());
-			if (t == nullptr)
+	Vector<FunctionRange> functions(m_pAllocator);
+
+	auto addFunction = [&functions](Function& _func) -> bool
+	{
+		for (const BasicBlock& bb : _func)
+		{
+			if (bb.getTerminator() == nullptr)
 			{
-				logError("Constant type not found");
 				return false;
 			}
+		}
+		functions.emplace_back(FunctionRange{ &_func, nullptr, _func.getWordCount() });
+		return true;
+	};
+
+	bool valid = true;
+
+	// same order as iterateModuleInstructions: declarations, definitions, entry points
+	for (Function& f : m_Functions)
+	{
+		valid &= f.empty() == false || addFunction(f);
+	}
+	for (Function& f : m_Functions)
+	{
+		valid &= f.empty() || addFunction(f);
+	}
+	for (EntryPoint& ep : m_EntryPoints)
+	{
+		valid &= ep.empty() || addFunction(ep);
+	}
+
+	// everything up to the first OpFunction
+	sgt_size_t wordCount = 5u;
+	iterateInstructions([&wordCount](Instruction& _instr) -> bool
+	{
+		if (_instr.getOperation() == spv::Op::OpFunction)
+		{
+			return true; // stop iterating
+		}
+		wordCount += _instr.getWordCount();
+		return false;
+	});
+
+	const sgt_size_t globalWordCount = wordCount;
+
+	for (const FunctionRange& range : functions)
+	{
+		wordCount += range.wordCount;
+	}
+
+	Vector<unsigned int> buffer(m_pAllocator);
+
+	// let write() log and abort on the same block it would stop at
+	if (valid == false || buffer.resize(wordCount) == false)
+	{
+		write(_pWriter, false);
+		return;
+	}
+
+	BinaryBufferWriter globalWriter(buffer.data(), globalWordCount);
+
+	const unsigned int header[] = { spv::MagicNumber, m_spvVersion, GeneratorId, m_spvBound, m_spvSchema };
+	globalWriter.write(header, sizeof(header) / sizeof(header[0]));
+
+	iterateInstructions([&globalWriter](Instruction& _instr) -> bool
+	{
+		if (_instr.getOperation() == spv::Op::OpFunction)
+		{
+			return true; // stop iterating
+		}
+		_instr.write(&globalWriter);
+		return false;
+	});
+
+	unsigned int* pWords = buffer.data() + globalWordCount;
+	for (FunctionRange& range : functions)
+	{
+		range.pWords = pWords;
+		pWords += range.wordCount;
+	}
+
+	const ITaskExecutor::Task task = [](void* _pUserData, unsigned int _index)
+	{
+		FunctionRange& range = static_cast<FunctionRange*>(_pUserData)[_index];
+		BinaryBufferWriter writer(range.pWords, range.wordCount);
+		range.pFunction->write(&writer);
+	};
+
+	const unsigned int count = static_cast<unsigned int>(functions.size());
+
+	if (_pExecutor != nullptr)
+	{
+		_pExecutor->run(task, functions.data(), count);
+	}
+	else
+	{
+		for (unsigned int i = 0u; i < count; ++i)
+		{
+			task(functions.data(), i);
+		}
+	}
+
+	_pWriter->write(buffer.data(), buffer.size());
+}
+
+bool spvgentwo::Module::read(IReader* _pReader, const Grammar& _grammar)
+{
+	return readInstructions(_pReader, _grammar) && buildIdLookup();
+}
+
+bool spvgentwo::Module::readAndResolve(IReader* _pReader, const Grammar& _grammar)
+{
+	if (readInstructions(_pReader, _grammar) == false)
+	{
+		return false;
+	}
+
+	m_InstrToType.clear();
+	m_TypeNodes.clear();
+	clearTypeCaches();
+	m_InstrToConstant.clear();
+	m_ConstantToInstr.clear();
+	m_NameLookup.clear();
+
+	if (resetIdLookup() == false)
+	{
+		return false;
+	}
+
+	// instructions with operands referencing an <id> defined later in the module
+	List<Instruction*> forwardRefs(m_pAllocator);
+
+	// first type or constant instruction that had a forward reference, it and all subsequent ones are reconstructed after patching
+	const Instruction* pFirstDeferred = nullptr;
+
+	bool success = true;
+
+	iterateInstructions([&](Instruction& _instr) -> bool
+	{
+		if (auto it = _instr.getResultIdOperand(); it != nullptr)
+		{
+			if (it->isId() == false)
+			{
+				logError("Result <id> operand is not a ID operand");
+				success = false;
+				return true; // abort
+			}
 
-			c.getType() = *t;
+			if (it->id >= m_spvBound)
+			{
+				logError("Result <id> %u exceeds the bound %u", it->id, m_spvBound);
+				success = false;
+				return true; // abort
+			}
 
-			switch (instr.getOperation())
+			if (addIdLookup(it->id, &_instr) == false)
 			{
-			case spv::Op::OpConstantNull:
-			case spv::Op::OpConstantTrue:
-			case spv::Op::OpSpecConstantTrue:
-			case spv::Op::OpConstantFalse:
-			case spv::Op::OpSpecConstantFalse:
-				break; // nothing to do
-			case spv::Op::OpConstant:
-			case spv::Op::OpSpecConstant:
-			case spv::Op::OpConstantSampler:
-				for (auto end = instr.end(); it != end; ++it)
-				{
-					c.getData().emplace_back(it->getLiteral());
-				}
-				break;
-			case spv::Op::OpConstantComposite:
-			case spv::Op::OpSpecConstantComposite:
-				for (auto end = instr.end(); it != end; ++it)
-				{
-					const Constant* sub = getConstantInfo(it->getInstruction());
-					if (sub == nullptr)
-					{
-						logError("Constituent constant not found");
-						return false;
-					}
+				success = false;
+				return true; // abort
+			}
+		}
 
-					c.Component() = *sub;
-				}
-				break;
-			case spv::Op::OpSpecConstantOp:
-				continue; // continue the loop, dont add to lookup
-				//break;
-			default:
-				logFatal("Constant not implemented");
-				return false;
+		const bool resolved = resolveOperands(_instr) == InvalidId;
+
+		if (resolved == false)
+		{
+			forwardRefs.emplace_back(&_instr);
+		}
+
+		if (_instr.isType() || _instr.isSpecOrConstant())
+		{
+			if (resolved == false && pFirstDeferred == nullptr)
+			{
+				pFirstDeferred = &_instr;
+			}
+
+			if (pFirstDeferred == nullptr && addTypeOrConstantInfo(_instr) == false)
+			{
+				success = false;
+				return true; // abort
 			}
+		}
+
+		return false; // continue iterating
+	});
 
-			auto& node = m_ConstantToInstr.emplaceUnique(stdrep::move(c), &instr);
-			m_InstrToConstant.emplaceUnique(&instr, &node.kv.key);
+	if (success == false)
+	{
+		return false;
+	}
+
+	for (Instruction* pInstr : forwardRefs)
+	{
+		if (const spv::Id id = resolveOperands(*pInstr); id != InvalidId)
+		{
+			logError("Instruction not found for Id %u", id);
+			return false;
 		}
 	}
 
-	auto updateFunctionTypes = [](Function& _fun) -> bool
+	if (pFirstDeferred != nullptr)
 	{
-		if (auto it = _fun.getFunction()->getResultTypeOperand(); it != nullptr && it->isInstruction())
+		bool deferred = false;
+		for (Instruction& instr : m_TypesAndConstants)
 		{
-			if (Instruction* funcType = _fun.setReturnType(it->instruction); funcType != nullptr)
+			deferred |= &instr == pFirstDeferred;
+			if (deferred && addTypeOrConstantInfo(instr) == false)
 			{
-				for (Instruction& param : _fun.getParameters())
-				{
-					if (auto typeIt = param.getResultTypeOperand(); typeIt != nullptr && typeIt->isInstruction())
-					{
-						funcType->addOperand(typeIt->instruction);
-					}
-					else
-					{
-						return false;
-					}
-				}
-				return true;
+				return false;
 			}
 		}
-		return false;
-	};
+	}
 
-	for (Function& f : m_Functions)
+	if (updateFunctionTypes() == false)
 	{
-		if (updateFunctionTypes(f) == false)
-			return false;
+		return false;
 	}
 
-	for (EntryPoint& f : m_EntryPoints)
+	// names precede their targets in the module layout
+	for (const Instruction& instr : m_Names)
 	{
-		if (updateFunctionTypes(f) == false)
+		if (addNameInfo(instr) == false)
+		{
 			return false;
+		}
 	}
 
+	buildUseLookup();
+
 	return true;
 }
 
-bool spvgentwo::Module::reconstructNames()
+bool spvgentwo::Module::readParallel(const unsigned int* _pWords, sgt_size_t _wordCount, const Grammar& _grammar, ITaskExecutor* _pExecutor)
 {
-	m_NameLookup.clear();
+	struct FunctionRange
+	{
+		Function* pFunction;
+		const unsigned int* pWords;
+		sgt_size_t wordCount;
+		bool success;
+	};
 
-	for (const Instruction& instr : m_Names)
+	Vector<FunctionRange> functions(m_pAllocator);
+
+	// global section ends at the first OpFunction, locate [OpFunction, OpFunctionEnd] ranges after it
+	sgt_size_t globalEnd = _wordCount;
+	sgt_size_t start = _wordCount;
+	for (sgt_size_t offset = 5u; offset < _wordCount;)
 	{
-		auto it = instr.getFirstActualOperand();
-		const Instruction* target = it != nullptr ? it->getInstruction() : nullptr;
+		const unsigned int word = _pWords[offset];
+		const unsigned int wordCount = getOperandCount(word);
 
-		if (target == nullptr)
+		if (wordCount == 0u || wordCount > _wordCount - offset)
 		{
-			logError("Invalid OpName / OpMemberName target");
+			logError("Invalid word count %u at offset %u", wordCount, static_cast<unsigned int>(offset));
 			return false;
 		}
 
-		unsigned int memberIndex = ~0u;
+		const spv::Op op = getOperation(word);
 
-		if (instr.getOperation() == spv::Op::OpMemberName)
+		if (op == spv::Op::OpFunction)
 		{
-			if (++it == nullptr || it->isLiteral() == false)
-			{
-				logError("Invalid member index operand for OpMemberName");
-				return false;
-			}
-			memberIndex = it->literal.value;
+			globalEnd = globalEnd == _wordCount ? offset : globalEnd;
+			start = offset;
 		}
-		else if (instr.getOperation() != spv::Op::OpName)
+		else if (start == _wordCount && globalEnd != _wordCount)
 		{
-			logError("Invalid name instructions");
+			logError("Unexpected operation %u between functions", op);
 			return false;
 		}
-
-		String& name = m_NameLookup.emplace(target, MemberName{ m_pAllocator, memberIndex }).kv.value.name;
-
-		getLiteralString(name, it.next(), instr.end());
-
-		if (name.empty() || name.back() != '\0')
+		else if (op == spv::Op::OpFunctionEnd && start != _wordCount)
 		{
-			logError("Failed to parse name");
-			return false;
+			functions.emplace_back(FunctionRange{ nullptr, _pWords + start, offset + wordCount - start, false });
+			start = _wordCount;
 		}
+
+		offset += wordCount;
 	}
 
-	return true;
-}
+	if (start != _wordCount)
+	{
+		logError("Missing OpFunctionEnd");
+		return false;
+	}
 
-void spvgentwo::Module::write(IWriter* _pWriter, const bool _assingIDs)
-{
-	// finalize entry points interfaces
-	for (EntryPoint& ep : m_EntryPoints)
+	BinaryBufferReader globalReader(_pWords, globalEnd);
+	if (readInstructions(&globalReader, _grammar) == false)
 	{
-		if (m_spvVersion < makeVersion(1u, 4u))
+		return false;
+	}
+
+	// create functions in binary order before parsing them concurrently
+	for (FunctionRange& range : functions)
+	{
+		// OpFunction: result type, result id
+		const spv::Id id = range.wordCount > 2u ? range.pWords[2] : InvalidId;
+
+		for (EntryPoint& ep : m_EntryPoints)
 		{
-			ep.finalizeGlobalInterface(GlobalInterfaceVersion::SpirV1_3);
+			if (auto it = ep.getEntryPoint()->getFirstActualOperand(); it != nullptr && (++it) != nullptr && it->getId() == id)
+			{
+				range.pFunction = &ep;
+				break;
+			}
 		}
-		else
+
+		if (range.pFunction == nullptr)
 		{
-			ep.finalizeGlobalInterface(GlobalInterfaceVersion::SpirV14_x);
+			range.pFunction = &m_Functions.emplace_back(this);
 		}
 	}
 
-	if (_assingIDs)
+	struct Context
 	{
-		assignIDs(); // overwrites m_spvBound
-	}
-
-	// write header
-	_pWriter->put(spv::MagicNumber);
-	_pWriter->put(m_spvVersion);
-	_pWriter->put(GeneratorId);
-	_pWriter->put(m_spvBound);
-	_pWriter->put(m_spvSchema);
+		Module* pModule;
+		const Grammar* pGrammar;
+		FunctionRange* pFunctions;
+	} context{ this, &_grammar, functions.data() };
 
-	auto writeInstr = [_pWriter](Instruction& instr)
+	const ITaskExecutor::Task task = [](void* _pUserData, unsigned int _index)
 	{
-		instr.write(_pWriter);
+		const Context& ctx = *static_cast<const Context*>(_pUserData);
+		FunctionRange& range = ctx.pFunctions[_index];
+
+		BinaryBufferReader reader(range.pWords, range.wordCount);
+		unsigned int word{ 0 };
+		Instruction opFunc(ctx.pModule);
+
+		range.success = reader.get(word) &&
+			opFunc.readOperands(&reader, *ctx.pGrammar, getOperation(word), getOperandCount(word) - 1u) &&
+			range.pFunction->read(&reader, *ctx.pGrammar, stdrep::move(opFunc));
 	};
 
-	iterateInstructions(writeInstr);
+	const unsigned int count = static_cast<unsigned int>(functions.size());
+
+	if (_pExecutor != nullptr)
+	{
+		_pExecutor->run(task, &context, count);
+	}
+	else
+	{
+		for (unsigned int i = 0u; i < count; ++i)
+		{
+			task(&context, i);
+		}
+	}
+
+	for (const FunctionRange& range : functions)
+	{
+		if (range.success == false)
+		{
+			logError("Failed to parse function at offset %u", static_cast<unsigned int>(range.pWords - _pWords));
+			return false;
+		}
+	}
+
+	return buildIdLookup();
 }
 
-bool spvgentwo::Module::read(IReader* _pReader, const Grammar& _grammar)
+bool spvgentwo::Module::readInstructions(IReader* _pReader, const Grammar& _grammar)
 {
 	unsigned int word{ 0 };
 
-	if (_pReader->get(word) == false || word != spv::MagicNumber)
+	// magic number, version, generator, bound, schema
+	unsigned int header[5]{};
+
+	if (logError(_pReader->read(header, 5u), "Failed to parse module header") == false) return false;
+
+	if (header[0] != spv::MagicNumber)
 	{
 		logError("Failed to parse magic number");
 		return false;
 	}
 
-	if (logError(_pReader->get(m_spvVersion), "Failed to parse version") == false) return false;
-	if (logError(_pReader->get(m_spvGenerator), "Failed to parse generator") == false) return false;
-	if (logError(_pReader->get(m_spvBound), "Failed to parse bounds") == false) return false;
-	if (logError(_pReader->get(m_spvSchema), "Failed to parse schema") == false) return false;
+	m_spvVersion = header[1];
+	m_spvGenerator = header[2];
+	m_spvBound = header[3];
+	m_spvSchema = header[4];
 
 	HashMap<spv::Id, EntryPoint*> entryPoints(m_pAllocator);
 
@@ -1139,7 +2517,7 @@ bool spvgentwo::Module::read(IReader* _pReader, const Grammar& _grammar)
 			if (addDecorationInstr()->readOperands(_pReader, _grammar, op, operands) == false) return false; break;
 		case spv::Op::OpVariable:
 			// TODO: check if storage type != function
-			// TODO: add to m_TypeToInstr and m_InstrToType after pointer resolve
+			// TODO: add to the type lookups after pointer resolve
 			if (addGlobalVariableInstr()->readOperands(_pReader, _grammar, op, operands) == false) return false; break;
 		case spv::Op::OpUndef:
 			if(addUndefInstr()->readOperands(_pReader, _grammar, op, operands) == false) return false; break;
@@ -1211,27 +2589,36 @@ spvgentwo::Instruction* spvgentwo::Module::addLineInstr()
 	return &m_Lines.emplace_back(this);
 }
 
-spvgentwo::Instruction* spvgentwo::Module::findInstructionById(const spv::Id _resultId)
+spvgentwo::Instruction* spvgentwo::Module::findInstructionById(const spv::Id _resultId) const
 {
-	Instruction* instr = nullptr;
+	if (Instruction* pInstr = lookupId(_resultId); pInstr != nullptr || _resultId == InvalidId)
+	{
+		return pInstr;
+	}
 
-	auto pred = [&instr, _resultId](Instruction& _instr) -> bool
+	// the lookup is only rebuilt by assignIDs(), resolveIDs() and read(), instructions created or renumbered since then are found by walking the module
+	const Instruction* pFound = nullptr;
+
+	iterateInstructions([&pFound, _resultId](const Instruction& _instr) -> bool
 	{
 		if (_instr.getResultId() == _resultId)
 		{
-			instr = &_instr;
+			pFound = &_instr;
 			return true; // break
 		}
 		return false;
-	};
-
-	iterateInstructions(pred);
+	});
 
-	return instr;
+	return const_cast<Instruction*>(pFound);
 }
 
 void spvgentwo::Module::gatherUses(const Instruction* _pInstr, List<Instruction*>& _outUses, Instruction* _pReplacement)
 {
+	if (const Operand replacement(_pReplacement); gatherTrackedUses(_pInstr, &_outUses, _pReplacement != nullptr ? &replacement : nullptr))
+	{
+		return;
+	}
+
 	auto gather = [_pInstr, _pReplacement, &_outUses](Instruction& _instr)
 	{
 		for (auto it = _instr.getFirstActualOperand(), end = _instr.end(); it != end; ++it)
@@ -1257,6 +2644,11 @@ void spvgentwo::Module::replaceUses(const Instruction* _pInstr, Instruction* _pR
 		return;
 	}
 
+	if (const Operand replacement(_pReplacement); gatherTrackedUses(_pInstr, nullptr, &replacement))
+	{
+		return;
+	}
+
 	auto replace = [_pInstr, _pReplacement](Instruction& _instr)
 	{
 		for (auto it = _instr.getFirstActualOperand(), end = _instr.end(); it != end; ++it)
@@ -1275,11 +2667,36 @@ void spvgentwo::Module::removeFromLookupMaps(const Instruction* _pInstr)
 {
 	if (auto itt = m_InstrToType.find(_pInstr); itt != m_InstrToType.end())
 	{
-		if(auto tti = m_TypeToInstr.find(*itt->value); tti != m_TypeToInstr.end())
+		TypeNode* pNode = const_cast<TypeNode*>(itt->value);
+		m_InstrToType.erase(itt);
+
+		// duplicate declarations share the node of the first one, the last one takes over
+		if (pNode != nullptr)
 		{
-			m_TypeToInstr.erase(tti);
+			Vector<Instruction*>& duplicates = pNode->m_duplicates;
+
+			if (pNode->m_pInstr == _pInstr)
+			{
+				pNode->m_pInstr = duplicates.empty() ? nullptr : duplicates.back();
+				duplicates.reset(duplicates.empty() ? 0u : duplicates.size() - 1u);
+			}
+			else
+			{
+				for (Instruction*& pDuplicate : duplicates)
+				{
+					if (pDuplicate == _pInstr)
+					{
+						pDuplicate = duplicates.back();
+						duplicates.reset(duplicates.size() - 1u);
+						break;
+					}
+				}
+			}
+
+			releaseTypeNode(pNode);
 		}
-		m_InstrToType.erase(itt);
+
+		clearTypeCaches();
 	}
 
 	if (auto itc = m_InstrToConstant.find(_pInstr); itc != m_InstrToConstant.end())
@@ -1289,9 +2706,239 @@ void spvgentwo::Module::removeFromLookupMaps(const Instruction* _pInstr)
 			m_ConstantToInstr.erase(cti);
 		}
 		m_InstrToConstant.erase(itc);
+
+		clearTypeCaches();
 	}
 
 	m_NameLookup.eraseRange(_pInstr);
+
+	if (const spv::Id id = _pInstr->getResultId(); id != InvalidId)
+	{
+		if (id < m_IdToInstr.size())
+		{
+			if (m_IdToInstr[id] == _pInstr)
+			{
+				m_IdToInstr[id] = nullptr;
+			}
+		}
+		else if (Instruction** ppInstr = m_SparseIdToInstr.get(id); ppInstr != nullptr && *ppInstr == _pInstr)
+		{
+			m_SparseIdToInstr.erase(hash(id), ppInstr);
+		}
+	}
+
+	if (m_trackUses)
+	{
+		removeUsesOf(_pInstr);
+		removeUses(_pInstr);
+	}
+}
+
+void spvgentwo::Module::setUseTracking(const bool _enable)
+{
+	m_trackUses = _enable;
+	buildUseLookup();
+}
+
+const spvgentwo::List<spvgentwo::Instruction*>* spvgentwo::Module::getUses(const Instruction* _pInstr) const
+{
+	return m_Uses.get(_pInstr);
+}
+
+const spvgentwo::Instruction* spvgentwo::Module::getUseKey(const Operand& _operand)
+{
+	if (_operand.isBranchTarget())
+	{
+		return _operand.branchTarget != nullptr ? _operand.branchTarget->getLabel() : nullptr;
+	}
+	return _operand.getInstruction();
+}
+
+void spvgentwo::Module::addUse(Instruction* _pUser, const Operand& _operand)
+{
+	const Instruction* pDef = getUseKey(_operand);
+
+	if (pDef == nullptr)
+	{
+		return;
+	}
+
+	// operands are added in order, an earlier operand referencing pDef already registered _pUser
+	for (auto it = _pUser->getFirstActualOperand(), end = _pUser->end(); it != end && it.operator->() != &_operand; ++it)
+	{
+		if (getUseKey(*it) == pDef)
+		{
+			return;
+		}
+	}
+
+	addUseEntry(pDef, _pUser);
+}
+
+void spvgentwo::Module::removeUses(const Instruction* _pUser)
+{
+	for (auto& node : m_UseEntries.getRange(_pUser))
+	{
+		node.kv.value.pUsers->erase(node.kv.value.pEntry);
+	}
+
+	m_UseEntries.eraseRange(_pUser);
+}
+
+void spvgentwo::Module::updateUses(Instruction* _pUser)
+{
+	if (m_trackUses == false || _pUser == nullptr)
+	{
+		return;
+	}
+
+	removeUses(_pUser);
+
+	for (auto it = _pUser->getFirstActualOperand(), end = _pUser->end(); it != end; ++it)
+	{
+		addUse(_pUser, *it);
+	}
+}
+
+void spvgentwo::Module::addUseEntry(const Instruction* _pDef, Instruction* _pUser)
+{
+	auto* pNode = m_Uses.emplaceUnique(_pDef, m_pAllocator);
+	if (pNode == nullptr)
+	{
+		logError("Failed to allocate def-use entry");
+		return;
+	}
+
+	List<Instruction*>& users = pNode->kv.value;
+	Entry<Instruction*>* pEntry = users.emplace_back_entry(_pUser);
+	if (m_UseEntries.emplace(static_cast<const Instruction*>(_pUser), UseEntry{ &users, pEntry }) == nullptr)
+	{
+		logError("Failed to allocate def-use entry");
+		users.erase(pEntry);
+	}
+}
+
+void spvgentwo::Module::removeUseEntry(const Instruction* _pDef, const Instruction* _pUser)
+{
+	const List<Instruction*>* pUsers = m_Uses.get(_pDef);
+
+	for (auto& node : m_UseEntries.getRange(_pUser))
+	{
+		if (UseEntry& entry = node.kv.value; entry.pUsers == pUsers)
+		{
+			entry.pUsers->erase(entry.pEntry);
+			m_UseEntries.erase(hash(_pUser), &entry);
+			return;
+		}
+	}
+}
+
+void spvgentwo::Module::removeUsesOf(const Instruction* _pDef)
+{
+	const List<Instruction*>* pUsers = m_Uses.get(_pDef);
+
+	if (pUsers == nullptr)
+	{
+		return;
+	}
+
+	for (const Instruction* pUser : *pUsers)
+	{
+		for (auto& node : m_UseEntries.getRange(pUser))
+		{
+			if (node.kv.value.pUsers == pUsers)
+			{
+				m_UseEntries.erase(hash(pUser), &node.kv.value);
+				break;
+			}
+		}
+	}
+
+	m_Uses.eraseRange(_pDef);
+}
+
+bool spvgentwo::Module::gatherTrackedUses(const Instruction* _pDef, List<Instruction*>* _pOutUses, const Operand* _pReplacement, const bool _branchTargets)
+{
+	if (m_trackUses == false)
+	{
+		return false;
+	}
+
+	List<Instruction*>* pUsers = m_Uses.get(_pDef);
+	if (pUsers == nullptr)
+	{
+		return true;
+	}
+
+	// instruction operands like the untracked gatherUses, branch targets of the OpLabel _pDef only if requested
+	auto matches = [_pDef, _branchTargets](const Operand& _op) -> bool
+	{
+		return _op.isBranchTarget() ? _branchTargets && getUseKey(_op) == _pDef : _op == _pDef;
+	};
+
+	const Instruction* pReplacementDef = _pReplacement != nullptr ? getUseKey(*_pReplacement) : nullptr;
+
+	if (_pReplacement == nullptr || pReplacementDef == _pDef) // nothing to replace
+	{
+		if (_pOutUses != nullptr)
+		{
+			for (Instruction* pUser : *pUsers)
+			{
+				for (auto it = pUser->getFirstActualOperand(), end = pUser->end(); it != end; ++it)
+				{
+					if (matches(*it))
+					{
+						_pOutUses->emplace_back(pUser);
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	// replace branch targets with branch targets and instructions with instructions
+	const Operand replacementTarget(pReplacementDef != nullptr ? pReplacementDef->getBasicBlock() : _pReplacement->getBranchTarget());
+	const Operand replacementInstr(const_cast<Instruction*>(pReplacementDef));
+
+	for (auto itu = pUsers->begin(); itu != pUsers->end();)
+	{
+		Instruction* pUser = *itu;
+		++itu; // pUser's entry may be removed below
+
+		bool usedReplacement = false, replaced = false, usesDef = false;
+
+		for (auto it = pUser->getFirstActualOperand(), end = pUser->end(); it != end; ++it)
+		{
+			const Instruction* pOperandDef = getUseKey(*it);
+			usedReplacement |= pOperandDef != nullptr && pOperandDef == pReplacementDef;
+
+			if (matches(*it))
+			{
+				*it = it->isBranchTarget() ? replacementTarget : replacementInstr;
+				replaced = true;
+				if (_pOutUses != nullptr)
+				{
+					_pOutUses->emplace_back(pUser);
+				}
+			}
+			else
+			{
+				usesDef |= pOperandDef == _pDef;
+			}
+		}
+
+		if (usesDef == false)
+		{
+			removeUseEntry(_pDef, pUser);
+		}
+
+		if (replaced && pReplacementDef != nullptr && usedReplacement == false)
+		{
+			addUseEntry(pReplacementDef, pUser);
+		}
+	}
+
+	return true;
 }
 
 bool spvgentwo::Module::remove(const Instruction* _pInstr)
@@ -1301,11 +2948,12 @@ bool spvgentwo::Module::remove(const Instruction* _pInstr)
 		return false;
 	}
 
-	auto erase = [_pInstr](List<Instruction>& container) -> bool
+	auto erase = [_pInstr, this](List<Instruction>& container) -> bool
 	{
 		auto it = container.find_if([_pInstr](const Instruction& _instr) {return &_instr == _pInstr; });
 		if (it != container.end())
 		{
+			removeFromLookupMaps(_pInstr);
 			container.erase(it);
 			return true;
 		}
@@ -1321,6 +2969,7 @@ bool spvgentwo::Module::remove(const Instruction* _pInstr)
 		{
 			if (&value == _pInstr) 
 			{
+				removeFromLookupMaps(_pInstr);
 				m_ExtInstrImport.erase(m_ExtInstrImport.find(key));
 				return true;
 			}
@@ -3,26 +3,28 @@
 #include "spvgentwo/Instruction.h"
 #include "spvgentwo/BasicBlock.h"
 
-void spvgentwo::Operand::write(IWriter* _pWriter) const
+unsigned int spvgentwo::Operand::getWord() const
 {
 	switch (type)
 	{
 	case Type::Instruction:
-		_pWriter->put(instruction->getResultId());
-		break;
+		return instruction->getResultId();
 	case Type::BranchTarget:
-		_pWriter->put(branchTarget->getLabel()->getResultId());
-		break;
+		return branchTarget->getLabel()->getResultId();
 	case Type::Literal:
-		_pWriter->put(literal.value);
-		break;
+		return literal.value;
 	case Type::Id:
-		_pWriter->put(id);
+		return id;
 	default:
-		break;
+		return InvalidId;
 	}
 }
 
+void spvgentwo::Operand::write(IWriter* _pWriter) const
+{
+	_pWriter->put(getWord());
+}
+
 spvgentwo::Operand::Operand(const Operand& _other) :
 	type(_other.type)
 {
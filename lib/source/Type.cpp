@@ -92,6 +92,11 @@ spvgentwo::Type& spvgentwo::Type::operator=(const Type& _other)
 }
 
 bool spvgentwo::Type::operator==(const Type& _other) const
+{
+	return hasSameProperties(_other) && m_subTypes == _other.m_subTypes;
+}
+
+bool spvgentwo::Type::hasSameProperties(const Type& _other) const
 {
 	return
 		m_Type == _other.m_Type &&
@@ -103,8 +108,7 @@ bool spvgentwo::Type::operator==(const Type& _other) const
 		m_ImgSamplerAccess ==_other.m_ImgSamplerAccess &&
 		m_ImgFormat == _other.m_ImgFormat &&
 		m_StorageClass == _other.m_StorageClass &&
-		m_AccessQualifier == _other.m_AccessQualifier &&
-		m_subTypes == _other.m_subTypes;
+		m_AccessQualifier == _other.m_AccessQualifier;
 }
 
 const spvgentwo::Type& spvgentwo::Type::getBaseType() const
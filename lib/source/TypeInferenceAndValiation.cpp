@@ -16,6 +16,9 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 	const Type* type1 = typeInstr1 != nullptr ? typeInstr1->getType() : nullptr;
 	const Type* type2 = typeInstr2 != nullptr ? typeInstr2->getType() : nullptr;
 
+	// derived types are looked up on the interned nodes to avoid building and hashing Type trees
+	auto result = [module](const TypeNode* _pNode) -> Instruction* { return _pNode != nullptr ? module->addType(_pNode) : module->getErrorInstr(); };
+
 	switch (_instr.getOperation())
 	{
 	case spv::Op::OpSizeOf:
@@ -77,7 +80,7 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 		// => return matrix row type:
 		if (type1->isMatrix())
 		{
-			return module->addType(type1->front().wrapVector(type1->getMatrixColumnCount()));
+			return result(module->wrapType(module->getTypeNode(typeInstr1)->front(), spv::Op::OpTypeVector, type1->getMatrixColumnCount()));
 		}
 		break;
 	}
@@ -103,7 +106,7 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 		// Its number of columns must equal the number of columns in Result Type.
 		// Its columns must have the same number of components as the number of columns in LeftMatrix.
 
-		return module->addType(type1->front().wrapMatrix(type2->getMatrixColumnCount()));
+		return result(module->wrapType(module->getTypeNode(typeInstr1)->front(), spv::Op::OpTypeMatrix, type2->getMatrixColumnCount()));
 	}
 	case spv::Op::OpOuterProduct:
 	{
@@ -115,7 +118,7 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 		// Vector 2 must be a vector with the same Component Type as the Component Type in Result Type.
 		// Its number of components must equal the number of columns in Result Type.
 
-		return module->addType(type1->wrapMatrix(type2->getVectorComponentCount()));
+		return result(module->wrapType(module->getTypeNode(typeInstr1), spv::Op::OpTypeMatrix, type2->getVectorComponentCount()));
 	}
 	case spv::Op::OpDot:
 	{
@@ -136,7 +139,7 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 	}
 	case spv::Op::OpVectorExtractDynamic:
 		if (type1 == nullptr) return module->getErrorInstr();
-		return module->addType(type1->front()); 
+		return result(module->getTypeNode(typeInstr1)->front());
 	case spv::Op::OpAny:
 	case spv::Op::OpAll:
 		return module->type<bool>();
@@ -203,7 +206,7 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 		return typeInstr2;
 	case spv::Op::OpSampledImage:
 		if (type1 == nullptr) return module->getErrorInstr();
-		return module->addType(type1->wrap(spv::Op::OpTypeSampledImage));
+		return result(module->wrapType(module->getTypeNode(typeInstr1), spv::Op::OpTypeSampledImage));
 
 	case spv::Op::OpImageSampleImplicitLod:
 	case spv::Op::OpImageSampleExplicitLod:
@@ -220,22 +223,23 @@ spvgentwo::Instruction* spvgentwo::defaultimpl::inferResultType(const spvgentwo:
 	{
 		if (type1 == nullptr) break;
 
-		const Type* image = type1->isSampledImage() ? &type1->front() : (type1->isImage() ? type1 : nullptr); // _pType1 is SampleImage or Image
-		if (image == nullptr) break;
+		const TypeNode* node1 = module->getTypeNode(typeInstr1);
+		const TypeNode* image = type1->isSampledImage() ? node1->front() : (type1->isImage() ? node1 : nullptr); // _pType1 is SampleImage or Image
+		if (image == nullptr || image->front() == nullptr) break;
 		
-		const Type& sampledType = image->front();
+		const TypeNode* sampledType = image->front();
 
 		//Result Type must be a vector of four components of ﬂoating-point type or integer type.
 		//Its components must be the same as Sampled Type of the underlying OpTypeImage (unless that underlying Sampled Type isOpTypeVoid).
 		
-		if (sampledType.isVoid())
+		if (sampledType->getType().isVoid())
 		{
 			// not sure what todo, return void? or return float4?
 			return module->type<vector_t<float, 4>>();
 		}
 		else
 		{
-			return module->addType(sampledType.wrapVector(4));
+			return result(module->wrapType(sampledType, spv::Op::OpTypeVector, 4u));
 		}
 	}		
 		break;
@@ -0,0 +1,46 @@
+#include "spvgentwo/TypeNode.h"
+
+spvgentwo::TypeNode::TypeNode(IAllocator* _pAllocator, Type&& _type, Instruction* _pInstr, const Hash64 _hash, const TypeNode* const* _pSubTypes, const unsigned int _count) :
+	m_type(stdrep::move(_type)),
+	m_pInstr(_pInstr),
+	m_duplicates(_pAllocator),
+	m_hash(_hash),
+	m_subTypes(_pAllocator)
+{
+	m_subTypes.reserve(_count);
+	for (unsigned int i = 0u; i < _count; ++i)
+	{
+		m_subTypes.emplace_back(_pSubTypes[i]);
+	}
+}
+
+spvgentwo::Hash64 spvgentwo::TypeNode::hash(const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count)
+{
+	FNV1aHasher h;
+	Hasher<Type>().properties(_type, h);
+
+	for (unsigned int i = 0u; i < _count; ++i)
+	{
+		h << (_pSubTypes[i] != nullptr ? _pSubTypes[i]->m_hash : Hash64(0u));
+	}
+
+	return h;
+}
+
+bool spvgentwo::TypeNode::equals(const Type& _type, const TypeNode* const* _pSubTypes, const unsigned int _count) const
+{
+	if (m_subTypes.size() != _count || m_type.hasSameProperties(_type) == false)
+	{
+		return false;
+	}
+
+	for (unsigned int i = 0u; i < _count; ++i)
+	{
+		if (m_subTypes[i] != _pSubTypes[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}